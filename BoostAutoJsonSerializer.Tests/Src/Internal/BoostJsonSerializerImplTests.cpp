@@ -7,12 +7,19 @@
 
 #include "CommonTestsConfig.hpp"
 
+#include <atomic>
 #include <cmath>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <thread>
 
 #include "Interfaces/Factories/IObjectFactories.hpp"
 #include "Internal/BoostJsonSerializerImpl.hpp"
 #include "Internal/BoostJsonSerializerInfra.hpp"
 
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidArgument.hpp"
 #include "Exceptions/XSerialization.hpp"
 
 // #region Namespace Symbols
@@ -27,6 +34,45 @@ namespace bv2 = boost::variant2;
 
 // #endregion
 
+// #region Heap Allocation Counting
+
+namespace
+{
+    /**
+     * @brief Whether the heap allocations of the calling thread are counted.
+     */
+    thread_local bool CountingHeapAllocations = false;
+
+    thread_local std::size_t HeapAllocationCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    if (CountingHeapAllocations)
+    {
+        ++HeapAllocationCount;
+    }
+
+    if (void* pointer = std::malloc(0 == size ? 1 : size))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// #endregion
+
 namespace
 {
     /**
@@ -136,6 +182,179 @@ namespace
         ASSERT_DOUBLE_EQ(bv2::get<double>(testPolicy.Settings["negativeDoubleKey"].data), -4.56);
     }
 
+    TEST_F(BoostJsonSerializerImplTestFixture, DeserializeIntoSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<IJsonDataSerializerImplFactory> boostSerializerFactory = GetFactory();
+        std::shared_ptr<IJsonDataSerializerImpl> boostSerializer;
+        boostSerializerFactory->Create(boostSerializer);
+
+        TestDataTestPolicy testPolicy;
+        testPolicy.Settings["staleKey"] = {std::string("stale")};
+
+        boostSerializer->Deserialize(R"({"Capabilities": {"boolKey": true},
+                                         "Settings": {"stringKey": "first value", "intKey": 1}})",
+                                     testPolicy);
+
+        const DeserializationValue* stringValue = &testPolicy.Settings.at("stringKey");
+
+        // Act
+        boostSerializer->Deserialize(R"({"Capabilities": {"boolKey": false},
+                                         "Settings": {"intKey": 2, "stringKey": "second"}})",
+                                     testPolicy);
+
+        // Assert, the entry is the same node and the stale one is gone.
+        EXPECT_EQ(testPolicy.Capabilities.size(), 1);
+        EXPECT_EQ(testPolicy.Settings.size(), 2);
+        EXPECT_EQ(&testPolicy.Settings.at("stringKey"), stringValue);
+        EXPECT_EQ(bv2::get<std::string>(testPolicy.Settings["stringKey"].data), "second");
+        EXPECT_EQ(bv2::get<int64_t>(testPolicy.Settings["intKey"].data), 2);
+        EXPECT_EQ(bv2::get<bool>(testPolicy.Capabilities["boolKey"].data), false);
+    }
+
+    /**
+     * @brief Replaces the default memory resource for its lifetime, restoring it however the scope is left.
+     */
+    class DefaultResourceGuard
+    {
+    public:
+        explicit DefaultResourceGuard(std::pmr::memory_resource* resource)
+            : _previous(std::pmr::set_default_resource(resource))
+        {
+        }
+
+        ~DefaultResourceGuard()
+        {
+            std::pmr::set_default_resource(_previous);
+        }
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(DefaultResourceGuard)
+
+        std::pmr::memory_resource* const _previous;
+    };
+
+    TEST_F(BoostJsonSerializerImplTestFixture, DeserializeWithResourceSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<IJsonDataSerializerImplFactory> boostSerializerFactory = GetFactory();
+        std::shared_ptr<IJsonDataSerializerImpl> boostSerializer;
+        boostSerializerFactory->Create(boostSerializer);
+
+        std::pmr::monotonic_buffer_resource arena;
+        PmrTestDataTestPolicy testPolicy{PmrAllocator(&arena)};
+
+        // Act, nothing of the policy may come from the default resource.
+        {
+            DefaultResourceGuard nullDefault(std::pmr::null_memory_resource());
+
+            testPolicy = boostSerializer->Deserialize(
+                R"({"Capabilities": {"boolKey": true, "doubleKey": 1.23},
+                    "Settings": {"a string key longer than the small buffer":
+                                     "a string value longer than the small buffer",
+                                 "intKey": -123}})",
+                &arena);
+        }
+
+        // Assert
+        EXPECT_EQ(testPolicy.Capabilities.get_allocator().resource(), &arena);
+        EXPECT_EQ(testPolicy.Capabilities.size(), 2);
+        EXPECT_EQ(testPolicy.Settings.size(), 2);
+        EXPECT_EQ(bv2::get<bool>(testPolicy.Capabilities.at("boolKey").data), true);
+        ASSERT_DOUBLE_EQ(bv2::get<double>(testPolicy.Capabilities.at("doubleKey").data), 1.23);
+        EXPECT_EQ(bv2::get<int64_t>(testPolicy.Settings.at("intKey").data), -123);
+
+        const auto& [key, value] = *testPolicy.Settings.begin();
+        const std::pmr::string& text = bv2::get<std::pmr::string>(value.data);
+        EXPECT_EQ(key, "a string key longer than the small buffer");
+        EXPECT_EQ(key.get_allocator().resource(), &arena);
+        EXPECT_EQ(text, "a string value longer than the small buffer");
+        EXPECT_EQ(text.get_allocator().resource(), &arena);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, DeserializeWithResourceFailure)
+    {
+        // Arrange
+        BoostJsonSerializerImpl boostSerializer;
+        std::pmr::monotonic_buffer_resource arena;
+
+        // Act & Assert
+        EXPECT_THROW(boostSerializer.Deserialize(R"({"Capabilities": {}, "Settings": {}})", nullptr), XArgumentNull);
+        EXPECT_THROW(boostSerializer.Deserialize(R"({"Capabilities": {}})", &arena), XSerialization);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, GetLastMemberMatchingReportSuccessful)
+    {
+        // Arrange
+        BoostJsonSerializerImpl boostSerializer(AllocationTracking::Disabled, nullptr,
+                                                {MemberKeyPolicy::Collect, MemberKeyPolicy::Collect});
+
+        // Act
+        TestDataTestPolicy testPolicy = boostSerializer.Deserialize(R"({"Version": 2, "Capabilities": {"intKey": 1}})");
+        MemberMatchingReport report = boostSerializer.GetLastMemberMatchingReport();
+
+        // Assert
+        EXPECT_EQ(testPolicy.Capabilities.size(), 1);
+        EXPECT_TRUE(testPolicy.Settings.empty());
+        EXPECT_EQ(report.UnknownKeys, std::vector<std::string>{"Version"});
+        EXPECT_EQ(report.MissingKeys, std::vector<std::string>{"Settings"});
+
+        // The report only covers the last call.
+        boostSerializer.Deserialize(R"({"Capabilities": {}, "Settings": {}})");
+        report = boostSerializer.GetLastMemberMatchingReport();
+
+        EXPECT_TRUE(report.UnknownKeys.empty());
+        EXPECT_TRUE(report.MissingKeys.empty());
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, DeserializeParseLimitsFailure)
+    {
+        // Arrange
+        JsonParseConfiguration parseConfiguration;
+        parseConfiguration.MaxStringLength = 8;
+        parseConfiguration.MaxObjectSize = 2;
+
+        BoostJsonSerializerImpl boostSerializer(AllocationTracking::Disabled, nullptr, {}, parseConfiguration);
+
+        // Act -> Assert
+        EXPECT_NO_THROW(boostSerializer.Deserialize(R"({"Capabilities": {"intKey": 1}, "Settings": {}})"));
+        EXPECT_THROW(boostSerializer.Deserialize(R"({"Capabilities": {"intKey": "too long value"}, "Settings": {}})"),
+                     XSerialization);
+        EXPECT_THROW(boostSerializer.Deserialize(R"({"Capabilities": {"a": 1, "b": 2, "c": 3}, "Settings": {}})"),
+                     XSerialization);
+
+        // The parser of the thread is still usable after a rejected payload.
+        EXPECT_NO_THROW(boostSerializer.Deserialize(R"({"Capabilities": {}, "Settings": {"key": "value"}})"));
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, DeserializeParseOptionsSuccessful)
+    {
+        // Arrange
+        JsonParseConfiguration parseConfiguration;
+        parseConfiguration.AllowComments = true;
+        parseConfiguration.AllowTrailingCommas = true;
+
+        BoostJsonSerializerImpl boostSerializer(AllocationTracking::Disabled, nullptr, {}, parseConfiguration);
+        const std::string inputPayload = R"({"Capabilities": {"intKey": 1,}, /* none */ "Settings": {},})";
+
+        // Act
+        TestDataTestPolicy testPolicy = boostSerializer.Deserialize(inputPayload);
+
+        // Assert
+        EXPECT_EQ(testPolicy.Capabilities.size(), 1);
+        EXPECT_THROW(BoostJsonSerializerImpl().Deserialize(inputPayload), XSerialization);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, InvalidParseConfigurationFailure)
+    {
+        // Arrange
+        JsonParseConfiguration parseConfiguration;
+        parseConfiguration.MaxDepth = 0;
+
+        // Act -> Assert
+        EXPECT_THROW(BoostJsonSerializerImpl(AllocationTracking::Disabled, nullptr, {}, parseConfiguration), XInvalidArgument);
+    }
+
     /**
      * @brief Invalid payload data sets.
      */
@@ -367,5 +586,276 @@ namespace
         EXPECT_TRUE(AreEqual(expectedResult, actualResult));
     }
 
+    TEST_F(BoostJsonSerializerImplTestFixture, SerializeWithinStorageSuccessful)
+    {
+        // Arrange, a storage that has no upstream to fall back to.
+        const TestDataTestResults inputTestResults = CreateTestDataTestResultsInstance();
+
+        unsigned char buffer[16 * 1024];
+        bj::monotonic_resource resource(buffer, sizeof(buffer), bj::get_null_resource());
+
+        // Act, every member subtree is built in the storage given to value_from.
+        HeapAllocationCount = 0;
+        CountingHeapAllocations = true;
+        const bj::value value = bj::value_from(inputTestResults, bj::storage_ptr(&resource));
+        CountingHeapAllocations = false;
+
+        // Assert
+        EXPECT_EQ(HeapAllocationCount, 0);
+        EXPECT_EQ(value.as_object().at("MonitorResults").as_array().at(0).storage().get(), &resource);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, SerializePmrResultsSuccessful)
+    {
+        // Arrange, the same sample data built within an arena.
+        std::pmr::monotonic_buffer_resource arena;
+        PmrTestDataTestResults pmrResults{PmrAllocator(&arena)};
+        PmrTestDataStepResults& stepResult = pmrResults.MonitorResults.emplace_back().StepResults.emplace_back();
+
+        std::pmr::map<std::pmr::string, PmrSerializationValue>& metricData = stepResult.Metrics.emplace_back().MetricData;
+        metricData.emplace("string_key", std::pmr::string("string_value"));
+        metricData.emplace("float_key", 123.45f);
+        metricData.emplace("int_key", 123);
+        metricData.emplace("bool_key", true);
+        metricData.emplace("negative_int_key", -123);
+        stepResult.OtherData.emplace("other_string_key", std::pmr::string("other_string_value"));
+
+        std::shared_ptr<IJsonDataSerializerImplFactory> boostSerializerFactory = GetFactory();
+        std::shared_ptr<IJsonDataSerializerImpl> boostSerializer;
+        boostSerializerFactory->Create(boostSerializer);
+
+        // Act
+        const bj::value pmrValue = bj::value_from(pmrResults);
+        const PmrTestDataTestResults loadedResults = bj::value_to<PmrTestDataTestResults>(pmrValue);
+
+        // Assert
+        EXPECT_TRUE(AreEqual(boostSerializer->Serialize(CreateTestDataTestResultsInstance()), bj::serialize(pmrValue)));
+        EXPECT_TRUE(AreEqual(bj::serialize(pmrValue), bj::serialize(bj::value_from(loadedResults))));
+        EXPECT_EQ(bv2::get<std::pmr::string>(metricData.at("string_key").data).get_allocator().resource(), &arena);
+    }
+
+    /**
+     * @brief Keeps the chunks written into it.
+     */
+    class ChunkCollector : public IChunkSink
+    {
+    public:
+        void Write(std::string_view chunk) override
+        {
+            Chunks.emplace_back(chunk);
+        }
+
+        void Finish() override
+        {
+            ++FinishCount;
+        }
+
+        std::vector<std::string> Chunks;
+
+        int FinishCount = 0;
+    };
+
+    TEST_F(BoostJsonSerializerImplTestFixture, SerializeToSinkSuccessful)
+    {
+        // Arrange, large enough to be written in several chunks.
+        TestDataTestResults inputTestResults = CreateTestDataTestResultsInstance();
+        TestDataMetrics& metric = inputTestResults.MonitorResults.back().StepResults.back().Metrics.back();
+
+        for (int index = 0; index < 10000; ++index)
+        {
+            metric.MetricData["key_" + std::to_string(index)] = {std::string("value_") + std::to_string(index)};
+        }
+
+        BoostJsonSerializerImpl boostSerializer;
+        ChunkCollector sink;
+
+        // Act
+        boostSerializer.Serialize(inputTestResults, sink);
+
+        // Assert
+        std::string output;
+
+        for (const std::string& chunk : sink.Chunks)
+        {
+            output += chunk;
+        }
+
+        EXPECT_GT(sink.Chunks.size(), 1);
+        EXPECT_EQ(sink.FinishCount, 0);
+        EXPECT_EQ(output, boostSerializer.Serialize(inputTestResults));
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, GetSerializedSizeSuccessful)
+    {
+        // Arrange
+        TestDataTestResults inputTestResults = CreateTestDataTestResultsInstance();
+
+        std::shared_ptr<IJsonDataSerializerImplFactory> boostSerializerFactory = GetFactory();
+        std::shared_ptr<IJsonDataSerializerImpl> boostSerializer;
+        boostSerializerFactory->Create(boostSerializer);
+
+        // Act
+        std::size_t actualSize = boostSerializer->GetSerializedSize(inputTestResults);
+
+        // Assert
+        EXPECT_EQ(actualSize, boostSerializer->Serialize(inputTestResults).size());
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, ConcurrentSharedInstanceSuccessful)
+    {
+        // Arrange
+        constexpr std::size_t ThreadCount = 8;
+        constexpr int IterationCount = 200;
+
+        TestDataTestResults inputTestResults = CreateTestDataTestResultsInstance();
+
+        std::shared_ptr<BoostJsonSerializerImpl> boostSerializer = std::make_shared<BoostJsonSerializerImpl>();
+        const std::string expectedResult = boostSerializer->Serialize(inputTestResults);
+
+        std::atomic<int> failureCount{0};
+        std::vector<std::thread> threads;
+
+        // Act
+        for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&, threadIndex]()
+                                 {
+                                     const std::string payload = R"({"Capabilities": {"thread": )" + std::to_string(threadIndex) +
+                                                                 R"(}, "Settings": {"key": "value"}})";
+
+                                     for (int iteration = 0; iteration < IterationCount; ++iteration)
+                                     {
+                                         TestDataTestPolicy testPolicy = boostSerializer->Deserialize(payload);
+
+                                         if (bv2::get<int64_t>(testPolicy.Capabilities["thread"].data) != static_cast<int64_t>(threadIndex) ||
+                                             boostSerializer->Serialize(inputTestResults) != expectedResult)
+                                         {
+                                             ++failureCount;
+                                         }
+
+                                         // Failures must leave the context usable for the next call.
+                                         try
+                                         {
+                                             boostSerializer->Deserialize("{");
+                                             ++failureCount;
+                                         }
+                                         catch (const XSerialization&)
+                                         {
+                                         }
+                                     } });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Assert
+        EXPECT_EQ(failureCount.load(), 0);
+        // Only the context of the main thread is left, the joined threads released theirs.
+        EXPECT_EQ(boostSerializer->GetContextCount(), 1);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, GetLastAllocationStatisticsSuccessful)
+    {
+        // Arrange
+        const std::string smallPayload = R"({"Capabilities": {"key": 1}, "Settings": {}})";
+        const std::string largePayload = R"({"Capabilities": {"key": 1, "otherKey": 2, "thirdKey": 3},
+                                             "Settings": {"key": "a value longer than the inline string buffer"}})";
+
+        TestDataTestResults inputTestResults = CreateTestDataTestResultsInstance();
+
+        BoostJsonSerializerImpl boostSerializer(AllocationTracking::Enabled);
+
+        // Act
+        boostSerializer.Deserialize(smallPayload);
+        AllocationStatistics smallStatistics = boostSerializer.GetLastAllocationStatistics();
+
+        boostSerializer.Deserialize(largePayload);
+        AllocationStatistics largeStatistics = boostSerializer.GetLastAllocationStatistics();
+
+        boostSerializer.Deserialize(smallPayload);
+        AllocationStatistics repeatedStatistics = boostSerializer.GetLastAllocationStatistics();
+
+        boostSerializer.Serialize(inputTestResults);
+        AllocationStatistics serializeStatistics = boostSerializer.GetLastAllocationStatistics();
+
+        // Assert
+        EXPECT_GT(smallStatistics.Allocations, 0);
+        EXPECT_EQ(smallStatistics.Allocations, smallStatistics.Deallocations);
+        EXPECT_LE(smallStatistics.PeakBytes, smallStatistics.AllocatedBytes);
+
+        EXPECT_GT(largeStatistics.Allocations, smallStatistics.Allocations);
+        EXPECT_GT(largeStatistics.AllocatedBytes, smallStatistics.AllocatedBytes);
+
+        // The counts only depend on the payload, so they can be pinned.
+        EXPECT_EQ(repeatedStatistics.Allocations, smallStatistics.Allocations);
+        EXPECT_EQ(repeatedStatistics.AllocatedBytes, smallStatistics.AllocatedBytes);
+        EXPECT_EQ(repeatedStatistics.PeakBytes, smallStatistics.PeakBytes);
+
+        EXPECT_GT(serializeStatistics.Allocations, 0);
+        EXPECT_EQ(serializeStatistics.Allocations, serializeStatistics.Deallocations);
+
+        // One block per key, per non-empty object or array table and per string past the inline buffer.
+        EXPECT_EQ(smallStatistics.Allocations, 5);
+        EXPECT_EQ(smallStatistics.AllocatedBytes, 154);
+
+        EXPECT_EQ(largeStatistics.Allocations, 10);
+        EXPECT_EQ(largeStatistics.AllocatedBytes, 341);
+
+        // The objects of the described structs grow one member at a time.
+        EXPECT_EQ(serializeStatistics.Allocations, 28);
+        EXPECT_EQ(serializeStatistics.AllocatedBytes, 1037);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, GetLastAllocationStatisticsUntrackedSuccessful)
+    {
+        // Arrange
+        BoostJsonSerializerImpl boostSerializer;
+
+        // Act
+        boostSerializer.Deserialize(R"({"Capabilities": {"key": 1}, "Settings": {}})");
+        AllocationStatistics statistics = boostSerializer.GetLastAllocationStatistics();
+
+        // Assert
+        EXPECT_EQ(statistics.Allocations, 0);
+        EXPECT_EQ(statistics.AllocatedBytes, 0);
+    }
+
+    TEST_F(BoostJsonSerializerImplTestFixture, TraceSuccessful)
+    {
+        // Arrange
+        const std::string inputPayload = R"({"Capabilities": {"key": 1}, "Settings": {}})";
+        TestDataTestResults inputTestResults = CreateTestDataTestResultsInstance();
+
+        std::shared_ptr<TraceRecorder> traceRecorder = std::make_shared<TraceRecorder>();
+        BoostJsonSerializerImpl boostSerializer(AllocationTracking::Disabled, traceRecorder);
+
+        // Act
+        boostSerializer.Deserialize(inputPayload);
+        const std::string resultPayload = boostSerializer.Serialize(inputTestResults);
+
+        bj::value trace = bj::parse(traceRecorder->Flush());
+
+        // Assert
+        std::vector<std::string> names;
+        std::map<std::string, int64_t> bytes;
+
+        for (const bj::value& event : trace.at("traceEvents").as_array())
+        {
+            EXPECT_EQ(event.at("cat").as_string(), "BoostJsonSerializerImpl");
+
+            names.emplace_back(event.at("name").as_string().c_str());
+            bytes[names.back()] = event.at("args").at("bytes").to_number<int64_t>();
+        }
+
+        // The events are recorded when their scopes end, the inner ones first.
+        EXPECT_EQ(names, (std::vector<std::string>{"Parse", "Convert", "Deserialize",
+                                                   "Convert", "Size", "Format", "Serialize"}));
+        EXPECT_EQ(bytes["Parse"], static_cast<int64_t>(inputPayload.size()));
+        EXPECT_EQ(bytes["Format"], static_cast<int64_t>(resultPayload.size()));
+        EXPECT_EQ(bytes["Serialize"], static_cast<int64_t>(resultPayload.size()));
+    }
+
     // #endregion
 } // Anonymous namespace
\ No newline at end of file
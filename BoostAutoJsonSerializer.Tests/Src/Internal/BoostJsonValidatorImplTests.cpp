@@ -10,6 +10,7 @@
 #include "Interfaces/Factories/IObjectFactories.hpp"
 #include "Internal/BoostJsonValidatorImpl.hpp"
 
+#include "Exceptions/XInvalidArgument.hpp"
 #include "Exceptions/XInvalidFormat.hpp"
 
 // #region Namespace Symbols
@@ -113,6 +114,108 @@ namespace
         EXPECT_NO_THROW(boostValidator->Validate(inputPayload));
     }
 
+    /**
+     * @brief Create a payload above the threshold of the structural fast path.
+     *
+     * @param[in] lastValue The text of the value of the last member.
+     *
+     * @return A large JSON object.
+     */
+    std::string CreateLargePayload(const std::string& lastValue)
+    {
+        std::string payload = "{";
+
+        while (payload.size() < BoostJsonValidatorImpl::StructuralFastPathThreshold)
+        {
+            payload += "\"key" + std::to_string(payload.size()) + "\": [\"value \\\" \\u00e9\", 1.5, true, null],";
+        }
+
+        return payload + "\"last\": " + lastValue + "}";
+    }
+
+    TEST_F(BoostJsonValidatorImplTestFixture, ValidateLargePayloadSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<IJsonDataValidatorImplFactory> boostValidatorFactory = GetFactory();
+        std::shared_ptr<IJsonDataValidatorImpl> boostValidator;
+        boostValidatorFactory->Create(boostValidator);
+
+        // Act -> Assert
+        EXPECT_NO_THROW(boostValidator->Validate(CreateLargePayload("{\"nested\": [1, 2, 3]}")));
+    }
+
+    TEST_F(BoostJsonValidatorImplTestFixture, ValidateLargePayloadFailure)
+    {
+        // Arrange
+        std::shared_ptr<IJsonDataValidatorImplFactory> boostValidatorFactory = GetFactory();
+        std::shared_ptr<IJsonDataValidatorImpl> boostValidator;
+        boostValidatorFactory->Create(boostValidator);
+
+        // Act -> Assert
+        EXPECT_THROW(boostValidator->Validate(CreateLargePayload("[1, 2,]")), XInvalidFormat);
+        EXPECT_THROW(boostValidator->Validate(CreateLargePayload("\"unterminated")), XInvalidFormat);
+    }
+
+    TEST_F(BoostJsonValidatorImplTestFixture, ValidateTraceSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<TraceRecorder> traceRecorder = std::make_shared<TraceRecorder>();
+        BoostJsonValidatorImpl boostValidator(traceRecorder);
+
+        // Act
+        boostValidator.Validate(R"({"key": "value"})");
+        boostValidator.Validate(CreateLargePayload("{\"nested\": [1, 2, 3]}"));
+
+        boost::json::value trace = boost::json::parse(traceRecorder->Flush());
+
+        // Assert
+        std::vector<std::string> names;
+
+        for (const boost::json::value& event : trace.at("traceEvents").as_array())
+        {
+            EXPECT_EQ(event.at("cat").as_string(), "BoostJsonValidatorImpl");
+            names.emplace_back(event.at("name").as_string().c_str());
+        }
+
+        // The events are recorded when their scopes end, the inner ones first.
+        EXPECT_EQ(names, (std::vector<std::string>{"Parse", "Validate", "StructuralScan", "Validate"}));
+    }
+
+    TEST_F(BoostJsonValidatorImplTestFixture, ValidateParseLimitsFailure)
+    {
+        // Arrange
+        JsonParseConfiguration parseConfiguration;
+        parseConfiguration.MaxPayloadBytes = 2 * BoostJsonValidatorImpl::StructuralFastPathThreshold;
+        parseConfiguration.MaxObjectSize = 4;
+
+        BoostJsonValidatorImpl boostValidator(nullptr, parseConfiguration);
+
+        // Act -> Assert
+        EXPECT_NO_THROW(boostValidator.Validate(R"({"key": [1, 2, 3, 4]})"));
+        EXPECT_THROW(boostValidator.Validate(R"({"key": [1, 2, 3, 4, 5]})"), XInvalidFormat);
+        EXPECT_THROW(boostValidator.Validate(std::string(parseConfiguration.MaxPayloadBytes + 1, ' ') + "{}"),
+                     XInvalidFormat);
+
+        // The object size limit applies to the large payloads too, they skip the structural fast path.
+        EXPECT_THROW(boostValidator.Validate(CreateLargePayload("{}")), XInvalidFormat);
+    }
+
+    TEST_F(BoostJsonValidatorImplTestFixture, ValidateMaxDepthFailure)
+    {
+        // Arrange
+        JsonParseConfiguration parseConfiguration;
+        parseConfiguration.MaxDepth = 3;
+
+        BoostJsonValidatorImpl boostValidator(nullptr, parseConfiguration);
+
+        // Act -> Assert
+        EXPECT_NO_THROW(boostValidator.Validate(CreateLargePayload("{\"nested\": 1}")));
+        EXPECT_THROW(boostValidator.Validate(CreateLargePayload("{\"nested\": [[1]]}")), XInvalidFormat);
+
+        parseConfiguration.MaxDepth = 0;
+        EXPECT_THROW(BoostJsonValidatorImpl(nullptr, parseConfiguration), XInvalidArgument);
+    }
+
     /**
      * @brief Invalid payload data sets.
      */
@@ -0,0 +1,127 @@
+/*************************************************************************************************
+ * @file BoundedMpscQueueTests.cpp
+ *
+ * @brief Contains unit tests for class @ref BoundedMpscQueue.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <thread>
+
+#include "Internal/BoundedMpscQueue.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    // #region Unit Tests
+
+    TEST(BoundedMpscQueueTests, ConstructorInvalidCapacityFailure)
+    {
+        // Arrange -> Act -> Assert
+        ASSERT_THROW(BoundedMpscQueue<int>(0), XInvalidArgument);
+    }
+
+    TEST(BoundedMpscQueueTests, CapacityRoundedUpToPowerOfTwo)
+    {
+        // Arrange -> Act -> Assert
+        EXPECT_EQ(BoundedMpscQueue<int>(1).GetCapacity(), 2);
+        EXPECT_EQ(BoundedMpscQueue<int>(5).GetCapacity(), 8);
+        EXPECT_EQ(BoundedMpscQueue<int>(64).GetCapacity(), 64);
+    }
+
+    TEST(BoundedMpscQueueTests, PushPopInOrderUntilFull)
+    {
+        // Arrange
+        BoundedMpscQueue<std::string> queue(4);
+
+        // Act -> Assert
+        for (int index = 0; index < 4; ++index)
+        {
+            std::string element = std::to_string(index);
+            ASSERT_TRUE(queue.TryPush(element));
+            EXPECT_TRUE(element.empty());
+        }
+
+        std::string rejected = "rejected";
+        EXPECT_FALSE(queue.TryPush(rejected));
+        EXPECT_EQ(rejected, "rejected");
+        EXPECT_EQ(queue.GetApproximateSize(), 4);
+
+        for (int index = 0; index < 4; ++index)
+        {
+            std::string element;
+            ASSERT_TRUE(queue.TryPop(element));
+            EXPECT_EQ(element, std::to_string(index));
+        }
+
+        std::string element;
+        EXPECT_FALSE(queue.TryPop(element));
+        EXPECT_EQ(queue.GetApproximateSize(), 0);
+    }
+
+    TEST(BoundedMpscQueueTests, ConcurrentProducersKeepTheirOrder)
+    {
+        // Arrange
+        constexpr int ProducerCount = 4;
+        constexpr int ElementCount = 5000;
+
+        BoundedMpscQueue<std::pair<int, int>> queue(16);
+        std::vector<std::thread> producers;
+
+        // Act
+        for (int producer = 0; producer < ProducerCount; ++producer)
+        {
+            producers.emplace_back([&queue, producer]()
+                                   {
+                                       for (int index = 0; index < ElementCount; ++index)
+                                       {
+                                           std::pair<int, int> element{producer, index};
+
+                                           while (!queue.TryPush(element))
+                                           {
+                                               std::this_thread::yield();
+                                           }
+                                       } });
+        }
+
+        std::vector<int> nextIndexes(ProducerCount, 0);
+        int received = 0;
+        bool ordered = true;
+
+        while (received < ProducerCount * ElementCount)
+        {
+            std::pair<int, int> element;
+
+            if (queue.TryPop(element))
+            {
+                ordered = ordered && (element.second == nextIndexes[static_cast<std::size_t>(element.first)]);
+                ++nextIndexes[static_cast<std::size_t>(element.first)];
+                ++received;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (std::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        // Assert
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(queue.GetApproximateSize(), 0);
+    }
+
+    // #endregion
+} // Anonymous namespace
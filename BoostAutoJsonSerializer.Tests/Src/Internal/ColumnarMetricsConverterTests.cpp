@@ -0,0 +1,155 @@
+/*************************************************************************************************
+ * @file ColumnarMetricsConverterTests.cpp
+ *
+ * @brief Contains unit tests for class @ref ColumnarMetricsConverter.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/ColumnarMetricsConverter.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Create rows mixing dense, sparse and mixed type keys.
+     */
+    std::vector<TestDataMetrics> CreateRows()
+    {
+        std::vector<TestDataMetrics> rows(4);
+
+        for (std::size_t index = 0; index < rows.size(); ++index)
+        {
+            rows[index].MetricData["Latency"] = SerializationValue{static_cast<uint32_t>(10 * index)};
+            rows[index].MetricData["Ok"] = SerializationValue{0 != index % 2};
+        }
+
+        rows[1].MetricData["Error"] = SerializationValue{std::string("time \"out\"")};
+        rows[3].MetricData["Error"] = SerializationValue{std::string("refused")};
+
+        rows[0].MetricData["Value"] = SerializationValue{0.5f};
+        rows[2].MetricData["Value"] = SerializationValue{int64_t(-3)};
+        rows[3].MetricData["Value"] = SerializationValue{EnumName{"High"}};
+
+        return rows;
+    }
+
+    /**
+     * @brief Compare rows of metrics, the types of the values included.
+     */
+    void ExpectEqualRows(const std::vector<TestDataMetrics>& actual, const std::vector<TestDataMetrics>& expected)
+    {
+        ASSERT_EQ(actual.size(), expected.size());
+
+        for (std::size_t index = 0; index < actual.size(); ++index)
+        {
+            ASSERT_EQ(actual[index].MetricData.size(), expected[index].MetricData.size()) << "row " << index;
+
+            for (const auto& [key, value] : expected[index].MetricData)
+            {
+                ASSERT_EQ(actual[index].MetricData.count(key), 1) << "row " << index << ", key " << key;
+                EXPECT_EQ(actual[index].MetricData.at(key).data, value.data) << "row " << index << ", key " << key;
+            }
+        }
+    }
+
+    // #region Unit Tests
+
+    TEST(ColumnarMetricsConverterTests, ToColumnsSuccessful)
+    {
+        // Act
+        const ColumnarMetrics columns = ColumnarMetricsConverter::ToColumns(CreateRows());
+
+        // Assert
+        EXPECT_EQ(columns.RowCount, 4);
+        EXPECT_EQ(columns.Keys, (std::vector<std::string>{"Error", "Latency", "Ok", "Value"}));
+        ASSERT_EQ(columns.Columns.size(), 4);
+
+        // Sparse column of a single type.
+        EXPECT_EQ(columns.Columns[0].Present, (std::vector<bool>{false, true, false, true}));
+        EXPECT_EQ(bv2::get<std::vector<std::string>>(columns.Columns[0].Values),
+                  (std::vector<std::string>{"time \"out\"", "refused"}));
+
+        // Dense typed columns.
+        EXPECT_TRUE(columns.Columns[1].Present.empty());
+        EXPECT_EQ(bv2::get<std::vector<uint32_t>>(columns.Columns[1].Values), (std::vector<uint32_t>{0, 10, 20, 30}));
+        EXPECT_EQ(bv2::get<std::vector<bool>>(columns.Columns[2].Values), (std::vector<bool>{false, true, false, true}));
+
+        // Values of several types.
+        EXPECT_EQ(columns.Columns[3].Present, (std::vector<bool>{true, false, true, true}));
+        EXPECT_EQ(bv2::get<std::vector<SerializationValue>>(columns.Columns[3].Values).size(), 3);
+    }
+
+    TEST(ColumnarMetricsConverterTests, RoundTripSuccessful)
+    {
+        // Arrange
+        const std::vector<TestDataMetrics> rows = CreateRows();
+
+        // Act
+        const std::vector<TestDataMetrics> convertedRows =
+            ColumnarMetricsConverter::ToRows(ColumnarMetricsConverter::ToColumns(rows));
+
+        // Assert
+        ExpectEqualRows(convertedRows, rows);
+    }
+
+    TEST(ColumnarMetricsConverterTests, RoundTripEmptySuccessful)
+    {
+        // Arrange, rows without any metric are kept as such.
+        const std::vector<TestDataMetrics> rows(3);
+
+        // Act
+        const ColumnarMetrics columns = ColumnarMetricsConverter::ToColumns(rows);
+
+        // Assert
+        EXPECT_EQ(columns.RowCount, 3);
+        EXPECT_TRUE(columns.Keys.empty());
+        ExpectEqualRows(ColumnarMetricsConverter::ToRows(columns), rows);
+        EXPECT_EQ(ColumnarMetricsConverter::Write(columns), R"({"keys":[],"columns":[]})");
+    }
+
+    TEST(ColumnarMetricsConverterTests, WriteSuccessful)
+    {
+        // Act
+        const std::string output = ColumnarMetricsConverter::Write(ColumnarMetricsConverter::ToColumns(CreateRows()));
+
+        // Assert
+        EXPECT_EQ(output, R"({"keys":["Error","Latency","Ok","Value"],"columns":[)"
+                          R"([null,"time \"out\"",null,"refused"],)"
+                          R"([0,10,20,30],)"
+                          R"([false,true,false,true],)"
+                          R"([5E-1,null,-3,"High"]]})");
+    }
+
+    TEST(ColumnarMetricsConverterTests, InvalidColumnsFailure)
+    {
+        // Arrange
+        ColumnarMetrics missingColumn = ColumnarMetricsConverter::ToColumns(CreateRows());
+        missingColumn.Columns.pop_back();
+
+        ColumnarMetrics shortColumn = ColumnarMetricsConverter::ToColumns(CreateRows());
+        bv2::get<std::vector<uint32_t>>(shortColumn.Columns[1].Values).pop_back();
+
+        ColumnarMetrics shortPresence = ColumnarMetricsConverter::ToColumns(CreateRows());
+        shortPresence.Columns[0].Present.pop_back();
+
+        // Act -> Assert
+        EXPECT_THROW(ColumnarMetricsConverter::ToRows(missingColumn), XInvalidArgument);
+        EXPECT_THROW(ColumnarMetricsConverter::ToRows(shortColumn), XInvalidArgument);
+        EXPECT_THROW(ColumnarMetricsConverter::ToRows(shortPresence), XInvalidArgument);
+        EXPECT_THROW(ColumnarMetricsConverter::Write(shortColumn), XInvalidArgument);
+    }
+
+    // #endregion
+} // Anonymous namespace
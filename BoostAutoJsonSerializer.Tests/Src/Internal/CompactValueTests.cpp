@@ -0,0 +1,343 @@
+/*************************************************************************************************
+ * @file CompactValueTests.cpp
+ *
+ * @brief Contains unit tests for class @ref CompactValue.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <chrono>
+#include <limits>
+
+#include "Internal/CompactValue.hpp"
+#include "Internal/JsonValueWriter.hpp"
+#include "Internal/SerializedSizeCalculator.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Heap bytes of a string, beyond the small buffer of the standard library.
+     */
+    std::size_t GetOutOfLineBytes(const std::string& text)
+    {
+        return (text.capacity() > std::string().capacity()) ? text.capacity() + 1 : 0;
+    }
+
+    std::size_t GetOutOfLineBytes(const SerializationValue& value)
+    {
+        const std::string* text = bv2::get_if<std::string>(&value.data);
+
+        return (nullptr != text) ? GetOutOfLineBytes(*text) : 0;
+    }
+
+    std::size_t GetOutOfLineBytes(const CompactValue& value)
+    {
+        return value.GetOutOfLineBytes();
+    }
+
+    /**
+     * @brief Memory held by rows of metrics: the map nodes, their rebalancing header included, and the strings.
+     */
+    template <typename TValue>
+    std::size_t GetFootprint(const std::vector<std::map<std::string, TValue>>& rows)
+    {
+        constexpr std::size_t nodeHeaderSize = 4 * sizeof(void*);
+
+        std::size_t footprint = rows.capacity() * sizeof(std::map<std::string, TValue>);
+
+        for (const std::map<std::string, TValue>& row : rows)
+        {
+            for (const auto& [key, value] : row)
+            {
+                footprint += nodeHeaderSize + sizeof(std::pair<const std::string, TValue>) + GetOutOfLineBytes(key) +
+                             GetOutOfLineBytes(value);
+            }
+        }
+
+        return footprint;
+    }
+
+    /**
+     * @brief Create rows of metrics the way the monitors produce them, mostly numbers and short strings.
+     */
+    std::vector<std::map<std::string, SerializationValue>> CreateRows(std::size_t rowCount)
+    {
+        std::vector<std::map<std::string, SerializationValue>> rows(rowCount);
+
+        for (std::size_t index = 0; index < rowCount; ++index)
+        {
+            std::map<std::string, SerializationValue>& row = rows[index];
+            row["Latency"] = SerializationValue{static_cast<uint32_t>(index % 1000)};
+            row["Cpu"] = SerializationValue{static_cast<float>(index % 100) / 4};
+            row["Delta"] = SerializationValue{-static_cast<int64_t>(index)};
+            row["Ok"] = SerializationValue{0 != index % 7};
+            row["Status"] = SerializationValue{std::string("Completed")};
+
+            if (0 == index % 10)
+            {
+                row["Url"] = SerializationValue{"https://example.com/resource/" + std::to_string(index)};
+            }
+        }
+
+        return rows;
+    }
+
+    std::vector<std::map<std::string, CompactValue>> ToCompactRows(
+        const std::vector<std::map<std::string, SerializationValue>>& rows)
+    {
+        std::vector<std::map<std::string, CompactValue>> compactRows(rows.size());
+
+        for (std::size_t index = 0; index < rows.size(); ++index)
+        {
+            for (const auto& [key, value] : rows[index])
+            {
+                compactRows[index].emplace_hint(compactRows[index].end(), key, CompactValue(value));
+            }
+        }
+
+        return compactRows;
+    }
+
+    /**
+     * @brief Serialize rows the way the serializer does, through a json value and the writer.
+     */
+    template <typename TValue>
+    std::string Serialize(const std::vector<std::map<std::string, TValue>>& rows)
+    {
+        bj::monotonic_resource resource;
+        const bj::value value = bj::value_from(rows, bj::storage_ptr(&resource));
+
+        std::string output;
+        output.reserve(SerializedSizeCalculator::Calculate(rows));
+        JsonValueWriter::Write(value, output);
+
+        return output;
+    }
+
+    // #region Unit Tests
+
+    TEST(CompactValueTests, ScalarsSuccessful)
+    {
+        // Act -> Assert
+        EXPECT_EQ(sizeof(CompactValue), 16);
+
+        EXPECT_EQ(CompactValue(true).Get<bool>(), true);
+        EXPECT_EQ(CompactValue(1.5f).Get<float>(), 1.5f);
+        EXPECT_EQ(CompactValue(-2.25).Get<double>(), -2.25);
+        EXPECT_EQ(CompactValue(int8_t(-8)).Get<int8_t>(), -8);
+        EXPECT_EQ(CompactValue(int16_t(-16)).Get<int16_t>(), -16);
+        EXPECT_EQ(CompactValue(-32).Get<int32_t>(), -32);
+        EXPECT_EQ(CompactValue(std::numeric_limits<int64_t>::min()).Get<int64_t>(), std::numeric_limits<int64_t>::min());
+        EXPECT_EQ(CompactValue(uint8_t(8)).Get<uint8_t>(), 8);
+        EXPECT_EQ(CompactValue(uint16_t(16)).Get<uint16_t>(), 16);
+        EXPECT_EQ(CompactValue(uint32_t(32)).Get<uint32_t>(), 32);
+        EXPECT_EQ(CompactValue(std::numeric_limits<uint64_t>::max()).Get<uint64_t>(),
+                  std::numeric_limits<uint64_t>::max());
+
+        EXPECT_EQ(CompactValue(uint32_t(32)).GetKind(), CompactValue::Kind::UInt32);
+        EXPECT_EQ(CompactValue().GetKind(), CompactValue::Kind::String);
+        EXPECT_TRUE(CompactValue().GetString().empty());
+    }
+
+    TEST(CompactValueTests, StringsSuccessful)
+    {
+        // Arrange
+        const std::string shortText(CompactValue::MaxInlineStringLength, 's');
+        const std::string longText(CompactValue::MaxInlineStringLength + 1, 'l');
+
+        // Act
+        const CompactValue shortValue(shortText);
+        const CompactValue longValue(longText);
+        const CompactValue enumValue(EnumName{"Enumerator"});
+
+        // Assert, only the long string is out of the value.
+        EXPECT_EQ(shortValue.GetString(), shortText);
+        EXPECT_EQ(shortValue.GetOutOfLineBytes(), 0);
+        EXPECT_EQ(longValue.GetString(), longText);
+        EXPECT_EQ(longValue.GetOutOfLineBytes(), longText.size());
+        EXPECT_EQ(enumValue.GetKind(), CompactValue::Kind::EnumName);
+        EXPECT_EQ(enumValue.GetString(), "Enumerator");
+        EXPECT_EQ(enumValue.GetOutOfLineBytes(), 0);
+        EXPECT_EQ(CompactValue("literal").GetString(), "literal");
+    }
+
+    TEST(CompactValueTests, CopyAndMoveSuccessful)
+    {
+        // Arrange
+        const std::string longText = "a string too long to be stored inline";
+        CompactValue original(longText);
+
+        // Act
+        CompactValue copy(original);
+        CompactValue assigned(1);
+        assigned = original;
+        CompactValue moved(std::move(copy));
+        CompactValue moveAssigned(1.0);
+        moveAssigned = std::move(assigned);
+        original = CompactValue(int64_t(7));
+
+        // Assert, every copy owns its own text.
+        EXPECT_EQ(moved.GetString(), longText);
+        EXPECT_EQ(moveAssigned.GetString(), longText);
+        EXPECT_NE(moved.GetString().data(), moveAssigned.GetString().data());
+        EXPECT_EQ(original.Get<int64_t>(), 7);
+
+        moved = moved;
+        EXPECT_EQ(moved.GetString(), longText);
+    }
+
+    TEST(CompactValueTests, EqualitySuccessful)
+    {
+        // Act -> Assert, the types are compared like the variant alternatives are.
+        EXPECT_EQ(CompactValue("text"), CompactValue(std::string("text")));
+        EXPECT_EQ(CompactValue(std::string(40, 'x')), CompactValue(std::string(40, 'x')));
+        EXPECT_NE(CompactValue("text"), CompactValue(EnumName{"text"}));
+        EXPECT_NE(CompactValue(1), CompactValue(int64_t(1)));
+        EXPECT_NE(CompactValue(1), CompactValue(2));
+        EXPECT_EQ(CompactValue(0.5f), CompactValue(0.5f));
+    }
+
+    TEST(CompactValueTests, WrapperConversionsSuccessful)
+    {
+        // Arrange
+        const std::vector<SerializationValue> serializationValues = {
+            SerializationValue{std::string("a long enough string value")}, SerializationValue{false},
+            SerializationValue{2.5f}, SerializationValue{int16_t(-3)}, SerializationValue{uint64_t(4)},
+            SerializationValue{EnumName{"Name"}}};
+
+        const std::vector<DeserializationValue> deserializationValues = {
+            DeserializationValue{std::string("text")}, DeserializationValue{int64_t(-1)},
+            DeserializationValue{uint64_t(1)}, DeserializationValue{0.25}, DeserializationValue{true}};
+
+        // Act -> Assert, the conversions back are lossless.
+        for (const SerializationValue& value : serializationValues)
+        {
+            EXPECT_EQ(CompactValue(value).ToSerializationValue().data, value.data);
+        }
+
+        for (const DeserializationValue& value : deserializationValues)
+        {
+            EXPECT_EQ(CompactValue(value).ToDeserializationValue().data, value.data);
+        }
+
+        // The narrower types are widened into the deserialization wrapper.
+        EXPECT_EQ(CompactValue(int8_t(-5)).ToDeserializationValue().data, DeserializationVariant(int64_t(-5)));
+        EXPECT_EQ(CompactValue(EnumName{"Name"}).ToDeserializationValue().data, DeserializationVariant(std::string("Name")));
+        EXPECT_EQ(CompactValue(0.5).ToSerializationValue().data, SerializationVariant(0.5f));
+    }
+
+    TEST(CompactValueTests, InvalidAccessFailure)
+    {
+        // Act -> Assert
+        EXPECT_THROW(CompactValue(1).Get<int64_t>(), XInvalidArgument);
+        EXPECT_THROW(CompactValue("text").Get<bool>(), XInvalidArgument);
+        EXPECT_THROW(CompactValue(1.0).GetString(), XInvalidArgument);
+    }
+
+    TEST(CompactValueTests, JsonConversionsSuccessful)
+    {
+        // Arrange
+        const bj::value document = bj::parse(R"({"s": "a string longer than fourteen bytes", "i": -1,
+                                                 "u": 18446744073709551615, "d": 0.5, "b": true})");
+
+        // Act
+        const std::map<std::string, CompactValue> values =
+            bj::value_to<std::map<std::string, CompactValue>>(document);
+
+        // Assert
+        EXPECT_EQ(values.at("s"), CompactValue("a string longer than fourteen bytes"));
+        EXPECT_EQ(values.at("i"), CompactValue(int64_t(-1)));
+        EXPECT_EQ(values.at("u"), CompactValue(std::numeric_limits<uint64_t>::max()));
+        EXPECT_EQ(values.at("d"), CompactValue(0.5));
+        EXPECT_EQ(values.at("b"), CompactValue(true));
+        EXPECT_EQ(bj::value_from(values), document);
+
+        EXPECT_THROW(bj::value_to<CompactValue>(bj::value(nullptr)), XSerialization);
+        EXPECT_THROW(bj::value_to<CompactValue>(bj::parse("[1]")), XSerialization);
+    }
+
+    TEST(CompactValueTests, SerializeLikeWrapperSuccessful)
+    {
+        // Arrange
+        std::vector<std::map<std::string, SerializationValue>> rows = CreateRows(100);
+        rows.front().at("Status") = SerializationValue{EnumName{"Enumerated"}};
+        const std::vector<std::map<std::string, CompactValue>> compactRows = ToCompactRows(rows);
+
+        // Act
+        const std::string output = Serialize(rows);
+        const std::string compactOutput = Serialize(compactRows);
+
+        // Assert, the values are written, and sized, byte for byte the same.
+        EXPECT_EQ(compactOutput, output);
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(compactRows), compactOutput.size());
+    }
+
+    TEST(CompactValueTests, FootprintSmallerSuccessful)
+    {
+        // Arrange
+        const std::vector<std::map<std::string, SerializationValue>> rows = CreateRows(1000);
+
+        // Act
+        const std::size_t footprint = GetFootprint(rows);
+        const std::size_t compactFootprint = GetFootprint(ToCompactRows(rows));
+
+        // Assert
+        EXPECT_LT(sizeof(CompactValue), sizeof(SerializationValue));
+        EXPECT_LT(compactFootprint, footprint);
+    }
+
+    /**
+     * @brief Footprint and serialization speed of a large tree, run with --gtest_also_run_disabled_tests.
+     */
+    TEST(CompactValueTests, DISABLED_LargeTreeBenchmark)
+    {
+        // Arrange
+        constexpr std::size_t rowCount = 500000;
+        constexpr int repetitions = 5;
+
+        const std::vector<std::map<std::string, SerializationValue>> rows = CreateRows(rowCount);
+        const std::vector<std::map<std::string, CompactValue>> compactRows = ToCompactRows(rows);
+
+        const auto measure = [&](const auto& measuredRows)
+        {
+            std::size_t bytes = 0;
+            const auto start = std::chrono::steady_clock::now();
+
+            for (int repetition = 0; repetition < repetitions; ++repetition)
+            {
+                bytes += Serialize(measuredRows).size();
+            }
+
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            return static_cast<double>(bytes) / elapsed.count() / (1024 * 1024);
+        };
+
+        // Act
+        const double throughput = measure(rows);
+        const double compactThroughput = measure(compactRows);
+
+        // Assert
+        std::cout << "Footprint: SerializationValue " << GetFootprint(rows) / 1024 << " KiB, CompactValue "
+                  << GetFootprint(compactRows) / 1024 << " KiB" << std::endl
+                  << "Serialize: SerializationValue " << throughput << " MiB/s, CompactValue " << compactThroughput
+                  << " MiB/s" << std::endl;
+
+        EXPECT_LT(GetFootprint(compactRows), GetFootprint(rows));
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,289 @@
+/*************************************************************************************************
+ * @file CompressingChunkSinkTests.cpp
+ *
+ * @brief Contains unit tests for class @ref CompressingChunkSink.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <zlib.h>
+
+#include "Internal/CompressingChunkSink.hpp"
+#include "Internal/ThreadPool.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Keeps the compressed output written into it.
+     */
+    class OutputCollector : public IChunkSink
+    {
+    public:
+        void Write(std::string_view chunk) override
+        {
+            Output.append(chunk);
+            ++WriteCount;
+        }
+
+        void Finish() override
+        {
+            ++FinishCount;
+        }
+
+        std::string Output;
+
+        int WriteCount = 0;
+
+        int FinishCount = 0;
+    };
+
+    /**
+     * @brief Decompress a gzip stream made of one or more members.
+     *
+     * @param[in] compressed The gzip stream.
+     * @param[out] memberCount Number of members of the stream.
+     *
+     * @return The decompressed bytes.
+     */
+    std::string Gunzip(const std::string& compressed, int& memberCount)
+    {
+        std::string output;
+        z_stream stream = {};
+        memberCount = 0;
+
+        EXPECT_EQ(inflateInit2(&stream, MAX_WBITS + 16), Z_OK);
+
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+        stream.avail_in = static_cast<uInt>(compressed.size());
+
+        while (true)
+        {
+            char buffer[4096];
+            stream.next_out = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+
+            const int result = inflate(&stream, Z_NO_FLUSH);
+            output.append(buffer, sizeof(buffer) - stream.avail_out);
+
+            if (Z_STREAM_END == result)
+            {
+                ++memberCount;
+
+                if (0 == stream.avail_in)
+                {
+                    break;
+                }
+
+                inflateReset(&stream);
+            }
+            else if (Z_OK != result)
+            {
+                ADD_FAILURE() << "Invalid gzip stream: " << result;
+                break;
+            }
+        }
+
+        inflateEnd(&stream);
+
+        return output;
+    }
+
+    /**
+     * @brief Create a large and repetitive json document.
+     */
+    std::string CreateDocument()
+    {
+        std::string document = "[";
+
+        for (int index = 0; index < 50000; ++index)
+        {
+            document += "{\"key\":" + std::to_string(index % 97) + ",\"name\":\"metric\"},";
+        }
+
+        document.back() = ']';
+
+        return document;
+    }
+
+    /**
+     * @brief Write a document into a sink in chunks of an odd size, then finish the sink.
+     */
+    void WriteDocument(CompressingChunkSink& sink, const std::string& document)
+    {
+        const std::string_view text(document);
+
+        for (std::size_t offset = 0; offset < text.size(); offset += 7777)
+        {
+            sink.Write(text.substr(offset, 7777));
+        }
+
+        sink.Finish();
+    }
+
+    // #region Unit Tests
+
+    TEST(CompressingChunkSinkTests, StreamingSuccessful)
+    {
+        // Arrange
+        const std::string document = CreateDocument();
+        std::shared_ptr<OutputCollector> output = std::make_shared<OutputCollector>();
+        CompressingChunkSink sink(output);
+
+        // Act
+        WriteDocument(sink, document);
+
+        // Assert
+        int memberCount = 0;
+
+        EXPECT_EQ(Gunzip(output->Output, memberCount), document);
+        EXPECT_EQ(memberCount, 1);
+        EXPECT_EQ(output->FinishCount, 1);
+        EXPECT_LT(output->Output.size(), document.size() / 10);
+    }
+
+    TEST(CompressingChunkSinkTests, BlocksSuccessful)
+    {
+        // Arrange
+        const std::string document = CreateDocument();
+        std::shared_ptr<OutputCollector> output = std::make_shared<OutputCollector>();
+
+        CompressionOptions options;
+        options.BlockSize = 100000;
+        options.Level = 9;
+
+        CompressingChunkSink sink(output, options);
+
+        // Act
+        WriteDocument(sink, document);
+
+        // Assert
+        int memberCount = 0;
+
+        EXPECT_EQ(Gunzip(output->Output, memberCount), document);
+        EXPECT_EQ(memberCount, static_cast<int>((document.size() + options.BlockSize - 1) / options.BlockSize));
+        EXPECT_EQ(output->WriteCount, memberCount);
+    }
+
+    TEST(CompressingChunkSinkTests, ParallelBlocksSuccessful)
+    {
+        // Arrange
+        const std::string document = CreateDocument();
+        std::shared_ptr<OutputCollector> output = std::make_shared<OutputCollector>();
+
+        CompressionOptions options;
+        options.BlockSize = 64 * 1024;
+        options.MaxBlocksInFlight = 3;
+
+        CompressingChunkSink sink(output, options, std::make_shared<ThreadPool>(4));
+
+        // Act
+        WriteDocument(sink, document);
+
+        // Assert, the blocks are forwarded in order whatever the order they were compressed in.
+        int memberCount = 0;
+
+        EXPECT_EQ(Gunzip(output->Output, memberCount), document);
+        EXPECT_EQ(memberCount, static_cast<int>((document.size() + options.BlockSize - 1) / options.BlockSize));
+        EXPECT_EQ(output->Output, [&]()
+                  {
+                      std::string expected;
+
+                      for (std::size_t offset = 0; offset < document.size(); offset += options.BlockSize)
+                      {
+                          expected += CompressingChunkSink::Compress(options.Format, options.Level,
+                                                                     std::string_view(document).substr(offset, options.BlockSize));
+                      }
+
+                      return expected;
+                  }());
+    }
+
+    TEST(CompressingChunkSinkTests, EmptySuccessful)
+    {
+        for (std::size_t blockSize : {0, 1024})
+        {
+            // Arrange
+            std::shared_ptr<OutputCollector> output = std::make_shared<OutputCollector>();
+
+            CompressionOptions options;
+            options.BlockSize = blockSize;
+
+            CompressingChunkSink sink(output, options);
+
+            // Act
+            sink.Finish();
+            sink.Finish();
+
+            // Assert, still a valid stream.
+            int memberCount = 0;
+
+            EXPECT_TRUE(Gunzip(output->Output, memberCount).empty());
+            EXPECT_EQ(memberCount, 1);
+            EXPECT_EQ(output->FinishCount, 1);
+        }
+    }
+
+    TEST(CompressingChunkSinkTests, WriteAfterFinishFailure)
+    {
+        // Arrange
+        CompressingChunkSink sink(std::make_shared<OutputCollector>());
+        sink.Finish();
+
+        // Act -> Assert
+        EXPECT_THROW(sink.Write("{}"), XInvalidArgument);
+    }
+
+    TEST(CompressingChunkSinkTests, InvalidArgumentFailure)
+    {
+        // Arrange
+        CompressionOptions invalidLevel;
+        invalidLevel.Level = 10;
+
+        CompressionOptions noBlockInFlight;
+        noBlockInFlight.MaxBlocksInFlight = 0;
+
+        // Act -> Assert
+        EXPECT_THROW(CompressingChunkSink(nullptr), XArgumentNull);
+        EXPECT_THROW(CompressingChunkSink(std::make_shared<OutputCollector>(), invalidLevel), XInvalidArgument);
+        EXPECT_THROW(CompressingChunkSink(std::make_shared<OutputCollector>(), noBlockInFlight), XInvalidArgument);
+    }
+
+    TEST(CompressingChunkSinkTests, ZstdAvailability)
+    {
+        // Arrange
+        CompressionOptions options;
+        options.Format = CompressionFormat::Zstd;
+
+        // Act -> Assert
+        if (CompressingChunkSink::IsAvailable(CompressionFormat::Zstd))
+        {
+            std::shared_ptr<OutputCollector> output = std::make_shared<OutputCollector>();
+            CompressingChunkSink sink(output, options);
+            WriteDocument(sink, CreateDocument());
+
+            // The magic number of the zstd frames.
+            ASSERT_GE(output->Output.size(), 4);
+            EXPECT_EQ(output->Output.substr(0, 4), std::string("\x28\xB5\x2F\xFD", 4));
+        }
+        else
+        {
+            EXPECT_THROW(CompressingChunkSink(std::make_shared<OutputCollector>(), options), XInvalidArgument);
+        }
+
+        EXPECT_TRUE(CompressingChunkSink::IsAvailable(CompressionFormat::Gzip));
+    }
+
+    // #endregion
+} // Anonymous namespace
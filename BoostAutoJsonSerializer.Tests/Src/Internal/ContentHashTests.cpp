@@ -0,0 +1,71 @@
+/*************************************************************************************************
+ * @file ContentHashTests.cpp
+ *
+ * @brief Contains unit tests for class @ref ContentHash.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/ContentHash.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    // #region Unit Tests
+
+    TEST(ContentHashTests, ComputeDeterministicSuccessful)
+    {
+        // Arrange
+        const std::string payload = R"({"Capabilities": {"key": 1}, "Settings": {"other": "value"}})";
+
+        // Act -> Assert
+        EXPECT_EQ(ContentHash::Compute(payload), ContentHash::Compute(std::string(payload)));
+    }
+
+    TEST(ContentHashTests, ComputeDistinctSuccessful)
+    {
+        // Arrange
+        std::set<std::pair<uint64_t, uint64_t>> digests;
+        std::string payload;
+
+        // Act: every prefix, so that all the tail lengths and the zero padding are covered.
+        for (std::size_t size = 0; size < 100; ++size)
+        {
+            const ContentDigest digest = ContentHash::Compute(payload);
+            digests.emplace(digest.Low, digest.High);
+
+            payload.push_back('\0');
+        }
+
+        // Assert
+        EXPECT_EQ(digests.size(), 100);
+    }
+
+    TEST(ContentHashTests, ComputeSingleBitFlipSuccessful)
+    {
+        // Arrange
+        const std::string payload(64, 'a');
+        const ContentDigest original = ContentHash::Compute(payload);
+
+        for (std::size_t index = 0; index < payload.size(); ++index)
+        {
+            std::string flipped = payload;
+            flipped[index] = 'c';
+
+            // Act
+            const ContentDigest digest = ContentHash::Compute(flipped);
+
+            // Assert: both halves change, whichever lane read the byte.
+            EXPECT_NE(digest.Low, original.Low);
+            EXPECT_NE(digest.High, original.High);
+        }
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,88 @@
+/*************************************************************************************************
+ * @file CountingMemoryResourceTests.cpp
+ *
+ * @brief Contains unit tests for class @ref CountingMemoryResource.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/CountingMemoryResource.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    // #region Unit Tests
+
+    TEST(CountingMemoryResourceTests, AllocateDeallocateSuccessful)
+    {
+        // Arrange
+        CountingMemoryResource resource;
+
+        // Act
+        void* first = resource.allocate(100, 8);
+        void* second = resource.allocate(50, 8);
+        resource.deallocate(first, 100, 8);
+        void* third = resource.allocate(20, 8);
+        resource.deallocate(second, 50, 8);
+        resource.deallocate(third, 20, 8);
+
+        AllocationStatistics statistics = resource.GetStatistics();
+
+        // Assert
+        EXPECT_EQ(statistics.Allocations, 3);
+        EXPECT_EQ(statistics.Deallocations, 3);
+        EXPECT_EQ(statistics.AllocatedBytes, 170);
+        EXPECT_EQ(statistics.PeakBytes, 150);
+    }
+
+    TEST(CountingMemoryResourceTests, ResetSuccessful)
+    {
+        // Arrange
+        CountingMemoryResource resource;
+        void* retained = resource.allocate(64, 8);
+
+        // Act
+        resource.Reset();
+        void* allocated = resource.allocate(16, 8);
+        resource.deallocate(allocated, 16, 8);
+
+        AllocationStatistics statistics = resource.GetStatistics();
+
+        // Assert
+        EXPECT_EQ(statistics.Allocations, 1);
+        EXPECT_EQ(statistics.Deallocations, 1);
+        EXPECT_EQ(statistics.AllocatedBytes, 16);
+        EXPECT_EQ(statistics.PeakBytes, 80);
+
+        resource.deallocate(retained, 64, 8);
+    }
+
+    TEST(CountingMemoryResourceTests, JsonValueStorageSuccessful)
+    {
+        // Arrange
+        CountingMemoryResource resource;
+
+        // Act
+        {
+            bj::value value = bj::parse(R"({"key": ["a string longer than the inline buffer", 1, 2, 3]})",
+                                        bj::storage_ptr(&resource));
+        }
+
+        AllocationStatistics statistics = resource.GetStatistics();
+
+        // Assert
+        EXPECT_GT(statistics.Allocations, 0);
+        EXPECT_EQ(statistics.Allocations, statistics.Deallocations);
+        EXPECT_GT(statistics.PeakBytes, 0);
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,137 @@
+/*************************************************************************************************
+ * @file DescribedEnumTests.cpp
+ *
+ * @brief Contains unit tests for class @ref DescribedEnum.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/DescribedEnum.hpp"
+#include "Internal/JsonValueWriter.hpp"
+#include "Internal/SerializedSizeCalculator.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    BOOST_AUTO_JSON_SERIALIZER_USE_CONVERSIONS();
+
+    // #region Described Enums
+
+    /**
+     * @brief The enumerators are neither declared in value nor in name order on purpose.
+     */
+    enum class MonitorStatus : int8_t
+    {
+        Running = 3,
+        Failed = -1,
+        Completed = 7,
+        Aborted = 0
+    };
+
+    BOOST_DESCRIBE_ENUM(MonitorStatus, Running, Failed, Completed, Aborted)
+
+    struct StatusReport
+    {
+        MonitorStatus Status;
+        std::string Monitor;
+    };
+
+    BOOST_DESCRIBE_STRUCT(StatusReport, (), (Status, Monitor))
+
+    // #endregion
+
+    // #region Unit Tests
+
+    TEST(DescribedEnumTests, ToStringSuccessful)
+    {
+        // The names are resolved at compile time.
+        static_assert(DescribedEnum<MonitorStatus>::ToString(MonitorStatus::Completed) == "Completed");
+
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::ToString(MonitorStatus::Running), "Running");
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::ToString(MonitorStatus::Failed), "Failed");
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::ToString(MonitorStatus::Completed), "Completed");
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::ToString(MonitorStatus::Aborted), "Aborted");
+        EXPECT_TRUE(DescribedEnum<MonitorStatus>::ToString(static_cast<MonitorStatus>(5)).empty());
+    }
+
+    TEST(DescribedEnumTests, ParseSuccessful)
+    {
+        MonitorStatus status = MonitorStatus::Running;
+
+        EXPECT_TRUE(DescribedEnum<MonitorStatus>::TryParse("Aborted", status));
+        EXPECT_EQ(status, MonitorStatus::Aborted);
+
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::Parse("Running"), MonitorStatus::Running);
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::Parse("Failed"), MonitorStatus::Failed);
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::Parse("Completed"), MonitorStatus::Completed);
+    }
+
+    TEST(DescribedEnumTests, ParseUnknownNameFailure)
+    {
+        MonitorStatus status = MonitorStatus::Running;
+
+        EXPECT_FALSE(DescribedEnum<MonitorStatus>::TryParse("running", status));
+        EXPECT_FALSE(DescribedEnum<MonitorStatus>::TryParse("", status));
+        EXPECT_FALSE(DescribedEnum<MonitorStatus>::TryParse("Zombie", status));
+        EXPECT_EQ(status, MonitorStatus::Running);
+
+        EXPECT_THROW(DescribedEnum<MonitorStatus>::Parse("Abort"), XSerialization);
+    }
+
+    TEST(DescribedEnumTests, ToValueSerializeSuccessful)
+    {
+        // Arrange
+        TestDataStepResults stepResults;
+        stepResults.OtherData["Status"] = DescribedEnum<MonitorStatus>::ToValue(MonitorStatus::Failed);
+
+        // Act
+        const std::string payload = JsonValueWriter::Write(bj::value_from(stepResults));
+
+        // Assert
+        EXPECT_NE(payload.find(R"("Status":"Failed")"), std::string::npos);
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(stepResults), payload.size());
+        EXPECT_THROW(DescribedEnum<MonitorStatus>::ToValue(static_cast<MonitorStatus>(5)), XSerialization);
+    }
+
+    TEST(DescribedEnumTests, FromValueSuccessful)
+    {
+        EXPECT_EQ(DescribedEnum<MonitorStatus>::FromValue(DeserializationValue{std::string("Completed")}),
+                  MonitorStatus::Completed);
+        EXPECT_THROW(DescribedEnum<MonitorStatus>::FromValue(DeserializationValue{std::string("Done")}),
+                     XSerialization);
+        EXPECT_THROW(DescribedEnum<MonitorStatus>::FromValue(DeserializationValue{int64_t{3}}), XSerialization);
+    }
+
+    TEST(DescribedEnumTests, DescribedStructRoundTripSuccessful)
+    {
+        // Arrange
+        const StatusReport report{MonitorStatus::Aborted, "monitor-1"};
+
+        // Act
+        const bj::value value = bj::value_from(report);
+        const StatusReport parsed = bj::value_to<StatusReport>(value);
+
+        // Assert
+        EXPECT_EQ(JsonValueWriter::Write(value), R"({"Status":"Aborted","Monitor":"monitor-1"})");
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(report), JsonValueWriter::Write(value).size());
+        EXPECT_EQ(parsed.Status, MonitorStatus::Aborted);
+        EXPECT_EQ(parsed.Monitor, "monitor-1");
+
+        EXPECT_THROW(bj::value_to<StatusReport>(bj::parse(R"({"Status":"Lost","Monitor":""})")), XSerialization);
+        EXPECT_THROW(bj::value_to<StatusReport>(bj::parse(R"({"Status":3,"Monitor":""})")), XSerialization);
+    }
+
+    // #endregion
+} // Anonymous namespace
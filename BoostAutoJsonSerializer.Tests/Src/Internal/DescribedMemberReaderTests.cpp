@@ -0,0 +1,125 @@
+/*************************************************************************************************
+ * @file DescribedMemberReaderTests.cpp
+ *
+ * @brief Contains unit tests for class @ref DescribedMemberReader.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/DescribedMemberReader.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    // #region Described Structs
+
+    struct Triple
+    {
+        int64_t First = -1;
+        int64_t Second = -1;
+        int64_t Third = -1;
+    };
+
+    BOOST_DESCRIBE_STRUCT(Triple, (), (First, Second, Third))
+
+    // #endregion
+
+    /**
+     * @brief Read a document into a triple.
+     */
+    Triple Read(const char* payload, const MemberMatchingOptions& options = {}, MemberMatchingReport* report = nullptr)
+    {
+        const bj::value value = bj::parse(payload);
+
+        Triple triple;
+        DescribedMemberReader::Read(value.as_object(), triple, [](const bj::value& member, int64_t& field)
+                                    { field = member.as_int64(); },
+                                    options, report);
+
+        return triple;
+    }
+
+    // #region Unit Tests
+
+    TEST(DescribedMemberReaderTests, ReadCanonicalOrderSuccessful)
+    {
+        // Act
+        const Triple triple = Read(R"({"First": 1, "Second": 2, "Third": 3})");
+
+        // Assert
+        EXPECT_EQ(triple.First, 1);
+        EXPECT_EQ(triple.Second, 2);
+        EXPECT_EQ(triple.Third, 3);
+    }
+
+    TEST(DescribedMemberReaderTests, ReadReorderedSuccessful)
+    {
+        // Act
+        const Triple reversed = Read(R"({"Third": 3, "Second": 2, "First": 1})");
+        const Triple rotated = Read(R"({"Second": 2, "Third": 3, "First": 1})");
+
+        // Assert
+        EXPECT_EQ(reversed.First, 1);
+        EXPECT_EQ(reversed.Second, 2);
+        EXPECT_EQ(reversed.Third, 3);
+
+        EXPECT_EQ(rotated.First, 1);
+        EXPECT_EQ(rotated.Second, 2);
+        EXPECT_EQ(rotated.Third, 3);
+    }
+
+    TEST(DescribedMemberReaderTests, MissingKeyPoliciesSuccessful)
+    {
+        // Arrange
+        const char* payload = R"({"First": 1, "Third": 3})";
+        MemberMatchingReport report;
+
+        // Act -> Assert
+        EXPECT_THROW(Read(payload), XSerialization);
+
+        const Triple ignored = Read(payload, {MemberKeyPolicy::Ignore, MemberKeyPolicy::Ignore}, &report);
+        EXPECT_EQ(ignored.First, 1);
+        EXPECT_EQ(ignored.Second, -1);
+        EXPECT_EQ(ignored.Third, 3);
+        EXPECT_TRUE(report.MissingKeys.empty());
+
+        Read(payload, {MemberKeyPolicy::Ignore, MemberKeyPolicy::Collect}, &report);
+        EXPECT_EQ(report.MissingKeys, std::vector<std::string>{"Second"});
+        EXPECT_TRUE(report.UnknownKeys.empty());
+    }
+
+    TEST(DescribedMemberReaderTests, UnknownKeyPoliciesSuccessful)
+    {
+        // Arrange
+        const char* payload = R"({"First": 1, "Extra": true, "Second": 2, "Third": 3, "Other": null})";
+        MemberMatchingReport report;
+
+        // Act -> Assert
+        const Triple ignored = Read(payload);
+        EXPECT_EQ(ignored.Second, 2);
+        EXPECT_EQ(ignored.Third, 3);
+
+        EXPECT_THROW(Read(payload, {MemberKeyPolicy::Error, MemberKeyPolicy::Error}), XSerialization);
+
+        Read(payload, {MemberKeyPolicy::Collect, MemberKeyPolicy::Error}, &report);
+        EXPECT_EQ(report.UnknownKeys, (std::vector<std::string>{"Extra", "Other"}));
+        EXPECT_TRUE(report.MissingKeys.empty());
+
+        // A well-formed document has no unknown member, whatever the policy.
+        EXPECT_NO_THROW(Read(R"({"Third": 3, "First": 1, "Second": 2})", {MemberKeyPolicy::Error, MemberKeyPolicy::Error}));
+    }
+
+    // #endregion
+} // Anonymous namespace
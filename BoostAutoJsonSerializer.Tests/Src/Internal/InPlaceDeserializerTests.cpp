@@ -0,0 +1,192 @@
+/*************************************************************************************************
+ * @file InPlaceDeserializerTests.cpp
+ *
+ * @brief Contains unit tests for class @ref InPlaceDeserializer.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <memory_resource>
+
+#include "Internal/InPlaceDeserializer.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Deserialize a payload into an existing policy.
+     */
+    template <typename TPolicy>
+    void Deserialize(const std::string& payload, TPolicy& testPolicy, InPlaceDeserializer::Scratch& scratch)
+    {
+        InPlaceDeserializer::Deserialize(bj::parse(payload), testPolicy, scratch);
+    }
+
+    // #region Unit Tests
+
+    TEST(InPlaceDeserializerTests, DeserializeMatchesValueToSuccessful)
+    {
+        // Arrange
+        const bj::value value = bj::parse(R"({"Capabilities": {"b": 1, "a": "text", "c": true},
+                                              "Settings": {"d": -1.5, "e": 18446744073709551615}})");
+
+        TestDataTestPolicy testPolicy;
+        InPlaceDeserializer::Scratch scratch;
+
+        // Act
+        InPlaceDeserializer::Deserialize(value, testPolicy, scratch);
+        const TestDataTestPolicy expectedPolicy = bj::value_to<TestDataTestPolicy>(value);
+
+        // Assert
+        ASSERT_EQ(testPolicy.Capabilities.size(), expectedPolicy.Capabilities.size());
+        ASSERT_EQ(testPolicy.Settings.size(), expectedPolicy.Settings.size());
+
+        for (const auto& [key, data] : expectedPolicy.Capabilities)
+        {
+            EXPECT_TRUE(data.data == testPolicy.Capabilities.at(key).data) << key;
+        }
+
+        for (const auto& [key, data] : expectedPolicy.Settings)
+        {
+            EXPECT_TRUE(data.data == testPolicy.Settings.at(key).data) << key;
+        }
+
+        EXPECT_TRUE(scratch.Members.empty());
+        EXPECT_TRUE(scratch.Nodes.empty());
+    }
+
+    TEST(InPlaceDeserializerTests, DeserializeSameShapeReuseSuccessful)
+    {
+        // Arrange
+        const std::string longValue(100, 'x');
+
+        TestDataTestPolicy testPolicy;
+        InPlaceDeserializer::Scratch scratch;
+
+        Deserialize(R"({"Capabilities": {}, "Settings": {"url": ")" + longValue + R"(", "timeout": 1}})", testPolicy,
+                    scratch);
+
+        const DeserializationValue* urlValue = &testPolicy.Settings.at("url");
+        const char* urlBuffer = bv2::get<std::string>(urlValue->data).data();
+
+        // Act, the members come in another order this time.
+        Deserialize(R"({"Settings": {"timeout": 2, "url": ")" + std::string(90, 'y') + R"("}, "Capabilities": {}})",
+                    testPolicy, scratch);
+
+        // Assert, the node and the string buffer are the same.
+        EXPECT_EQ(&testPolicy.Settings.at("url"), urlValue);
+        EXPECT_EQ(bv2::get<std::string>(urlValue->data).data(), urlBuffer);
+        EXPECT_EQ(bv2::get<std::string>(urlValue->data), std::string(90, 'y'));
+        EXPECT_EQ(bv2::get<int64_t>(testPolicy.Settings.at("timeout").data), 2);
+    }
+
+    TEST(InPlaceDeserializerTests, DeserializeChangedShapeSuccessful)
+    {
+        // Arrange
+        TestDataTestPolicy testPolicy;
+        InPlaceDeserializer::Scratch scratch;
+
+        Deserialize(R"({"Capabilities": {"a": 1, "b": 2, "c": 3}, "Settings": {}})", testPolicy, scratch);
+
+        // Act
+        Deserialize(R"({"Capabilities": {"d": "four", "b": true}, "Settings": {"e": 5}})", testPolicy, scratch);
+
+        // Assert
+        ASSERT_EQ(testPolicy.Capabilities.size(), 2);
+        EXPECT_EQ(bv2::get<bool>(testPolicy.Capabilities.at("b").data), true);
+        EXPECT_EQ(bv2::get<std::string>(testPolicy.Capabilities.at("d").data), "four");
+
+        ASSERT_EQ(testPolicy.Settings.size(), 1);
+        EXPECT_EQ(bv2::get<int64_t>(testPolicy.Settings.at("e").data), 5);
+    }
+
+    TEST(InPlaceDeserializerTests, DeserializePmrPolicySuccessful)
+    {
+        // Arrange
+        std::pmr::monotonic_buffer_resource arena;
+        PmrTestDataTestPolicy testPolicy{PmrAllocator(&arena)};
+        InPlaceDeserializer::Scratch scratch;
+
+        Deserialize(R"({"Capabilities": {"a": 1, "b": "two"}, "Settings": {"url": ")" + std::string(100, 'x') + R"("}})",
+                    testPolicy, scratch);
+
+        const PmrDeserializationValue* urlValue = &testPolicy.Settings.begin()->second;
+
+        // Act, the keys of the capabilities change, so their nodes are recycled.
+        Deserialize(R"({"Capabilities": {"c": "a value longer than the small string buffer", "d": false},
+                        "Settings": {"url": ")" + std::string(90, 'y') + R"("}})",
+                    testPolicy, scratch);
+
+        // Assert, the entries and their strings are allocated from the arena.
+        EXPECT_EQ(&testPolicy.Settings.begin()->second, urlValue);
+        EXPECT_EQ(bv2::get<std::pmr::string>(urlValue->data), std::string(90, 'y'));
+        EXPECT_TRUE(scratch.PmrNodes.empty());
+
+        ASSERT_EQ(testPolicy.Capabilities.size(), 2);
+        const auto& [key, value] = *testPolicy.Capabilities.begin();
+        EXPECT_EQ(key, "c");
+        EXPECT_EQ(key.get_allocator().resource(), &arena);
+        EXPECT_EQ(bv2::get<std::pmr::string>(value.data), "a value longer than the small string buffer");
+        EXPECT_EQ(bv2::get<std::pmr::string>(value.data).get_allocator().resource(), &arena);
+        EXPECT_EQ(bv2::get<bool>(std::next(testPolicy.Capabilities.begin())->second.data), false);
+    }
+
+    TEST(InPlaceDeserializerTests, DeserializeFailure)
+    {
+        // Arrange
+        TestDataTestPolicy testPolicy;
+        InPlaceDeserializer::Scratch scratch;
+
+        // Act -> Assert
+        EXPECT_THROW(Deserialize(R"({"Capabilities": {"a": null}, "Settings": {}})", testPolicy, scratch),
+                     XSerialization);
+        EXPECT_THROW(Deserialize(R"({"Capabilities": {"a": [1]}, "Settings": {}})", testPolicy, scratch),
+                     XSerialization);
+        EXPECT_ANY_THROW(Deserialize(R"({"Capabilities": {}})", testPolicy, scratch));
+        EXPECT_ANY_THROW(Deserialize(R"([])", testPolicy, scratch));
+
+        // The scratch is reset by the next call.
+        Deserialize(R"({"Capabilities": {"a": 1}, "Settings": {}})", testPolicy, scratch);
+        EXPECT_EQ(testPolicy.Capabilities.size(), 1);
+    }
+
+    TEST(InPlaceDeserializerTests, DeserializePmrFailureReleasesNodes)
+    {
+        // Arrange, the scratch outlives the resource of the policy.
+        InPlaceDeserializer::Scratch scratch;
+
+        {
+            std::pmr::unsynchronized_pool_resource pool;
+            PmrTestDataTestPolicy testPolicy{PmrAllocator(&pool)};
+
+            Deserialize(R"({"Capabilities": {"a": 1, "b": 2, "c": 3}, "Settings": {}})", testPolicy, scratch);
+
+            // Act, the stale nodes are detached and the second renamed one fails in the middle of the map.
+            EXPECT_THROW(Deserialize(R"({"Capabilities": {"x": 1, "y": null}, "Settings": {}})", testPolicy, scratch),
+                         XSerialization);
+
+            // Assert
+            EXPECT_TRUE(scratch.PmrNodes.empty());
+            EXPECT_TRUE(scratch.Members.empty());
+        }
+
+        // The scratch is reused once the resource is gone.
+        TestDataTestPolicy testPolicy;
+        Deserialize(R"({"Capabilities": {"a": 1}, "Settings": {}})", testPolicy, scratch);
+        EXPECT_EQ(testPolicy.Capabilities.size(), 1);
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,209 @@
+/*************************************************************************************************
+ * @file JsonBulkDeserializerTests.cpp
+ *
+ * @brief Contains unit tests for class @ref JsonBulkDeserializer.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Interfaces/Factories/IObjectFactories.hpp"
+#include "Internal/JsonBulkDeserializer.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+#include "Internal/Mocks/JsonDataSerializerMock.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::FactoryInterfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Test;
+
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+// #region GTest usings
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Fake de-serialization, the payload is kept as the "Document" setting and "bad" payloads fail.
+     *
+     * @param[in] payload A single document.
+     *
+     * @return The fake policy.
+     */
+    TestDataTestPolicy FakeDeserialize(const std::string& payload)
+    {
+        if (std::string::npos != payload.find("bad"))
+        {
+            throw XSerialization("Deserialization -> bad document");
+        }
+
+        TestDataTestPolicy testPolicy;
+        testPolicy.Settings["Document"] = DeserializationValue{payload};
+
+        return testPolicy;
+    }
+
+    /**
+     * @class JsonBulkDeserializerTestsFactory
+     *
+     * @brief Class responsible to instantiate all the required classes.
+     */
+    class JsonBulkDeserializerTestsFactory
+        : public IJsonBulkDeserializerFactory,
+          public IJsonDataSerializerFactory
+    {
+    public:
+        /**
+         * @brief Create concrete instance of IJsonBulkDeserializer.
+         *
+         * @param[out] result An instance of class under test, @ref JsonBulkDeserializer.
+         */
+        void Create(IJsonBulkDeserializerFactory::InterfaceSharedPointer& objectPtr) override
+        {
+            IJsonDataSerializerFactory::InterfaceSharedPointer serializer;
+            Create(serializer);
+
+            objectPtr = std::make_shared<JsonBulkDeserializer>(serializer, std::make_shared<ThreadPool>(4));
+        }
+
+        void Create(IJsonDataSerializerFactory::InterfaceSharedPointer& objectPtr) override
+        {
+            std::shared_ptr<NiceMock<JsonDataSerializerMock>> serializerMock = std::make_shared<NiceMock<JsonDataSerializerMock>>();
+
+            ON_CALL(*serializerMock, Deserialize(_))
+                .WillByDefault(Invoke(FakeDeserialize));
+
+            objectPtr = serializerMock;
+        }
+    };
+
+    /**
+     * @class JsonBulkDeserializerTestFixture
+     *
+     * @brief Test fixture for JsonBulkDeserializer.
+     *
+     * This class provide access to the Factory and additional default to create fakes.
+     */
+    class JsonBulkDeserializerTestFixture : public ::testing::Test
+    {
+    public:
+        /**
+         * @brief Setup the factory. Method overriden from GTest framework class @ref ::testing::Test
+         */
+        void SetUp() override
+        {
+            _instanceFactory = std::make_shared<JsonBulkDeserializerTestsFactory>();
+        }
+
+        std::shared_ptr<JsonBulkDeserializerTestsFactory> GetFactory()
+        {
+            return _instanceFactory;
+        }
+
+    private:
+        std::shared_ptr<JsonBulkDeserializerTestsFactory> _instanceFactory;
+    };
+
+    // #region Unit Tests
+
+    TEST_F(JsonBulkDeserializerTestFixture, SuccessfulInstanceCreation)
+    {
+        std::shared_ptr<IJsonBulkDeserializerFactory> bulkDeserializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonBulkDeserializer> bulkDeserializer;
+        ASSERT_NO_THROW(bulkDeserializerFactory->Create(bulkDeserializer));
+    }
+
+    TEST_F(JsonBulkDeserializerTestFixture, ConstructorInvalidArgumentFailure)
+    {
+        // Arrange -> Act -> Assert
+        ASSERT_THROW(JsonBulkDeserializer(nullptr, std::make_shared<ThreadPool>(1)), XArgumentNull);
+        ASSERT_THROW(JsonBulkDeserializer(std::make_shared<NiceMock<JsonDataSerializerMock>>(), nullptr), XArgumentNull);
+    }
+
+    TEST_F(JsonBulkDeserializerTestFixture, DeserializeAllKeepsStreamOrder)
+    {
+        // Arrange
+        std::string stream;
+        const std::size_t documentCount = 1000;
+
+        for (std::size_t index = 0; index < documentCount; ++index)
+        {
+            stream += "{\"Index\": " + std::to_string(index) + "}\n";
+        }
+
+        std::shared_ptr<IJsonBulkDeserializerFactory> bulkDeserializerFactory = GetFactory();
+        std::shared_ptr<IJsonBulkDeserializer> bulkDeserializer;
+        bulkDeserializerFactory->Create(bulkDeserializer);
+
+        // Act
+        std::vector<TestDataPolicyRecord> records = bulkDeserializer->DeserializeAll(stream, JsonStreamFraming::NewlineDelimited);
+
+        // Assert
+        ASSERT_EQ(records.size(), documentCount);
+
+        for (std::size_t index = 0; index < documentCount; ++index)
+        {
+            ASSERT_TRUE(records[index].IsValid);
+            EXPECT_EQ(records[index].LineNumber, index + 1);
+            EXPECT_EQ(bv2::get<std::string>(records[index].Policy.Settings["Document"].data),
+                      "{\"Index\": " + std::to_string(index) + "}");
+        }
+    }
+
+    TEST_F(JsonBulkDeserializerTestFixture, DeserializeAllReportsBadLines)
+    {
+        // Arrange
+        std::string stream = "{\"Index\": 0}\n"
+                             "{\"bad\": \n"
+                             "\n"
+                             "{\"Index\": 3}\n";
+
+        std::shared_ptr<IJsonBulkDeserializerFactory> bulkDeserializerFactory = GetFactory();
+        std::shared_ptr<IJsonBulkDeserializer> bulkDeserializer;
+        bulkDeserializerFactory->Create(bulkDeserializer);
+
+        // Act
+        std::vector<TestDataPolicyRecord> records = bulkDeserializer->DeserializeAll(stream, JsonStreamFraming::NewlineDelimited);
+
+        // Assert
+        ASSERT_EQ(records.size(), 3);
+
+        EXPECT_TRUE(records[0].IsValid);
+        EXPECT_TRUE(records[0].ErrorMessage.empty());
+
+        EXPECT_FALSE(records[1].IsValid);
+        EXPECT_EQ(records[1].LineNumber, 2);
+        EXPECT_FALSE(records[1].ErrorMessage.empty());
+
+        EXPECT_TRUE(records[2].IsValid);
+        EXPECT_EQ(records[2].LineNumber, 4);
+    }
+
+    TEST_F(JsonBulkDeserializerTestFixture, DeserializeAllEmptyStream)
+    {
+        // Arrange
+        std::shared_ptr<IJsonBulkDeserializerFactory> bulkDeserializerFactory = GetFactory();
+        std::shared_ptr<IJsonBulkDeserializer> bulkDeserializer;
+        bulkDeserializerFactory->Create(bulkDeserializer);
+
+        // Act -> Assert
+        EXPECT_TRUE(bulkDeserializer->DeserializeAll("", JsonStreamFraming::Concatenated).empty());
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,160 @@
+/*************************************************************************************************
+ * @file JsonCodecTests.cpp
+ *
+ * @brief Contains unit tests for class @ref JsonCodec.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/BoostJsonSerializerImpl.hpp"
+#include "Internal/JsonCodec.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+namespace
+{
+    BOOST_AUTO_JSON_SERIALIZER_USE_CONVERSIONS();
+
+    // #region Messages
+
+    struct Heartbeat
+    {
+        std::string MonitorId;
+        uint64_t Sequence;
+        bool Healthy;
+    };
+
+    BOOST_DESCRIBE_STRUCT(Heartbeat, (), (MonitorId, Sequence, Healthy))
+
+    // #endregion
+
+    // #region Unit Tests
+
+    TEST(JsonCodecTests, HeartbeatRoundTripSuccessful)
+    {
+        // Arrange
+        const Heartbeat heartbeat{"monitor \"7\"", 42, true};
+
+        // Act
+        const std::string payload = JsonCodec::Serialize(heartbeat);
+        const Heartbeat parsed = JsonCodec::Deserialize<Heartbeat>(payload);
+
+        // Assert
+        EXPECT_EQ(payload, R"({"MonitorId":"monitor \"7\"","Sequence":42,"Healthy":true})");
+        EXPECT_EQ(parsed.MonitorId, heartbeat.MonitorId);
+        EXPECT_EQ(parsed.Sequence, heartbeat.Sequence);
+        EXPECT_EQ(parsed.Healthy, heartbeat.Healthy);
+    }
+
+    TEST(JsonCodecTests, SerializeAppendSuccessful)
+    {
+        // Arrange
+        TestDataMetrics metrics;
+        metrics.MetricData["LoadTime"] = {int32_t{120}};
+        metrics.MetricData["Url"] = {std::string("https://example.com")};
+
+        std::string output = "metrics=";
+
+        // Act
+        JsonCodec::Serialize(metrics, output);
+
+        // Assert
+        EXPECT_EQ(output, R"(metrics={"MetricData":{"LoadTime":120,"Url":"https://example.com"}})");
+    }
+
+    TEST(JsonCodecTests, SerializeMatchesSerializerImplSuccessful)
+    {
+        // Arrange
+        TestDataStepResults stepResults;
+        stepResults.OtherData["Step"] = {uint8_t{1}};
+        stepResults.PageResults["Title"] = {std::string(5000, 'x')};
+        stepResults.Metrics.resize(3);
+        stepResults.Metrics[1].MetricData["Ratio"] = {0.25f};
+
+        TestDataMonitorResults monitorResults;
+        monitorResults.StepResults.push_back(stepResults);
+
+        TestDataTestResults testResults;
+        testResults.MonitorResults.push_back(monitorResults);
+        testResults.OtherData["Status"] = {std::string("Passed")};
+
+        BoostJsonSerializerImpl serializer;
+
+        // Act -> Assert, the entity is larger than the stack buffer.
+        EXPECT_EQ(JsonCodec::Serialize(testResults), serializer.Serialize(testResults));
+    }
+
+    TEST(JsonCodecTests, DeserializePolicySuccessful)
+    {
+        // Act
+        const TestDataTestPolicy policy = JsonCodec::Deserialize<TestDataTestPolicy>(
+            R"({"Capabilities": {"Screenshots": true}, "Settings": {"Timeout": 30}})");
+
+        // Assert
+        EXPECT_TRUE(bv2::get<bool>(policy.Capabilities.at("Screenshots").data));
+        EXPECT_EQ(bv2::get<int64_t>(policy.Settings.at("Timeout").data), 30);
+    }
+
+    TEST(JsonCodecTests, DeserializeFailure)
+    {
+        // Arrange -> Act -> Assert
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(R"({"MonitorId": "m")"), XSerialization);
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(R"({"MonitorId": "m", "Sequence": 1})"), XSerialization);
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(R"({"MonitorId": 1, "Sequence": 1, "Healthy": true})"),
+                     XSerialization);
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>("[]"), XSerialization);
+    }
+
+    TEST(JsonCodecTests, DeserializeConfigurationSuccessful)
+    {
+        // Arrange
+        const std::string payload = R"({"MonitorId": "m", "Sequence": 1, "Healthy": true} // last beat)";
+
+        JsonParseConfiguration commentsAllowed;
+        commentsAllowed.AllowComments = true;
+
+        JsonParseConfiguration payloadLimited = commentsAllowed;
+        payloadLimited.MaxPayloadBytes = 16;
+
+        JsonParseConfiguration stringLimited = commentsAllowed;
+        stringLimited.MaxStringLength = 4;
+
+        // Act -> Assert
+        EXPECT_EQ(JsonCodec::Deserialize<Heartbeat>(payload, commentsAllowed).Sequence, 1);
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(payload), XSerialization);
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(payload, payloadLimited), XSerialization);
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(payload, stringLimited), XSerialization);
+    }
+
+    TEST(JsonCodecTests, DeserializeReusedParserSuccessful)
+    {
+        // Arrange
+        LimitedJsonParser parser(JsonParseConfiguration{});
+
+        // Act
+        const Heartbeat first = JsonCodec::Deserialize<Heartbeat>(
+            R"({"MonitorId": "a", "Sequence": 1, "Healthy": true})", parser);
+
+        EXPECT_THROW(JsonCodec::Deserialize<Heartbeat>(R"({"MonitorId": "b")", parser), XSerialization);
+
+        const Heartbeat second = JsonCodec::Deserialize<Heartbeat>(
+            R"({"MonitorId": "c", "Sequence": 3, "Healthy": false})", parser);
+
+        // Assert
+        EXPECT_EQ(first.MonitorId, "a");
+        EXPECT_EQ(second.MonitorId, "c");
+        EXPECT_EQ(second.Sequence, 3);
+    }
+
+    // #endregion
+} // Anonymous namespace
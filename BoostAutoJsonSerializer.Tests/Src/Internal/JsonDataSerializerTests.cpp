@@ -7,12 +7,16 @@
 
 #include "CommonTestsConfig.hpp"
 
+#include <memory_resource>
+
 #include "Interfaces/Factories/IObjectFactories.hpp"
 #include "Internal/JsonDataSerializer.hpp"
+#include "Internal/ThreadPool.hpp"
 
 #include "Exceptions/XArgumentNull.hpp"
 #include "Exceptions/XSerialization.hpp"
 
+#include "Internal/Mocks/ChunkSinkMock.hpp"
 #include "Internal/Mocks/JsonDataSerializerImplMock.hpp"
 
 // #region Namespace Symbols
@@ -28,8 +32,10 @@ using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Test;
 // #region GTest usings
 
 using ::testing::_;
+using ::testing::ByMove;
 using ::testing::Eq;
 using ::testing::Expectation;
+using ::testing::Invoke;
 using ::testing::NiceMock;
 using ::testing::Ref;
 using ::testing::Return;
@@ -124,6 +130,15 @@ namespace
         ASSERT_THROW(JsonDataSerializer(nullptr), XArgumentNull);
     }
 
+    TEST_F(JsonDataSerializerTestFixture, ConstructorInvalidExecutorFailure)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+
+        // Act -> Assert
+        ASSERT_THROW(JsonDataSerializer(serializerImplMock, nullptr), XArgumentNull);
+    }
+
     TEST_F(JsonDataSerializerTestFixture, DeserializeSuccessful)
     {
         // Arrange
@@ -150,6 +165,70 @@ namespace
         EXPECT_EQ(actualTestPolicy.Settings.size(), expectedTestPolicy.Settings.size());
     }
 
+    TEST_F(JsonDataSerializerTestFixture, DeserializeIntoSuccessful)
+    {
+        // Arrange
+        std::string input = "This is input data";
+        TestDataTestPolicy testPolicy = {};
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, Deserialize(Ref(input), Ref(testPolicy)))
+            .Times(2)
+            .WillOnce(Return())
+            .WillOnce(Throw(XSerialization("Data de-serialization failed")));
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        serializer->Deserialize(input, testPolicy);
+        EXPECT_THROW(serializer->Deserialize(input, testPolicy), XSerialization);
+
+        PerformanceSnapshot snapshot = serializer->GetPerformanceSnapshot();
+
+        // Assert, both overloads are counted as the same operation.
+        ASSERT_EQ(snapshot.Operations.size(), 2);
+        EXPECT_EQ(snapshot.Operations[0].Calls, 2);
+        EXPECT_EQ(snapshot.Operations[0].Errors, 1);
+        EXPECT_EQ(snapshot.Operations[0].BytesIn, 2 * input.size());
+    }
+
+    TEST_F(JsonDataSerializerTestFixture, DeserializeWithResourceSuccessful)
+    {
+        // Arrange
+        std::string input = "This is input data";
+        std::pmr::monotonic_buffer_resource arena;
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, Deserialize(Ref(input), &arena))
+            .Times(2)
+            .WillOnce(Return(ByMove(PmrTestDataTestPolicy{PmrAllocator(&arena)})))
+            .WillOnce(Throw(XSerialization("Data de-serialization failed")));
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        PmrTestDataTestPolicy testPolicy = serializer->Deserialize(input, &arena);
+        EXPECT_THROW(serializer->Deserialize(input, &arena), XSerialization);
+
+        PerformanceSnapshot snapshot = serializer->GetPerformanceSnapshot();
+
+        // Assert
+        EXPECT_EQ(testPolicy.Settings.get_allocator().resource(), &arena);
+        ASSERT_EQ(snapshot.Operations.size(), 2);
+        EXPECT_EQ(snapshot.Operations[0].Calls, 2);
+        EXPECT_EQ(snapshot.Operations[0].Errors, 1);
+    }
+
     TEST_F(JsonDataSerializerTestFixture, SerializeSuccessful)
     {
         // Arrange
@@ -176,6 +255,147 @@ namespace
         EXPECT_EQ(actualOutput, expectedOutput);
     }
 
+    TEST_F(JsonDataSerializerTestFixture, SerializeToSinkSuccessful)
+    {
+        // Arrange
+        TestDataTestResults inputTestResults = {};
+        ChunkSinkMock sinkMock;
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, Serialize(Ref(inputTestResults), _))
+            .Times(1)
+            .WillOnce(Invoke([](const TestDataTestResults&, IChunkSink& sink)
+                             {
+                                 sink.Write("{\"Results\":");
+                                 sink.Write("{}}");
+                             }));
+
+        EXPECT_CALL(sinkMock, Write(Eq("{\"Results\":"))).Times(1);
+        EXPECT_CALL(sinkMock, Write(Eq("{}}"))).Times(1);
+        EXPECT_CALL(sinkMock, Finish()).Times(0);
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        serializer->Serialize(inputTestResults, sinkMock);
+
+        PerformanceSnapshot snapshot = serializer->GetPerformanceSnapshot();
+
+        // Assert, the bytes handed over to the sink are counted.
+        ASSERT_EQ(snapshot.Operations.size(), 2);
+        EXPECT_EQ(snapshot.Operations[1].Calls, 1);
+        EXPECT_EQ(snapshot.Operations[1].BytesOut, 14);
+    }
+
+    TEST_F(JsonDataSerializerTestFixture, GetSerializedSizeSuccessful)
+    {
+        // Arrange
+        TestDataTestResults inputTestResults = {};
+
+        std::size_t expectedSize = 1234;
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, GetSerializedSize(Ref(inputTestResults)))
+            .Times(1)
+            .WillOnce(Return(expectedSize));
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        std::size_t actualSize = serializer->GetSerializedSize(inputTestResults);
+
+        // Assert
+        EXPECT_EQ(actualSize, expectedSize);
+    }
+
+    TEST_F(JsonDataSerializerTestFixture, DeserializeAsyncSuccessful)
+    {
+        // Arrange
+        TestDataTestPolicy expectedTestPolicy = {};
+        expectedTestPolicy.Settings["key"] = {std::string("value")};
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, Deserialize(Eq("This is input data")))
+            .Times(1)
+            .WillOnce(Return(expectedTestPolicy));
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        std::future<TestDataTestPolicy> result = serializer->DeserializeAsync("This is input data");
+
+        // Assert, without an executor the operation ran on the calling thread.
+        EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        EXPECT_EQ(result.get().Settings.size(), expectedTestPolicy.Settings.size());
+    }
+
+    TEST_F(JsonDataSerializerTestFixture, SerializeAsyncSuppliedExecutorSuccessful)
+    {
+        // Arrange
+        TestDataTestResults inputTestResults = {};
+        inputTestResults.MonitorResults.resize(3);
+
+        std::string expectedOutput = "This is output data";
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        std::shared_ptr<ThreadPool> executor = std::make_shared<ThreadPool>(1);
+
+        std::thread::id executingThread;
+
+        EXPECT_CALL(*serializerImplMock, Serialize(_))
+            .Times(1)
+            .WillOnce([&](const TestDataTestResults& entity)
+                      {
+                          executingThread = std::this_thread::get_id();
+                          return (3 == entity.MonitorResults.size()) ? expectedOutput : std::string(); });
+
+        JsonDataSerializer serializer(serializerImplMock, executor);
+
+        // Act
+        std::future<std::string> result = serializer.SerializeAsync(std::move(inputTestResults));
+
+        // Assert
+        EXPECT_EQ(result.get(), expectedOutput);
+        EXPECT_NE(executingThread, std::this_thread::get_id());
+    }
+
+    TEST_F(JsonDataSerializerTestFixture, ImplExceptionSerializeAsyncFailure)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, Serialize(_))
+            .Times(1)
+            .WillOnce(Throw(XSerialization("Data serialization failed")));
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        std::future<std::string> result = serializer->SerializeAsync(TestDataTestResults{});
+
+        // Assert
+        EXPECT_THROW(result.get(), XSerialization);
+    }
+
     TEST_F(JsonDataSerializerTestFixture, ImplExceptionDeserializeFailure)
     {
         // Arrange
@@ -218,5 +438,50 @@ namespace
         EXPECT_THROW(serializer->Serialize(inputTestResults), XSerialization);
     }
 
+    TEST_F(JsonDataSerializerTestFixture, GetPerformanceSnapshotSuccessful)
+    {
+        // Arrange
+        std::string input = "This is input data";
+        TestDataTestResults inputTestResults = {};
+
+        std::shared_ptr<JsonDataSerializerImplMock> serializerImplMock = std::make_shared<JsonDataSerializerImplMock>();
+        Set(serializerImplMock);
+
+        EXPECT_CALL(*serializerImplMock, Deserialize(Ref(input)))
+            .Times(1)
+            .WillOnce(Return(TestDataTestPolicy{}));
+
+        EXPECT_CALL(*serializerImplMock, Serialize(Ref(inputTestResults)))
+            .Times(2)
+            .WillOnce(Return("{}"))
+            .WillOnce(Throw(XSerialization("Data serialization failed")));
+
+        std::shared_ptr<IJsonDataSerializerFactory> jsonDataSerializerFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataSerializer> serializer;
+        jsonDataSerializerFactory->Create(serializer);
+
+        // Act
+        serializer->Deserialize(input);
+        serializer->Serialize(inputTestResults);
+        EXPECT_THROW(serializer->Serialize(inputTestResults), XSerialization);
+
+        PerformanceSnapshot snapshot = serializer->GetPerformanceSnapshot();
+
+        // Assert
+        ASSERT_EQ(snapshot.Operations.size(), 2);
+
+        EXPECT_EQ(snapshot.Operations[0].Operation, "Deserialize");
+        EXPECT_EQ(snapshot.Operations[0].Calls, 1);
+        EXPECT_EQ(snapshot.Operations[0].Errors, 0);
+        EXPECT_EQ(snapshot.Operations[0].BytesIn, input.size());
+
+        EXPECT_EQ(snapshot.Operations[1].Operation, "Serialize");
+        EXPECT_EQ(snapshot.Operations[1].Calls, 2);
+        EXPECT_EQ(snapshot.Operations[1].Errors, 1);
+        EXPECT_EQ(snapshot.Operations[1].BytesOut, 2);
+        EXPECT_EQ(snapshot.Operations[1].ErrorsByCategory.at("Serialization"), 1);
+    }
+
     // #endregion
 } // Anonymous namespace
\ No newline at end of file
@@ -31,6 +31,7 @@ using ::testing::_;
 using ::testing::Eq;
 using ::testing::Expectation;
 using ::testing::NiceMock;
+using ::testing::Return;
 using ::testing::Throw;
 
 // #endregion
@@ -163,5 +164,38 @@ namespace
         EXPECT_THROW(validator->Validate(input), XInvalidFormat);
     }
 
+    TEST_F(JsonDataValidatorTestFixture, GetPerformanceSnapshotSuccessful)
+    {
+        // Arrange
+        std::string input = "This is input to validate";
+
+        std::shared_ptr<JsonDataValidatorImplMock> validatorImplMock = std::make_shared<JsonDataValidatorImplMock>();
+        Set(validatorImplMock);
+
+        EXPECT_CALL(*validatorImplMock, Validate(input))
+            .Times(2)
+            .WillOnce(Return())
+            .WillOnce(Throw(XInvalidFormat("Invalid data format")));
+
+        std::shared_ptr<IJsonDataValidatorFactory> jsonDataValidatorFactory = GetFactory();
+
+        std::shared_ptr<IJsonDataValidator> validator;
+        jsonDataValidatorFactory->Create(validator);
+
+        // Act
+        validator->Validate(input);
+        EXPECT_THROW(validator->Validate(input), XInvalidFormat);
+
+        PerformanceSnapshot snapshot = validator->GetPerformanceSnapshot();
+
+        // Assert
+        ASSERT_EQ(snapshot.Operations.size(), 1);
+        EXPECT_EQ(snapshot.Operations[0].Operation, "Validate");
+        EXPECT_EQ(snapshot.Operations[0].Calls, 2);
+        EXPECT_EQ(snapshot.Operations[0].Errors, 1);
+        EXPECT_EQ(snapshot.Operations[0].BytesIn, 2 * input.size());
+        EXPECT_EQ(snapshot.Operations[0].ErrorsByCategory.at("InvalidFormat"), 1);
+    }
+
     // #endregion
 } // Anonymous namespace
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*************************************************************************************************
+ * @file JsonDocumentSplitterTests.cpp
+ *
+ * @brief Contains unit tests for class @ref JsonDocumentSplitter.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/JsonDocumentSplitter.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Get the text of all the spans.
+     *
+     * @param[in] stream The stream the spans belong to.
+     * @param[in] spans The document spans.
+     *
+     * @return The documents, in stream order.
+     */
+    std::vector<std::string> GetDocuments(const std::string& stream, const std::vector<JsonDocumentSpan>& spans)
+    {
+        std::vector<std::string> documents;
+
+        for (const JsonDocumentSpan& span : spans)
+        {
+            documents.push_back(stream.substr(span.Offset, span.Length));
+        }
+
+        return documents;
+    }
+
+    // #region Unit Tests
+
+    TEST(JsonDocumentSplitterTests, SplitNewlineDelimitedSuccessful)
+    {
+        // Arrange
+        std::string stream = "{\"a\": 1}\n\n  \n{\"b\": \"x\\ny\"}\r\n[1, 2]";
+
+        // Act
+        std::vector<JsonDocumentSpan> spans = JsonDocumentSplitter::Split(stream, JsonStreamFraming::NewlineDelimited);
+
+        // Assert
+        ASSERT_EQ(spans.size(), 3);
+        EXPECT_EQ(GetDocuments(stream, spans),
+                  (std::vector<std::string>{"{\"a\": 1}", "{\"b\": \"x\\ny\"}\r", "[1, 2]"}));
+        EXPECT_EQ(spans[0].LineNumber, 1);
+        EXPECT_EQ(spans[1].LineNumber, 4);
+        EXPECT_EQ(spans[2].LineNumber, 5);
+    }
+
+    TEST(JsonDocumentSplitterTests, SplitConcatenatedSuccessful)
+    {
+        // Arrange
+        std::string stream = "{\"a\": {\"b\": [1, 2]}}{\"c\": \"}{\\\"\"}\n"
+                             "{\n"
+                             "  \"d\": true\n"
+                             "} 42 \"text\"";
+
+        // Act
+        std::vector<JsonDocumentSpan> spans = JsonDocumentSplitter::Split(stream, JsonStreamFraming::Concatenated);
+
+        // Assert
+        ASSERT_EQ(spans.size(), 5);
+        EXPECT_EQ(GetDocuments(stream, spans),
+                  (std::vector<std::string>{"{\"a\": {\"b\": [1, 2]}}",
+                                            "{\"c\": \"}{\\\"\"}",
+                                            "{\n  \"d\": true\n}",
+                                            "42",
+                                            "\"text\""}));
+        EXPECT_EQ(spans[0].LineNumber, 1);
+        EXPECT_EQ(spans[1].LineNumber, 1);
+        EXPECT_EQ(spans[2].LineNumber, 2);
+        EXPECT_EQ(spans[3].LineNumber, 4);
+        EXPECT_EQ(spans[4].LineNumber, 4);
+    }
+
+    TEST(JsonDocumentSplitterTests, SplitConcatenatedUnterminatedDocument)
+    {
+        // Arrange
+        std::string stream = "{\"a\": 1}\n{\"b\": [1, 2}\n";
+
+        // Act
+        std::vector<JsonDocumentSpan> spans = JsonDocumentSplitter::Split(stream, JsonStreamFraming::Concatenated);
+
+        // Assert
+        ASSERT_EQ(spans.size(), 2);
+        EXPECT_EQ(spans[1].LineNumber, 2);
+        EXPECT_EQ(spans[1].Offset + spans[1].Length, stream.size());
+    }
+
+    TEST(JsonDocumentSplitterTests, SplitEmptyStream)
+    {
+        EXPECT_TRUE(JsonDocumentSplitter::Split("", JsonStreamFraming::NewlineDelimited).empty());
+        EXPECT_TRUE(JsonDocumentSplitter::Split(" \n\t\n", JsonStreamFraming::Concatenated).empty());
+    }
+
+    // #endregion
+} // Anonymous namespace
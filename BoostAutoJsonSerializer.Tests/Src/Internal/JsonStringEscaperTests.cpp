@@ -0,0 +1,144 @@
+/*************************************************************************************************
+ * @file JsonStringEscaperTests.cpp
+ *
+ * @brief Contains unit tests for class @ref JsonStringEscaper.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <random>
+
+#include "Internal/JsonStringEscaper.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Reference byte by byte implementation of the escaping.
+     *
+     * @param[in] text The raw text.
+     *
+     * @return The quoted and escaped text.
+     */
+    std::string ReferenceQuote(const std::string& text)
+    {
+        std::string output = "\"";
+
+        for (char byte : text)
+        {
+            const unsigned char value = static_cast<unsigned char>(byte);
+
+            if (value < 0x20 || '"' == byte || '\\' == byte)
+            {
+                char escapeSequence[JsonStringEscaper::MaxEscapeSequenceLength];
+                output.append(escapeSequence, JsonStringEscaper::EscapeByte(byte, escapeSequence));
+            }
+            else
+            {
+                output.push_back(byte);
+            }
+        }
+
+        return output + "\"";
+    }
+
+    /**
+     * @brief All the instruction set levels the executing CPU supports.
+     */
+    std::vector<SimdLevel> GetSupportedLevels()
+    {
+        std::vector<SimdLevel> levels;
+
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2})
+        {
+            if (CpuFeatures::IsSupported(level))
+            {
+                levels.push_back(level);
+            }
+        }
+
+        return levels;
+    }
+
+    // #region Unit Tests
+
+    TEST(JsonStringEscaperTests, EscapeByteSuccessful)
+    {
+        char buffer[JsonStringEscaper::MaxEscapeSequenceLength];
+
+        EXPECT_EQ(std::string(buffer, JsonStringEscaper::EscapeByte('"', buffer)), "\\\"");
+        EXPECT_EQ(std::string(buffer, JsonStringEscaper::EscapeByte('\\', buffer)), "\\\\");
+        EXPECT_EQ(std::string(buffer, JsonStringEscaper::EscapeByte('\n', buffer)), "\\n");
+        EXPECT_EQ(std::string(buffer, JsonStringEscaper::EscapeByte('\t', buffer)), "\\t");
+        EXPECT_EQ(std::string(buffer, JsonStringEscaper::EscapeByte('\x01', buffer)), "\\u0001");
+        EXPECT_EQ(std::string(buffer, JsonStringEscaper::EscapeByte('\x1f', buffer)), "\\u001f");
+    }
+
+    TEST(JsonStringEscaperTests, AppendQuotedSuccessful)
+    {
+        for (SimdLevel level : GetSupportedLevels())
+        {
+            std::string output;
+            JsonStringEscaper::AppendQuoted(output, "https://example.com/page?q=\"a\\b\"\n\x7f\xc3\xa9", level);
+
+            EXPECT_EQ(output, "\"https://example.com/page?q=\\\"a\\\\b\\\"\\n\x7f\xc3\xa9\"");
+        }
+    }
+
+    TEST(JsonStringEscaperTests, AppendQuotedMatchesReference)
+    {
+        // Arrange
+        std::mt19937 generator(20240501);
+        std::uniform_int_distribution<int> lengthDistribution(0, 200);
+        std::uniform_int_distribution<int> byteDistribution(0, 255);
+        std::uniform_int_distribution<int> densityDistribution(0, 63);
+
+        for (int iteration = 0; iteration < 2000; ++iteration)
+        {
+            std::string text(static_cast<std::size_t>(lengthDistribution(generator)), 'a');
+
+            // Mostly clean text with a few bytes to escape, so that bulk runs and slow paths alternate.
+            for (char& byte : text)
+            {
+                if (0 == densityDistribution(generator))
+                {
+                    byte = static_cast<char>(byteDistribution(generator));
+                }
+            }
+
+            const std::string expected = ReferenceQuote(text);
+
+            ASSERT_EQ(JsonStringEscaper::GetQuotedSize(text), expected.size());
+
+            for (SimdLevel level : GetSupportedLevels())
+            {
+                // Act
+                std::string output;
+                JsonStringEscaper::AppendQuoted(output, text, level);
+
+                // Assert
+                ASSERT_EQ(output, expected);
+            }
+        }
+    }
+
+    TEST(JsonStringEscaperTests, FindEscapableNoEscapes)
+    {
+        std::string text(1000, 'x');
+
+        for (SimdLevel level : GetSupportedLevels())
+        {
+            EXPECT_EQ(JsonStringEscaper::FindEscapable(text.data(), text.size(), level), text.size());
+        }
+
+        EXPECT_EQ(JsonStringEscaper::FindEscapable(text.data(), 0), 0);
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,164 @@
+/*************************************************************************************************
+ * @file JsonStructuralValidatorTests.cpp
+ *
+ * @brief Contains unit tests for class @ref JsonStructuralValidator.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/JsonStructuralValidator.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief All the instruction set levels the executing CPU supports.
+     */
+    std::vector<SimdLevel> GetSupportedLevels()
+    {
+        std::vector<SimdLevel> levels;
+
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2})
+        {
+            if (CpuFeatures::IsSupported(level))
+            {
+                levels.push_back(level);
+            }
+        }
+
+        return levels;
+    }
+
+    /**
+     * @brief Check whether boost::json::parse accepts the payload with default options.
+     */
+    bool IsAcceptedByBoost(const std::string& payload)
+    {
+        bj::error_code errorCode;
+        bj::parse(payload, errorCode);
+
+        return !errorCode;
+    }
+
+    /**
+     * @brief Payloads accepted by the reference parser, the longer ones cross several 64 byte blocks.
+     */
+    const std::vector<std::string> AcceptedPayloads = {
+        "{}",
+        "[]",
+        " \t\r\n{ } ",
+        "0",
+        "-0.5e-10",
+        "true",
+        "\"text\"",
+        R"({"Capabilities": {"intKey": 123, "stringKey": "value", "boolKey": false, "doubleKey": 1.23}})",
+        R"({"escapes": "quote \" backslash \\ slash \/ \b\f\n\r\t \u00e9 \ud83d\ude00", "\\": "\\\\"})",
+        R"([1, -2, 3.5, 1E5, 1e-5, 18446744073709551616, null, true, false, [], {}, [[[]]], {"a": {"b": {}}}])",
+        "{\"utf8\": \"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"}",
+        "{\"key_long_enough_to_cross_the_first_block_boundary_of_sixty_four_bytes\": \"\\\\\\\\\\\\\\\"\", \"x\": 1}",
+        std::string(100, ' ') + "[\"" + std::string(200, 'a') + "\\\"" + std::string(61, 'b') + "\"]"};
+
+    /**
+     * @brief Payloads rejected by the reference parser.
+     */
+    const std::vector<std::string> RejectedPayloads = {
+        "",
+        "   ",
+        "{",
+        "}",
+        "[1,]",
+        "{\"a\": 1,}",
+        "{\"a\" 1}",
+        "{\"a\": 1 \"b\": 2}",
+        "{1: 2}",
+        "[1 2]",
+        "{} {}",
+        "01",
+        "1.",
+        ".5",
+        "-",
+        "1e",
+        "tru",
+        "nul",
+        "True",
+        "\"unterminated",
+        "\"bad escape \\x\"",
+        "\"bad unicode \\u12G4\"",
+        "\"lone surrogate \\udc00\"",
+        "\"raw\ttab\"",
+        "\"raw\nnewline\"",
+        "{\"a\": \"\xc3\"}",
+        "{\"a\": \"\xed\xa0\x80\"}",
+        "{\"a\": \"\xc0\xaf\"}",
+        "[\"" + std::string(70, 'a') + "\\\\\"" + std::string(70, 'b') + "\"]",
+        "{\"a\": 1} // comment",
+        "[1, 2, 3]\x01"};
+
+    // #region Unit Tests
+
+    TEST(JsonStructuralValidatorTests, IsAcceptedSuccessful)
+    {
+        for (const std::string& payload : AcceptedPayloads)
+        {
+            ASSERT_TRUE(IsAcceptedByBoost(payload)) << payload;
+
+            for (SimdLevel level : GetSupportedLevels())
+            {
+                EXPECT_TRUE(JsonStructuralValidator::IsAccepted(payload, JsonStructuralValidator::DefaultMaxDepth, level))
+                    << payload;
+            }
+        }
+    }
+
+    TEST(JsonStructuralValidatorTests, IsAcceptedFailure)
+    {
+        for (const std::string& payload : RejectedPayloads)
+        {
+            ASSERT_FALSE(IsAcceptedByBoost(payload)) << payload;
+
+            for (SimdLevel level : GetSupportedLevels())
+            {
+                EXPECT_FALSE(JsonStructuralValidator::IsAccepted(payload, JsonStructuralValidator::DefaultMaxDepth, level))
+                    << payload;
+            }
+        }
+    }
+
+    TEST(JsonStructuralValidatorTests, IsAcceptedDepthLimit)
+    {
+        const std::string tooDeep = std::string(64, '[') + std::string(64, ']');
+        const std::string shallow = std::string(8, '[') + std::string(8, ']');
+
+        for (SimdLevel level : GetSupportedLevels())
+        {
+            EXPECT_FALSE(JsonStructuralValidator::IsAccepted(tooDeep, JsonStructuralValidator::DefaultMaxDepth, level));
+            EXPECT_TRUE(JsonStructuralValidator::IsAccepted(shallow, JsonStructuralValidator::DefaultMaxDepth, level));
+        }
+    }
+
+    TEST(JsonStructuralValidatorTests, IsValidUtf8Successful)
+    {
+        const std::string valid = std::string(40, 'a') + "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80" + std::string(40, 'b');
+        const std::string truncated = std::string(40, 'a') + "\xf0\x9f\x98";
+        const std::string overlong = std::string(40, 'a') + "\xe0\x80\xaf";
+        const std::string tooLarge = "\xf4\x90\x80\x80";
+
+        for (SimdLevel level : GetSupportedLevels())
+        {
+            EXPECT_TRUE(JsonStructuralValidator::IsValidUtf8(valid, level));
+            EXPECT_FALSE(JsonStructuralValidator::IsValidUtf8(truncated, level));
+            EXPECT_FALSE(JsonStructuralValidator::IsValidUtf8(overlong, level));
+            EXPECT_FALSE(JsonStructuralValidator::IsValidUtf8(tooLarge, level));
+        }
+    }
+
+    // #endregion
+} // Anonymous namespace
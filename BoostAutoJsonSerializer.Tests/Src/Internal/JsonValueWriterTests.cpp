@@ -0,0 +1,185 @@
+/*************************************************************************************************
+ * @file JsonValueWriterTests.cpp
+ *
+ * @brief Contains unit tests for class @ref JsonValueWriter.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <limits>
+
+#include "Internal/JsonValueWriter.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Keeps the chunks written into it.
+     */
+    class ChunkCollector : public BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces::IChunkSink
+    {
+    public:
+        void Write(std::string_view chunk) override
+        {
+            Chunks.emplace_back(chunk);
+        }
+
+        void Finish() override
+        {
+        }
+
+        std::vector<std::string> Chunks;
+    };
+
+    // #region Unit Tests
+
+    TEST(JsonValueWriterTests, WriteSuccessful)
+    {
+        // Arrange
+        bj::value value = bj::parse(R"({
+                                        "key \"quoted\"": "line1\nline2",
+                                        "array": [1, -2, 18446744073709551615, true, false, null],
+                                        "object": {"nested": "https://example.com/?a=b\\c"}
+                                    })");
+
+        // Act
+        std::string output = JsonValueWriter::Write(value);
+
+        // Assert
+        EXPECT_EQ(output, R"({"key \"quoted\"":"line1\nline2","array":[1,-2,18446744073709551615,true,false,null],)"
+                          R"("object":{"nested":"https://example.com/?a=b\\c"}})");
+    }
+
+    TEST(JsonValueWriterTests, WriteMatchesBoostSerialize)
+    {
+        // Arrange
+        bj::value value = bj::parse(R"({"a": [1.5, -0.25, 1e300, 123.45], "b": {"c": "\u0001\u001f\t"}, "d": 0.1})");
+
+        // Act
+        std::string output = JsonValueWriter::Write(value);
+
+        // Assert, the very same text.
+        EXPECT_EQ(output, bj::serialize(value));
+    }
+
+    TEST(JsonValueWriterTests, WriteChunkedSuccessful)
+    {
+        // Arrange
+        bj::value value = bj::parse(R"({"first": [1, 2, 3, "four", {"five": 5}], "second": "a longer string value",)"
+                                    R"( "third": {"nested": [true, false, null]}, "fourth": []})");
+
+        ChunkCollector sink;
+        std::string buffer = "stale content";
+
+        // Act
+        JsonValueWriter::Write(value, buffer, sink, 16);
+
+        // Assert
+        std::string output;
+
+        for (std::size_t index = 0; index < sink.Chunks.size(); ++index)
+        {
+            output += sink.Chunks[index];
+
+            if (index + 1 < sink.Chunks.size())
+            {
+                EXPECT_GE(sink.Chunks[index].size(), 16);
+            }
+        }
+
+        EXPECT_GT(sink.Chunks.size(), 1);
+        EXPECT_EQ(output, JsonValueWriter::Write(value));
+        EXPECT_TRUE(buffer.empty());
+    }
+
+    TEST(JsonValueWriterTests, WriteChunkedScalarSuccessful)
+    {
+        // Arrange
+        ChunkCollector sink;
+        std::string buffer;
+
+        // Act
+        JsonValueWriter::Write(bj::value("text"), buffer, sink, 1024);
+
+        // Assert
+        EXPECT_EQ(sink.Chunks, std::vector<std::string>{"\"text\""});
+    }
+
+    TEST(JsonValueWriterTests, AppendNumberKeepsFloatingPoint)
+    {
+        std::string output;
+
+        JsonValueWriter::AppendNumber(output, 2.0);
+        EXPECT_EQ(output, "2E0");
+        EXPECT_TRUE(bj::parse(output).is_double());
+
+        output.clear();
+        JsonValueWriter::AppendNumber(output, std::numeric_limits<double>::quiet_NaN());
+        EXPECT_EQ(output, "null");
+
+        output.clear();
+        JsonValueWriter::AppendNumber(output, std::numeric_limits<int64_t>::min());
+        EXPECT_EQ(output, "-9223372036854775808");
+    }
+
+    TEST(JsonValueWriterTests, FormatNumberMatchesBoostSerialize)
+    {
+        const std::pair<double, const char*> numbers[] = {
+            {0.0, "0E0"},
+            {-0.0, "-0E0"},
+            {2.0, "2E0"},
+            {0.1, "1E-1"},
+            {-0.25, "-2.5E-1"},
+            {123.45, "1.2345E2"},
+            {12345678.0, "1.2345678E7"},
+            {1e300, "1E300"},
+            {-1e-300, "-1E-300"},
+            {std::numeric_limits<double>::max(), "1.7976931348623157E308"},
+            {std::numeric_limits<double>::denorm_min(), "5E-324"},
+            {std::numeric_limits<double>::infinity(), "1e99999"},
+            {-std::numeric_limits<double>::infinity(), "-1e99999"}};
+
+        for (const auto& [number, text] : numbers)
+        {
+            // Arrange
+            char buffer[JsonValueWriter::MaxNumberLength];
+
+            // Act
+            std::size_t length = JsonValueWriter::FormatNumber(number, buffer);
+
+            // Assert
+            EXPECT_EQ(std::string(buffer, length), text);
+            EXPECT_EQ(std::string(buffer, length), bj::serialize(bj::value(number)));
+        }
+    }
+
+    TEST(JsonValueWriterTests, FormatNumberMatchesAppendNumber)
+    {
+        const double numbers[] = {0.0, -0.0, 2.0, 0.1, 123.45, 1e300, -1e-300,
+                                  std::numeric_limits<double>::infinity(), std::numeric_limits<double>::max()};
+
+        for (double number : numbers)
+        {
+            // Arrange
+            char buffer[JsonValueWriter::MaxNumberLength];
+            std::string output;
+
+            // Act
+            std::size_t length = JsonValueWriter::FormatNumber(number, buffer);
+            JsonValueWriter::AppendNumber(output, number);
+
+            // Assert
+            EXPECT_EQ(std::string(buffer, length), output);
+        }
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,191 @@
+/*************************************************************************************************
+ * @file LimitedJsonParserTests.cpp
+ *
+ * @brief Contains unit tests for class @ref LimitedJsonParser.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/LimitedJsonParser.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Parse a document, the error code is returned and the value dropped.
+     */
+    bj::error_code Parse(const JsonParseConfiguration& configuration, std::string_view payload)
+    {
+        LimitedJsonParser parser(configuration);
+
+        bj::error_code errorCode;
+        parser.Parse(payload, bj::storage_ptr(), errorCode);
+
+        return errorCode;
+    }
+
+    // #region Unit Tests
+
+    TEST(LimitedJsonParserTests, ParseSuccessful)
+    {
+        // Arrange
+        const std::string payload = R"({"object": {"key": "value", "array": [1, -2, 3.5, true, null]}, "empty": {}})";
+        LimitedJsonParser parser(JsonParseConfiguration{});
+
+        // Act
+        bj::error_code errorCode;
+        const bj::value value = parser.Parse(payload, bj::storage_ptr(), errorCode);
+
+        // Assert
+        EXPECT_FALSE(errorCode);
+        EXPECT_EQ(value, bj::parse(payload));
+    }
+
+    TEST(LimitedJsonParserTests, ParseReusedSuccessful)
+    {
+        // Arrange
+        LimitedJsonParser parser(JsonParseConfiguration{});
+        bj::error_code errorCode;
+
+        // Act
+        parser.Parse(R"({"key": [1, 2)", bj::storage_ptr(), errorCode);
+        EXPECT_TRUE(errorCode);
+
+        const bj::value value = parser.Parse(R"({"key": [1, 2]})", bj::storage_ptr(), errorCode);
+
+        // Assert
+        EXPECT_FALSE(errorCode);
+        EXPECT_EQ(value, bj::parse(R"({"key": [1, 2]})"));
+    }
+
+    TEST(LimitedJsonParserTests, ParseInvalidFailure)
+    {
+        // Act -> Assert
+        EXPECT_TRUE(Parse({}, ""));
+        EXPECT_TRUE(Parse({}, R"({"key" -> "value"})"));
+        EXPECT_EQ(Parse({}, R"({"key": 1} [])"), bj::error::extra_data);
+    }
+
+    TEST(LimitedJsonParserTests, ParseOptionsSuccessful)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.AllowComments = true;
+        configuration.AllowTrailingCommas = true;
+
+        // Act -> Assert
+        EXPECT_FALSE(Parse(configuration, "{\"key\": [1, 2,], /* comment */ \"other\": 3,} /* end */"));
+        EXPECT_TRUE(Parse({}, "{\"key\": [1, 2,]}"));
+        EXPECT_TRUE(Parse({}, "{\"key\": 1 /* comment */}"));
+    }
+
+    TEST(LimitedJsonParserTests, ParseMaxDepthFailure)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.MaxDepth = 2;
+
+        // Act -> Assert
+        EXPECT_FALSE(Parse(configuration, R"({"key": [1]})"));
+        EXPECT_EQ(Parse(configuration, R"({"key": [[1]]})"), bj::error::too_deep);
+    }
+
+    TEST(LimitedJsonParserTests, ParseMaxPayloadBytesFailure)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.MaxPayloadBytes = 10;
+
+        // Act -> Assert
+        EXPECT_FALSE(Parse(configuration, R"({"k": 12})"));
+        EXPECT_TRUE(Parse(configuration, R"({"k": 123456})"));
+    }
+
+    TEST(LimitedJsonParserTests, ParseMaxStringLengthFailure)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.MaxStringLength = 4;
+
+        // Act -> Assert
+        EXPECT_FALSE(Parse(configuration, R"({"four": "abcd", "esc": "éé"})"));
+        EXPECT_EQ(Parse(configuration, R"({"key": "abcde"})"), bj::error::string_too_large);
+        EXPECT_EQ(Parse(configuration, R"({"fives": "a"})"), bj::error::key_too_large);
+        EXPECT_EQ(Parse(configuration, R"(["ab\ncde"])"), bj::error::string_too_large);
+    }
+
+    TEST(LimitedJsonParserTests, ParseMaxObjectSizeFailure)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.MaxObjectSize = 2;
+
+        // Act -> Assert
+        EXPECT_FALSE(Parse(configuration, R"({"a": [1, 2], "b": {"c": {}, "d": []}})"));
+        EXPECT_EQ(Parse(configuration, R"({"a": 1, "b": 2, "c": 3})"), bj::error::object_too_large);
+        EXPECT_EQ(Parse(configuration, R"({"a": [1, [2, 3, 4]]})"), bj::error::array_too_large);
+        EXPECT_EQ(Parse(configuration, R"([[], {}, "three"])"), bj::error::array_too_large);
+    }
+
+    TEST(LimitedJsonParserTests, CheckSuccessful)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.MaxObjectSize = 2;
+        LimitedJsonParser parser(configuration);
+
+        bj::error_code errorCode;
+
+        // Act -> Assert
+        parser.Check(R"({"a": [1, 2], "b": "value"})", errorCode);
+        EXPECT_FALSE(errorCode);
+
+        parser.Check(R"({"a": [1, 2, 3]})", errorCode);
+        EXPECT_EQ(errorCode, bj::error::array_too_large);
+
+        parser.Check(R"({"a": )", errorCode);
+        EXPECT_TRUE(errorCode);
+    }
+
+    TEST(LimitedJsonParserTests, InvalidConfigurationFailure)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.MaxDepth = 0;
+
+        // Act -> Assert
+        EXPECT_THROW(LimitedJsonParser::ToParseOptions(configuration), XInvalidArgument);
+        EXPECT_THROW(LimitedJsonParser parser(configuration), XInvalidArgument);
+    }
+
+    TEST(LimitedJsonParserTests, NumberPrecisionSuccessful)
+    {
+        // Arrange
+        JsonParseConfiguration configuration;
+        configuration.Numbers = NumberPrecision::Precise;
+
+#if BOOST_VERSION >= 108300
+        // Act
+        const bj::parse_options options = LimitedJsonParser::ToParseOptions(configuration);
+
+        // Assert
+        EXPECT_EQ(options.numbers, bj::number_precision::precise);
+#else
+        // Act -> Assert
+        EXPECT_THROW(LimitedJsonParser::ToParseOptions(configuration), XInvalidArgument);
+#endif
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,251 @@
+/*************************************************************************************************
+ * @file MemoryFootprintInspectorTests.cpp
+ *
+ * @brief Contains unit tests for class @ref MemoryFootprintInspector.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <memory_resource>
+
+#include "Internal/JsonValueWriter.hpp"
+#include "Internal/MemoryFootprintInspector.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    constexpr std::size_t ResultsEntrySize = sizeof(std::pair<const std::string, SerializationValue>);
+
+    /**
+     * @brief Create results of two monitors, the first with two steps, the second with none.
+     */
+    TestDataTestResults CreateResults()
+    {
+        TestDataTestResults results;
+        results.OtherData["Name"] = {std::string("a test name long enough for the heap")};
+
+        results.MonitorResults.reserve(4);
+        results.MonitorResults.resize(2);
+
+        std::vector<TestDataStepResults>& steps = results.MonitorResults[0].StepResults;
+        steps.resize(2);
+
+        for (TestDataStepResults& step : steps)
+        {
+            step.Metrics.resize(3);
+
+            for (TestDataMetrics& metrics : step.Metrics)
+            {
+                metrics.MetricData["Latency"] = {uint32_t{10}};
+                metrics.MetricData["Status"] = {std::string("Ok")};
+            }
+        }
+
+        return results;
+    }
+
+    // #region Unit Tests
+
+    TEST(MemoryFootprintInspectorTests, InspectEmptyResults)
+    {
+        // Act
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(TestDataTestResults());
+
+        // Assert, the empty containers hold no memory but are reported.
+        EXPECT_EQ(report.InlineBytes, sizeof(TestDataTestResults));
+        EXPECT_EQ(report.HeapBytes, 0);
+        EXPECT_EQ(report.SlackBytes, 0);
+        EXPECT_EQ(report.SerializedSize, JsonValueWriter::Write(bj::value_from(TestDataTestResults())).size());
+        ASSERT_EQ(report.Levels.size(), 2);
+        EXPECT_EQ(report.Levels.at("MonitorResults").Instances, 1);
+        EXPECT_EQ(report.Levels.at("OtherData").Instances, 1);
+    }
+
+    TEST(MemoryFootprintInspectorTests, InspectLevelsSuccessful)
+    {
+        // Arrange
+        const TestDataTestResults results = CreateResults();
+
+        // Act
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(results);
+
+        // Assert, the vector of monitors has the slack of two monitors.
+        const MemoryFootprintLevel& monitors = report.Levels.at("MonitorResults");
+        EXPECT_EQ(monitors.Instances, 1);
+        EXPECT_EQ(monitors.Elements, 2);
+        EXPECT_EQ(monitors.HeapBytes, 4 * sizeof(TestDataMonitorResults));
+        EXPECT_EQ(monitors.SlackBytes, 2 * sizeof(TestDataMonitorResults));
+
+        const MemoryFootprintLevel& steps = report.Levels.at("MonitorResults[].StepResults");
+        EXPECT_EQ(steps.Instances, 2);
+        EXPECT_EQ(steps.Elements, 2);
+        EXPECT_EQ(steps.HeapBytes, 2 * sizeof(TestDataStepResults));
+
+        const MemoryFootprintLevel& metrics = report.Levels.at("MonitorResults[].StepResults[].Metrics[].MetricData");
+        EXPECT_EQ(metrics.Instances, 6);
+        EXPECT_EQ(metrics.Elements, 12);
+        EXPECT_EQ(metrics.HeapBytes, 12 * (MemoryFootprintInspector::MapNodeOverhead + ResultsEntrySize));
+
+        // The short strings are counted but hold no heap memory.
+        const MemoryFootprintLevel& keys = report.Levels.at("MonitorResults[].StepResults[].Metrics[].MetricData{key}");
+        EXPECT_EQ(keys.Instances, 12);
+        EXPECT_EQ(keys.Elements, 6 * (7 + 6));
+        EXPECT_EQ(keys.HeapBytes, 0);
+
+        const MemoryFootprintLevel& values = report.Levels.at("MonitorResults[].StepResults[].Metrics[].MetricData{}");
+        EXPECT_EQ(values.Instances, 6);
+        EXPECT_EQ(values.HeapBytes, 0);
+
+        const std::string& name = bv2::get<std::string>(results.OtherData.at("Name").data);
+        EXPECT_EQ(report.Levels.at("OtherData{}").HeapBytes, name.capacity() + 1);
+    }
+
+    TEST(MemoryFootprintInspectorTests, InspectTotalsSuccessful)
+    {
+        // Arrange
+        const TestDataTestResults results = CreateResults();
+
+        // Act
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(results);
+
+        // Assert
+        uint64_t heapBytes = 0;
+        uint64_t slackBytes = 0;
+
+        for (const auto& [path, level] : report.Levels)
+        {
+            heapBytes += level.HeapBytes;
+            slackBytes += level.SlackBytes;
+        }
+
+        EXPECT_EQ(report.HeapBytes, heapBytes);
+        EXPECT_EQ(report.SlackBytes, slackBytes);
+        EXPECT_EQ(report.SerializedSize, JsonValueWriter::Write(bj::value_from(results)).size());
+    }
+
+    TEST(MemoryFootprintInspectorTests, InspectCompactValuesSuccessful)
+    {
+        // Arrange
+        std::map<std::string, CompactValue> values;
+        values["Short"] = CompactValue("inline");
+        values["Long"] = CompactValue(std::string(40, 'l'));
+        values["Number"] = CompactValue(1.5);
+
+        // Act
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(values);
+
+        // Assert
+        EXPECT_EQ(report.Levels.at("").HeapBytes,
+                  3 * (MemoryFootprintInspector::MapNodeOverhead + sizeof(std::pair<const std::string, CompactValue>)));
+        EXPECT_EQ(report.Levels.at("{}").Instances, 2);
+        EXPECT_EQ(report.Levels.at("{}").HeapBytes, 40);
+    }
+
+    TEST(MemoryFootprintInspectorTests, InspectPolicySuccessful)
+    {
+        // Arrange
+        const std::string browser = "a browser name long enough for the heap";
+
+        TestDataTestPolicy policy;
+        policy.Capabilities["Browser"] = {browser};
+        policy.Capabilities["Tabs"] = {int64_t{4}};
+        policy.Settings["Enabled"] = {true};
+
+        // Act
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(policy);
+
+        // Assert
+        constexpr std::size_t entrySize = sizeof(std::pair<const std::string, DeserializationValue>);
+
+        EXPECT_EQ(report.Levels.at("Capabilities").HeapBytes,
+                  2 * (MemoryFootprintInspector::MapNodeOverhead + entrySize));
+        EXPECT_EQ(report.Levels.at("Capabilities{}").Instances, 1);
+        EXPECT_EQ(report.Levels.at("Capabilities{}").HeapBytes,
+                  bv2::get<std::string>(policy.Capabilities.at("Browser").data).capacity() + 1);
+        EXPECT_EQ(report.Levels.at("Settings").HeapBytes, MemoryFootprintInspector::MapNodeOverhead + entrySize);
+        const std::string payload =
+            R"({"Capabilities":{"Browser":")" + browser + R"(","Tabs":4},"Settings":{"Enabled":true}})";
+        EXPECT_EQ(report.SerializedSize, payload.size());
+    }
+
+    TEST(MemoryFootprintInspectorTests, InspectPmrResultsSuccessful)
+    {
+        // Arrange
+        std::pmr::monotonic_buffer_resource resource;
+        const TestDataTestResults results = CreateResults();
+
+        PmrTestDataTestResults pmrResults{PmrAllocator(&resource)};
+        pmrResults.OtherData.emplace("Name",
+                                     PmrSerializationValue(std::pmr::string("a test name long enough for the heap")));
+        pmrResults.MonitorResults.reserve(4);
+        pmrResults.MonitorResults.resize(2);
+
+        std::pmr::vector<PmrTestDataStepResults>& steps = pmrResults.MonitorResults[0].StepResults;
+        steps.resize(2);
+
+        for (PmrTestDataStepResults& step : steps)
+        {
+            step.Metrics.resize(3);
+
+            for (PmrTestDataMetrics& metrics : step.Metrics)
+            {
+                metrics.MetricData.emplace("Latency", PmrSerializationValue(uint32_t{10}));
+                metrics.MetricData.emplace("Status", PmrSerializationValue(std::pmr::string("Ok")));
+            }
+        }
+
+        // Act
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(pmrResults);
+        const MemoryFootprintReport expectedReport = MemoryFootprintInspector::Inspect(results);
+
+        // Assert, the tree of a memory resource has the shape and the serialized size of its counterpart.
+        ASSERT_EQ(report.Levels.size(), expectedReport.Levels.size());
+
+        for (const auto& [path, level] : expectedReport.Levels)
+        {
+            EXPECT_EQ(report.Levels.at(path).Instances, level.Instances) << path;
+            EXPECT_EQ(report.Levels.at(path).Elements, level.Elements) << path;
+        }
+
+        EXPECT_EQ(report.Levels.at("MonitorResults").HeapBytes, 4 * sizeof(PmrTestDataMonitorResults));
+        EXPECT_EQ(report.SerializedSize, expectedReport.SerializedSize);
+    }
+
+    TEST(MemoryFootprintInspectorTests, LoadSavedResultsSuccessful)
+    {
+        // Arrange
+        const TestDataTestResults results = CreateResults();
+        const std::string payload = JsonValueWriter::Write(bj::value_from(results));
+
+        // Act
+        const TestDataTestResults loadedResults = bj::value_to<TestDataTestResults>(bj::parse(payload));
+
+        // Assert, the saved payload is what the footprint command inspects.
+        EXPECT_EQ(JsonValueWriter::Write(bj::value_from(loadedResults)), payload);
+        EXPECT_EQ(MemoryFootprintInspector::Inspect(loadedResults).SerializedSize, payload.size());
+        EXPECT_THROW(bj::value_to<SerializationValue>(bj::parse("[1]")), XSerialization);
+    }
+
+    TEST(MemoryFootprintInspectorTests, LoadNumbersNotFloatFailure)
+    {
+        // Act -> Assert, a float is read back as itself and any other number is rejected rather than narrowed.
+        EXPECT_EQ(bv2::get<float>(bj::value_to<SerializationValue>(bj::parse("0.5")).data), 0.5f);
+        EXPECT_EQ(bv2::get<float>(bj::value_to<SerializationValue>(bj::parse(bj::serialize(bj::value(0.1f)))).data),
+                  0.1f);
+        EXPECT_THROW(bj::value_to<SerializationValue>(bj::parse("0.1")), XSerialization);
+        EXPECT_THROW(bj::value_to<SerializationValue>(bj::parse("1e300")), XSerialization);
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,224 @@
+/*************************************************************************************************
+ * @file MetricsSummarizerTests.cpp
+ *
+ * @brief Contains unit tests for class @ref MetricsSummarizer.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <random>
+
+#include "Internal/MetricsSummarizer.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief All the instruction set levels the executing CPU supports.
+     */
+    std::vector<SimdLevel> GetSupportedLevels()
+    {
+        std::vector<SimdLevel> levels;
+
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2})
+        {
+            if (CpuFeatures::IsSupported(level))
+            {
+                levels.push_back(level);
+            }
+        }
+
+        return levels;
+    }
+
+    /**
+     * @brief Create a step whose metrics hold the values 1 to count for "Latency", mixed with other data types.
+     */
+    TestDataStepResults CreateStep(int first, int count)
+    {
+        TestDataStepResults step;
+
+        for (int value = first; value < first + count; ++value)
+        {
+            TestDataMetrics metrics;
+            metrics.MetricData["Latency"] = SerializationValue{static_cast<uint32_t>(value)};
+            metrics.MetricData["Name"] = SerializationValue{std::string("request")};
+            metrics.MetricData["Succeeded"] = SerializationValue{true};
+            step.Metrics.push_back(metrics);
+        }
+
+        return step;
+    }
+
+    // #region Unit Tests
+
+    TEST(MetricsSummarizerTests, ReduceSuccessful)
+    {
+        // Arrange, integral values so that the sums are exact whatever their order.
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+        for (std::size_t count : {0, 1, 2, 3, 5, 8, 31, 1000})
+        {
+            std::vector<double> values(count);
+
+            for (double& value : values)
+            {
+                value = distribution(generator);
+            }
+
+            const MetricsSummarizer::SeriesReduction expected =
+                MetricsSummarizer::Reduce(values.data(), values.size(), SimdLevel::Scalar);
+
+            // Act -> Assert
+            for (SimdLevel level : GetSupportedLevels())
+            {
+                const MetricsSummarizer::SeriesReduction reduction =
+                    MetricsSummarizer::Reduce(values.data(), values.size(), level);
+
+                EXPECT_EQ(reduction.Min, expected.Min) << "count " << count;
+                EXPECT_EQ(reduction.Max, expected.Max) << "count " << count;
+                EXPECT_EQ(reduction.Sum, expected.Sum) << "count " << count;
+            }
+
+            if (0 != count)
+            {
+                EXPECT_EQ(expected.Min, *std::min_element(values.begin(), values.end()));
+                EXPECT_EQ(expected.Max, *std::max_element(values.begin(), values.end()));
+            }
+        }
+    }
+
+    TEST(MetricsSummarizerTests, SummarizeStepSuccessful)
+    {
+        // Arrange
+        TestDataStepResults step = CreateStep(1, 100);
+        step.Metrics[10].MetricData["Cpu"] = SerializationValue{0.5f};
+        step.Metrics[20].MetricData["Cpu"] = SerializationValue{int8_t(-2)};
+
+        MetricsSummarizer summarizer;
+
+        // Act
+        const std::map<std::string, MetricSummary> summaries = summarizer.Summarize(step);
+
+        // Assert, only the numeric keys are summarized.
+        ASSERT_EQ(summaries.size(), 2);
+
+        const MetricSummary& latency = summaries.at("Latency");
+        EXPECT_EQ(latency.Count, 100);
+        EXPECT_EQ(latency.Min, 1);
+        EXPECT_EQ(latency.Max, 100);
+        EXPECT_EQ(latency.Mean, 50.5);
+        EXPECT_EQ(latency.P50, 50);
+        EXPECT_EQ(latency.P95, 95);
+        EXPECT_EQ(latency.P99, 99);
+
+        const MetricSummary& cpu = summaries.at("Cpu");
+        EXPECT_EQ(cpu.Count, 2);
+        EXPECT_EQ(cpu.Min, -2);
+        EXPECT_EQ(cpu.Max, 0.5);
+        EXPECT_EQ(cpu.Mean, -0.75);
+    }
+
+    TEST(MetricsSummarizerTests, SummarizeMonitorSuccessful)
+    {
+        // Arrange
+        TestDataMonitorResults monitor;
+
+        for (int first = 0; first < 10000; first += 1000)
+        {
+            monitor.StepResults.push_back(CreateStep(first, 1000));
+        }
+
+        MetricsSummarizer summarizer;
+
+        // Act
+        const std::map<std::string, MetricSummary> summaries = summarizer.Summarize(monitor);
+
+        // Assert, the summary merges the ones of the steps.
+        const MetricSummary& latency = summaries.at("Latency");
+        EXPECT_EQ(latency.Count, 10000);
+        EXPECT_EQ(latency.Min, 0);
+        EXPECT_EQ(latency.Max, 9999);
+        EXPECT_EQ(latency.Mean, 4999.5);
+        EXPECT_NEAR(latency.P50, 5000, 200);
+        EXPECT_NEAR(latency.P95, 9500, 200);
+        EXPECT_NEAR(latency.P99, 9900, 200);
+    }
+
+    TEST(MetricsSummarizerTests, EmbedSuccessful)
+    {
+        // Arrange
+        TestDataTestResults results;
+        results.MonitorResults.resize(1);
+        results.MonitorResults[0].StepResults.push_back(CreateStep(1, 100));
+        results.MonitorResults[0].StepResults.push_back(CreateStep(101, 100));
+        results.MonitorResults[0].StepResults[0].OtherData["Status"] = SerializationValue{std::string("Done")};
+
+        MetricsSummarizer summarizer;
+
+        // Act
+        summarizer.Embed(results);
+
+        // Assert
+        const TestDataStepResults& step = results.MonitorResults[0].StepResults[0];
+        EXPECT_EQ(step.Metrics.size(), 100);
+        EXPECT_EQ(step.OtherData.size(), 8);
+        EXPECT_EQ(bv2::get<std::string>(step.OtherData.at("Status").data), "Done");
+        EXPECT_EQ(bv2::get<uint64_t>(step.OtherData.at("Summary.Latency.Count").data), 100);
+        EXPECT_EQ(bv2::get<float>(step.OtherData.at("Summary.Latency.Mean").data), 50.5f);
+        EXPECT_EQ(bv2::get<float>(step.OtherData.at("Summary.Latency.P95").data), 95.0f);
+
+        const TestDataMonitorResults& monitor = results.MonitorResults[0];
+        EXPECT_EQ(bv2::get<uint64_t>(monitor.OtherData.at("Summary.Latency.Count").data), 200);
+        EXPECT_EQ(bv2::get<float>(monitor.OtherData.at("Summary.Latency.Min").data), 1.0f);
+        EXPECT_EQ(bv2::get<float>(monitor.OtherData.at("Summary.Latency.Max").data), 200.0f);
+        EXPECT_EQ(bv2::get<float>(monitor.OtherData.at("Summary.Latency.P50").data), 100.0f);
+        EXPECT_EQ(bv2::get<float>(monitor.OtherData.at("Summary.Latency.P99").data), 198.0f);
+    }
+
+    TEST(MetricsSummarizerTests, EmbedWithoutRawSeriesSuccessful)
+    {
+        // Arrange
+        TestDataTestResults results;
+        results.MonitorResults.resize(1);
+        results.MonitorResults[0].StepResults.push_back(CreateStep(1, 10));
+
+        MetricSummaryOptions options;
+        options.KeyPrefix = "Stats/";
+        options.KeepRawSeries = false;
+
+        MetricsSummarizer summarizer(options);
+
+        // Act
+        summarizer.Embed(results);
+
+        // Assert
+        const TestDataStepResults& step = results.MonitorResults[0].StepResults[0];
+        EXPECT_TRUE(step.Metrics.empty());
+        EXPECT_EQ(bv2::get<float>(step.OtherData.at("Stats/Latency.Max").data), 10.0f);
+    }
+
+    TEST(MetricsSummarizerTests, InvalidArgumentFailure)
+    {
+        // Arrange
+        MetricSummaryOptions options;
+        options.SketchCapacity = 1;
+
+        // Act -> Assert
+        EXPECT_THROW(MetricsSummarizer summarizer(options), XInvalidArgument);
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,31 @@
+/*************************************************************************************************
+ * @file ChunkSinkMock.hpp
+ *
+ * @brief Declarations for the concrete class which implements @ref IChunkSink.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CHUNKSINKMOCK_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CHUNKSINKMOCK_HPP
+
+#include "CommonTestsConfig.hpp"
+
+#include "Interfaces/IChunkSink.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Test
+{
+    /**
+     * @class ChunkSinkMock
+     *
+     * @brief A mock class for the implementation class of @ref IChunkSink.
+     */
+    class ChunkSinkMock : public Interfaces::IChunkSink
+    {
+    public:
+        MOCK_METHOD(void, Write, (std::string_view chunk), (override));
+        MOCK_METHOD(void, Finish, (), (override));
+    };
+} // namespace Test
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CHUNKSINKMOCK_HPP
@@ -25,7 +25,11 @@ namespace Test
     {
     public:
         MOCK_METHOD(Internal::TestDataTestPolicy, Deserialize, (const std::string &payload), (override));
+        MOCK_METHOD(void, Deserialize, (const std::string &payload, Internal::TestDataTestPolicy &policy), (override));
+        MOCK_METHOD(Internal::PmrTestDataTestPolicy, Deserialize, (const std::string &payload, std::pmr::memory_resource *resource), (override));
         MOCK_METHOD(std::string, Serialize, (const Internal::TestDataTestResults &entity), (override));
+        MOCK_METHOD(void, Serialize, (const Internal::TestDataTestResults &entity, Interfaces::IChunkSink &sink), (override));
+        MOCK_METHOD(std::size_t, GetSerializedSize, (const Internal::TestDataTestResults &entity), (override));
     };
 }
 END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -23,6 +23,7 @@ namespace Test
     {
     public:
         MOCK_METHOD(void, Validate, (const std::string &payload), (override));
+        MOCK_METHOD(Internal::PerformanceSnapshot, GetPerformanceSnapshot, (), (const, override));
 
         // #endregion
     };
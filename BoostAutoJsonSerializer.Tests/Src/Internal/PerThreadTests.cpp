@@ -0,0 +1,236 @@
+/*************************************************************************************************
+ * @file PerThreadTests.cpp
+ *
+ * @brief Contains unit tests for class @ref PerThread.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include "Internal/PerThread.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief A context recording how often it was used.
+     */
+    struct CountingContext
+    {
+        int UseCount = 0;
+    };
+
+    /**
+     * @brief A context counting its live instances.
+     */
+    struct LiveContext
+    {
+        LiveContext()
+        {
+            ++LiveCount;
+        }
+
+        ~LiveContext()
+        {
+            --LiveCount;
+        }
+
+        static inline std::atomic<int> LiveCount{0};
+    };
+
+    /**
+     * @brief Run a function on a new thread and wait for the thread to exit.
+     */
+    template <typename TFunction>
+    void RunOnExitedThread(TFunction&& function)
+    {
+        std::thread thread(std::forward<TFunction>(function));
+        thread.join();
+    }
+
+    // #region Unit Tests
+
+    TEST(PerThreadTests, GetReusesContextOfThread)
+    {
+        // Arrange
+        PerThread<CountingContext> contexts;
+
+        // Act
+        CountingContext& first = contexts.Get();
+        CountingContext& second = contexts.Get();
+
+        // Assert
+        EXPECT_EQ(&first, &second);
+        EXPECT_EQ(contexts.GetContextCount(), 1);
+    }
+
+    TEST(PerThreadTests, GetSeparatesOwners)
+    {
+        // Arrange
+        PerThread<CountingContext> firstContexts;
+        PerThread<CountingContext> secondContexts;
+
+        // Act -> Assert
+        EXPECT_NE(&firstContexts.Get(), &secondContexts.Get());
+    }
+
+    TEST(PerThreadTests, GetSeparatesThreads)
+    {
+        // Arrange
+        constexpr std::size_t ThreadCount = 8;
+        constexpr int IterationCount = 10000;
+
+        PerThread<CountingContext> contexts;
+        std::vector<CountingContext*> threadContexts(ThreadCount, nullptr);
+        std::vector<std::thread> threads;
+
+        // The threads are kept running until the contexts are checked, their contexts go away with them.
+        std::atomic<std::size_t> doneCount{0};
+        std::promise<void> checked;
+        std::shared_future<void> checkedFuture = checked.get_future().share();
+
+        // Act
+        for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&contexts, &threadContexts, &doneCount, checkedFuture, threadIndex]()
+                                 {
+                                     for (int iteration = 0; iteration < IterationCount; ++iteration)
+                                     {
+                                         ++contexts.Get().UseCount;
+                                     }
+
+                                     threadContexts[threadIndex] = &contexts.Get();
+                                     ++doneCount;
+                                     checkedFuture.wait(); });
+        }
+
+        while (doneCount.load() < ThreadCount)
+        {
+            std::this_thread::yield();
+        }
+
+        // Assert
+        EXPECT_EQ(contexts.GetContextCount(), ThreadCount);
+
+        for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            EXPECT_EQ(threadContexts[threadIndex]->UseCount, IterationCount);
+
+            for (std::size_t otherIndex = 0; otherIndex < threadIndex; ++otherIndex)
+            {
+                EXPECT_NE(threadContexts[threadIndex], threadContexts[otherIndex]);
+            }
+        }
+
+        checked.set_value();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(contexts.GetContextCount(), 0);
+    }
+
+    TEST(PerThreadTests, DestroyedOwnersLeaveNoEntries)
+    {
+        // Arrange
+        constexpr int OwnerCount = 10000;
+
+        // Act
+        for (int owner = 0; owner < OwnerCount; ++owner)
+        {
+            PerThread<LiveContext> contexts;
+            contexts.Get();
+        }
+
+        // Assert, the table of the thread is bounded by the sweeps, not by the number of owners.
+        EXPECT_EQ(LiveContext::LiveCount.load(), 0);
+        EXPECT_LT(PerThread<LiveContext>::GetThreadEntryCount(), 64);
+    }
+
+    TEST(PerThreadTests, ExitedThreadsReleaseContexts)
+    {
+        // Arrange
+        PerThread<LiveContext> contexts;
+
+        // Act
+        for (int thread = 0; thread < 8; ++thread)
+        {
+            RunOnExitedThread([&contexts]()
+                              { contexts.Get(); });
+        }
+
+        // Assert
+        EXPECT_EQ(contexts.GetContextCount(), 0);
+        EXPECT_EQ(LiveContext::LiveCount.load(), 0);
+    }
+
+    TEST(PerThreadTests, ExitedThreadsMergeContexts)
+    {
+        // Arrange
+        constexpr int ThreadCount = 4;
+        constexpr int IterationCount = 1000;
+
+        PerThread<CountingContext> contexts([](CountingContext& exited, CountingContext& retired) noexcept
+                                            { retired.UseCount += exited.UseCount; });
+
+        // Act
+        for (int thread = 0; thread < ThreadCount; ++thread)
+        {
+            RunOnExitedThread([&contexts]()
+                              {
+                                  for (int iteration = 0; iteration < IterationCount; ++iteration)
+                                  {
+                                      ++contexts.Get().UseCount;
+                                  } });
+        }
+
+        ++contexts.Get().UseCount;
+
+        // Assert, the retired context is visited with the live one.
+        int useCount = 0;
+        contexts.ForEach([&useCount](const CountingContext& context)
+                         { useCount += context.UseCount; });
+
+        EXPECT_EQ(contexts.GetContextCount(), 1);
+        EXPECT_EQ(useCount, ThreadCount * IterationCount + 1);
+    }
+
+    TEST(PerThreadTests, OwnerDestroyedBeforeThreadExits)
+    {
+        // Arrange
+        auto contexts = std::make_unique<PerThread<LiveContext>>();
+
+        std::promise<void> used;
+        std::promise<void> destroyed;
+
+        std::thread thread([&contexts, &used, destroyedFuture = destroyed.get_future()]()
+                           {
+                               contexts->Get();
+                               used.set_value();
+                               destroyedFuture.wait(); });
+
+        used.get_future().wait();
+
+        // Act
+        contexts.reset();
+
+        // Assert, the owner released the context, the exiting thread finds nothing left.
+        EXPECT_EQ(LiveContext::LiveCount.load(), 0);
+
+        destroyed.set_value();
+        thread.join();
+    }
+
+    // #endregion
+} // Anonymous namespace
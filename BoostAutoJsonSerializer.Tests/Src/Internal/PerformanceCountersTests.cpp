@@ -0,0 +1,146 @@
+/*************************************************************************************************
+ * @file PerformanceCountersTests.cpp
+ *
+ * @brief Contains unit tests for class @ref PerformanceCounters.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <thread>
+
+#include "Internal/PerformanceCounters.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidArgument.hpp"
+#include "Exceptions/XInvalidFormat.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    // #region Unit Tests
+
+    TEST(PerformanceCountersTests, ConstructorInvalidArgumentFailure)
+    {
+        // Arrange -> Act -> Assert
+        ASSERT_THROW(PerformanceCounters({}), XInvalidArgument);
+        ASSERT_THROW(PerformanceCounters({"1", "2", "3", "4", "5"}), XInvalidArgument);
+    }
+
+    TEST(PerformanceCountersTests, BucketsCoverEveryLatency)
+    {
+        uint64_t previousUpperBound = 0;
+
+        for (std::size_t bucket = 0; bucket < PerformanceCounters::BucketCount; ++bucket)
+        {
+            const uint64_t upperBound = PerformanceCounters::GetBucketUpperBound(bucket);
+
+            // Buckets are contiguous: the first latency of a bucket is the upper bound of the previous one.
+            ASSERT_GT(upperBound, previousUpperBound);
+            EXPECT_EQ(PerformanceCounters::GetBucketIndex(previousUpperBound), bucket);
+            EXPECT_EQ(PerformanceCounters::GetBucketIndex(upperBound - 1), bucket);
+
+            // The relative error of a bucket stays below 25%.
+            EXPECT_LE((upperBound - previousUpperBound) * 4, std::max<uint64_t>(previousUpperBound, 4));
+
+            previousUpperBound = upperBound;
+        }
+
+        EXPECT_EQ(PerformanceCounters::GetBucketIndex(std::numeric_limits<uint64_t>::max()), PerformanceCounters::BucketCount - 1);
+    }
+
+    TEST(PerformanceCountersTests, CategorizeSuccessful)
+    {
+        EXPECT_EQ(PerformanceCounters::Categorize(XSerialization("")), ErrorCategory::Serialization);
+        EXPECT_EQ(PerformanceCounters::Categorize(XInvalidFormat("")), ErrorCategory::InvalidFormat);
+        EXPECT_EQ(PerformanceCounters::Categorize(XArgumentNull("")), ErrorCategory::InvalidArgument);
+        EXPECT_EQ(PerformanceCounters::Categorize(std::bad_alloc()), ErrorCategory::OutOfMemory);
+        EXPECT_EQ(PerformanceCounters::Categorize(std::runtime_error("")), ErrorCategory::Other);
+    }
+
+    TEST(PerformanceCountersTests, GetSnapshotAggregatesThreads)
+    {
+        // Arrange
+        constexpr std::size_t ThreadCount = 4;
+        constexpr uint64_t CallCount = 1000;
+
+        PerformanceCounters counters({"Read", "Write"});
+        std::vector<std::thread> threads;
+
+        // Act
+        for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&counters]()
+                                 {
+                                     for (uint64_t call = 0; call < CallCount; ++call)
+                                     {
+                                         counters.RecordSuccess(0, PerformanceCounters::Clock::now(), 10, 1);
+                                     }
+
+                                     counters.RecordFailure(1, PerformanceCounters::Clock::now(), 5, XSerialization("")); });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        PerformanceSnapshot snapshot = counters.GetSnapshot();
+
+        // Assert
+        ASSERT_EQ(snapshot.Operations.size(), 2);
+
+        const OperationStatistics& read = snapshot.Operations[0];
+        EXPECT_EQ(read.Operation, "Read");
+        EXPECT_EQ(read.Calls, ThreadCount * CallCount);
+        EXPECT_EQ(read.Errors, 0);
+        EXPECT_EQ(read.BytesIn, ThreadCount * CallCount * 10);
+        EXPECT_EQ(read.BytesOut, ThreadCount * CallCount);
+        EXPECT_TRUE(read.ErrorsByCategory.empty());
+        EXPECT_LE(read.P50Nanoseconds, read.P99Nanoseconds);
+        EXPECT_GE(read.TotalNanoseconds, read.MaxNanoseconds);
+
+        uint64_t histogramCount = 0;
+
+        for (const LatencyBucket& bucket : read.LatencyHistogram)
+        {
+            histogramCount += bucket.Count;
+        }
+
+        EXPECT_EQ(histogramCount, read.Calls);
+
+        const OperationStatistics& write = snapshot.Operations[1];
+        EXPECT_EQ(write.Operation, "Write");
+        EXPECT_EQ(write.Calls, ThreadCount);
+        EXPECT_EQ(write.Errors, ThreadCount);
+        EXPECT_EQ(write.ErrorsByCategory.at("Serialization"), ThreadCount);
+    }
+
+    TEST(PerformanceCountersTests, ToJsonSuccessful)
+    {
+        // Arrange
+        PerformanceCounters counters({"Validate"});
+        counters.RecordFailure(0, PerformanceCounters::Clock::now(), 3, XInvalidFormat(""));
+
+        // Act
+        bj::value json = bj::parse(PerformanceCounters::ToJson(counters.GetSnapshot()));
+
+        // Assert
+        const bj::object& operation = json.at("Operations").at(0).as_object();
+        EXPECT_EQ(operation.at("Operation").as_string(), "Validate");
+        EXPECT_EQ(operation.at("Calls").to_number<uint64_t>(), 1);
+        EXPECT_EQ(operation.at("ErrorsByCategory").at("InvalidFormat").to_number<uint64_t>(), 1);
+        EXPECT_EQ(operation.at("LatencyHistogram").as_array().size(), 1);
+    }
+
+    // #endregion
+} // Anonymous namespace
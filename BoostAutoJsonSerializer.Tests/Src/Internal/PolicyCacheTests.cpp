@@ -0,0 +1,215 @@
+/*************************************************************************************************
+ * @file PolicyCacheTests.cpp
+ *
+ * @brief Contains unit tests for class @ref PolicyCache.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/MemoryFootprintInspector.hpp"
+#include "Internal/PolicyCache.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidFormat.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+#include "Internal/Mocks/JsonDataSerializerMock.hpp"
+#include "Internal/Mocks/JsonDataValidatorMock.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Test;
+
+// #endregion
+
+// #region GTest usings
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Throw;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Build a policy with one setting holding the payload, so that the policies tell the payloads apart.
+     */
+    TestDataTestPolicy CreatePolicy(const std::string& payload)
+    {
+        TestDataTestPolicy policy;
+        policy.Settings["payload"].data = payload;
+
+        return policy;
+    }
+
+    // #region Unit Tests
+
+    TEST(PolicyCacheTests, ConstructorInvalidArgumentFailure)
+    {
+        // Arrange -> Act -> Assert
+        ASSERT_THROW(PolicyCache(nullptr, nullptr), XArgumentNull);
+    }
+
+    TEST(PolicyCacheTests, DeserializeHitSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+        std::shared_ptr<JsonDataValidatorMock> validatorMock = std::make_shared<JsonDataValidatorMock>();
+
+        EXPECT_CALL(*validatorMock, Validate(_)).Times(2);
+        EXPECT_CALL(*serializerMock, Deserialize(_))
+            .Times(2)
+            .WillRepeatedly(Invoke(CreatePolicy));
+
+        PolicyCache cache(serializerMock, validatorMock);
+
+        // Act
+        std::shared_ptr<const TestDataTestPolicy> first = cache.Deserialize("first");
+        std::shared_ptr<const TestDataTestPolicy> second = cache.Deserialize("second");
+        std::shared_ptr<const TestDataTestPolicy> firstAgain = cache.Deserialize(std::string("first"));
+
+        PolicyCacheStatistics statistics = cache.GetStatistics();
+
+        // Assert
+        EXPECT_EQ(first, firstAgain);
+        EXPECT_NE(first, second);
+        EXPECT_EQ(boost::variant2::get<std::string>(second->Settings.at("payload").data), "second");
+
+        EXPECT_EQ(statistics.Hits, 1);
+        EXPECT_EQ(statistics.Misses, 2);
+        EXPECT_EQ(statistics.EntryCount, 2);
+        EXPECT_GT(statistics.UsedBytes, 0);
+    }
+
+    TEST(PolicyCacheTests, DeserializeValidationFailureCached)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+        std::shared_ptr<JsonDataValidatorMock> validatorMock = std::make_shared<JsonDataValidatorMock>();
+
+        EXPECT_CALL(*validatorMock, Validate(_))
+            .Times(1)
+            .WillOnce(Throw(XInvalidFormat("Invalid JSON payload")));
+        EXPECT_CALL(*serializerMock, Deserialize(_)).Times(0);
+
+        PolicyCache cache(serializerMock, validatorMock);
+
+        // Act -> Assert
+        EXPECT_THROW(cache.Deserialize("{"), XInvalidFormat);
+
+        try
+        {
+            cache.Deserialize("{");
+            FAIL() << "The cached validation failure was not reported.";
+        }
+        catch (const XInvalidFormat& ex)
+        {
+            EXPECT_STREQ(ex.what(), "Invalid JSON payload");
+        }
+
+        EXPECT_EQ(cache.GetStatistics().ValidationFailureHits, 1);
+    }
+
+    TEST(PolicyCacheTests, DeserializeFailureNotCached)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+
+        EXPECT_CALL(*serializerMock, Deserialize(_))
+            .Times(2)
+            .WillOnce(Throw(XSerialization("Data de-serialization failed")))
+            .WillOnce(Invoke(CreatePolicy));
+
+        PolicyCache cache(serializerMock, nullptr);
+
+        // Act -> Assert
+        EXPECT_THROW(cache.Deserialize("payload"), XSerialization);
+        EXPECT_NE(cache.Deserialize("payload"), nullptr);
+        EXPECT_EQ(cache.GetStatistics().EntryCount, 1);
+    }
+
+    TEST(PolicyCacheTests, DeserializeEvictsLeastRecentlyUsed)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+
+        EXPECT_CALL(*serializerMock, Deserialize(_))
+            .Times(4)
+            .WillRepeatedly(Invoke(CreatePolicy));
+
+        // Room for two entries only.
+        std::shared_ptr<JsonDataSerializerMock> sizingMock = std::make_shared<JsonDataSerializerMock>();
+        EXPECT_CALL(*sizingMock, Deserialize(_)).WillOnce(Invoke(CreatePolicy));
+
+        PolicyCache sizingCache(sizingMock, nullptr);
+        sizingCache.Deserialize("a");
+
+        PolicyCacheOptions options;
+        options.MaxBytes = 2 * sizingCache.GetStatistics().UsedBytes;
+
+        PolicyCache cache(serializerMock, nullptr, options);
+
+        // Act
+        cache.Deserialize("a");
+        cache.Deserialize("b");
+        cache.Deserialize("a");
+        cache.Deserialize("c");
+
+        // "b" was the least recently used one.
+        cache.Deserialize("a");
+        cache.Deserialize("b");
+
+        PolicyCacheStatistics statistics = cache.GetStatistics();
+
+        // Assert
+        EXPECT_EQ(statistics.Hits, 2);
+        EXPECT_EQ(statistics.Misses, 4);
+        EXPECT_EQ(statistics.Evictions, 2);
+        EXPECT_EQ(statistics.EntryCount, 2);
+        EXPECT_LE(statistics.UsedBytes, options.MaxBytes);
+    }
+
+    TEST(PolicyCacheTests, ClearSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+
+        EXPECT_CALL(*serializerMock, Deserialize(_))
+            .Times(2)
+            .WillRepeatedly(Invoke(CreatePolicy));
+
+        PolicyCache cache(serializerMock, nullptr);
+        std::shared_ptr<const TestDataTestPolicy> policy = cache.Deserialize("payload");
+
+        // Act
+        cache.Clear();
+
+        // Assert
+        EXPECT_EQ(cache.GetStatistics().EntryCount, 0);
+        EXPECT_EQ(cache.GetStatistics().UsedBytes, 0);
+        EXPECT_EQ(boost::variant2::get<std::string>(policy->Settings.at("payload").data), "payload");
+        EXPECT_NE(cache.Deserialize("payload"), policy);
+    }
+
+    TEST(PolicyCacheTests, EstimateSizeSuccessful)
+    {
+        // Arrange
+        const TestDataTestPolicy policy = CreatePolicy("a payload long enough for the heap of its string");
+
+        // Act
+        std::size_t size = PolicyCache::EstimateSize(policy);
+
+        // Assert, the estimate is the footprint of the policy.
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(policy);
+
+        EXPECT_EQ(size, report.InlineBytes + report.HeapBytes);
+        EXPECT_GT(size, sizeof(TestDataTestPolicy));
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,268 @@
+/*************************************************************************************************
+ * @file PolicyFileWatcherTests.cpp
+ *
+ * @brief Contains unit tests for class @ref PolicyFileWatcher.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "Internal/PolicyFileWatcher.hpp"
+#include "Internal/PolicySnapshotHolder.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidArgument.hpp"
+#include "Exceptions/XInvalidFormat.hpp"
+
+#include "Internal/Mocks/JsonDataSerializerMock.hpp"
+#include "Internal/Mocks/JsonDataValidatorMock.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Test;
+
+namespace bv2 = boost::variant2;
+namespace fs = std::filesystem;
+
+// #endregion
+
+// #region GTest usings
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @class PolicyFileWatcherTestFixture
+     *
+     * @brief Test fixture for PolicyFileWatcher, it provides a scratch directory and a holder whose policies
+     * hold the payload they were deserialized from.
+     */
+    class PolicyFileWatcherTestFixture : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            _directory = fs::path(::testing::TempDir()) /
+                         ("PolicyFileWatcherTests." + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+            fs::remove_all(_directory);
+            fs::create_directories(_directory);
+
+            _serializerMock = std::make_shared<NiceMock<JsonDataSerializerMock>>();
+            ON_CALL(*_serializerMock, Deserialize(_))
+                .WillByDefault(Invoke([](const std::string& payload)
+                                      {
+                                          TestDataTestPolicy policy;
+                                          policy.Settings["payload"].data = payload;
+                                          return policy; }));
+
+            _validatorMock = std::make_shared<NiceMock<JsonDataValidatorMock>>();
+            ON_CALL(*_validatorMock, Validate(_))
+                .WillByDefault(Invoke([](const std::string& payload)
+                                      {
+                                          if ("invalid" == payload)
+                                          {
+                                              throw XInvalidFormat("Invalid JSON payload");
+                                          } }));
+
+            _holder = std::make_shared<PolicySnapshotHolder>(_serializerMock, _validatorMock);
+        }
+
+        void TearDown() override
+        {
+            fs::remove_all(_directory);
+        }
+
+        std::string GetPolicyPath() const
+        {
+            return (_directory / "policy.json").string();
+        }
+
+        void WriteFile(const std::string& path, const std::string& content) const
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << content;
+        }
+
+        /**
+         * @brief Get the payload the current policy was deserialized from.
+         */
+        std::string GetPublishedPayload() const
+        {
+            const std::shared_ptr<const TestDataTestPolicy> policy = _holder->Get();
+            auto found = policy->Settings.find("payload");
+
+            return (policy->Settings.end() == found) ? std::string() : bv2::get<std::string>(found->second.data);
+        }
+
+        /**
+         * @brief Wait until a condition holds, up to a few seconds.
+         */
+        template <typename TCondition>
+        static bool WaitFor(TCondition condition)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+            while (!condition())
+            {
+                if (std::chrono::steady_clock::now() > deadline)
+                {
+                    return false;
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+
+            return true;
+        }
+
+        std::shared_ptr<PolicySnapshotHolder> GetHolder() const
+        {
+            return _holder;
+        }
+
+    private:
+        fs::path _directory;
+
+        std::shared_ptr<NiceMock<JsonDataSerializerMock>> _serializerMock;
+
+        std::shared_ptr<NiceMock<JsonDataValidatorMock>> _validatorMock;
+
+        std::shared_ptr<PolicySnapshotHolder> _holder;
+    };
+
+    // #region Unit Tests
+
+    TEST_F(PolicyFileWatcherTestFixture, ConstructorInvalidArgumentFailure)
+    {
+        // Arrange -> Act -> Assert
+        ASSERT_THROW(PolicyFileWatcher(GetPolicyPath(), nullptr, nullptr), XArgumentNull);
+        ASSERT_THROW(PolicyFileWatcher("/nonexistent-directory/policy.json", GetHolder(), nullptr), XInvalidArgument);
+    }
+
+    TEST_F(PolicyFileWatcherTestFixture, LoadOnStartSuccessful)
+    {
+        // Arrange
+        WriteFile(GetPolicyPath(), "first");
+
+        // Act
+        PolicyFileWatcher watcher(GetPolicyPath(), GetHolder(), nullptr);
+
+        // Assert
+        ASSERT_TRUE(WaitFor([&]
+                            { return watcher.GetStatistics().Reloads == 1; }));
+        EXPECT_EQ(GetPublishedPayload(), "first");
+    }
+
+    TEST_F(PolicyFileWatcherTestFixture, ReloadBurstDebounced)
+    {
+        // Arrange
+        PolicyFileWatcherOptions options;
+        options.DebounceMilliseconds = 50;
+        options.LoadOnStart = false;
+
+        PolicyFileWatcher watcher(GetPolicyPath(), GetHolder(), nullptr, options);
+
+        // Act
+        for (int write = 1; write <= 5; ++write)
+        {
+            WriteFile(GetPolicyPath(), "write " + std::to_string(write));
+        }
+
+        // Assert
+        ASSERT_TRUE(WaitFor([&]
+                            { return watcher.GetStatistics().Reloads > 0; }));
+
+        // Nothing else is pending.
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        PolicyFileWatcherStatistics statistics = watcher.GetStatistics();
+
+        EXPECT_EQ(statistics.Reloads, 1);
+        EXPECT_EQ(statistics.FailedReloads, 0);
+        EXPECT_GT(statistics.CoalescedEvents, 0);
+        EXPECT_GE(statistics.LastSwapLatencyNanoseconds, 50'000'000);
+        EXPECT_GE(statistics.LastSwapLatencyNanoseconds, statistics.LastReloadNanoseconds);
+        EXPECT_EQ(GetPublishedPayload(), "write 5");
+    }
+
+    TEST_F(PolicyFileWatcherTestFixture, ReloadRenamedFileSuccessful)
+    {
+        // Arrange
+        PolicyFileWatcherOptions options;
+        options.DebounceMilliseconds = 10;
+        options.LoadOnStart = false;
+
+        PolicyFileWatcher watcher(GetPolicyPath(), GetHolder(), nullptr, options);
+
+        // Act
+        WriteFile(GetPolicyPath() + ".tmp", "renamed");
+        fs::rename(GetPolicyPath() + ".tmp", GetPolicyPath());
+
+        // Assert
+        ASSERT_TRUE(WaitFor([&]
+                            { return GetPublishedPayload() == "renamed"; }));
+    }
+
+    TEST_F(PolicyFileWatcherTestFixture, ReloadInvalidFileKeepsPolicy)
+    {
+        // Arrange
+        std::atomic<int> invalidFormatCount{0};
+
+        PolicyFileWatcherOptions options;
+        options.DebounceMilliseconds = 10;
+
+        WriteFile(GetPolicyPath(), "valid");
+
+        PolicyFileWatcher watcher(GetPolicyPath(), GetHolder(), [&](const std::exception& error) noexcept
+                                  {
+                                      if (nullptr != dynamic_cast<const XInvalidFormat*>(&error))
+                                      {
+                                          ++invalidFormatCount;
+                                      } },
+                                  options);
+
+        ASSERT_TRUE(WaitFor([&]
+                            { return watcher.GetStatistics().Reloads == 1; }));
+
+        // Act
+        WriteFile(GetPolicyPath(), "invalid");
+
+        // Assert
+        ASSERT_TRUE(WaitFor([&]
+                            { return watcher.GetStatistics().FailedReloads == 1; }));
+        EXPECT_EQ(invalidFormatCount.load(), 1);
+        EXPECT_EQ(GetPublishedPayload(), "valid");
+        EXPECT_EQ(GetHolder()->GetVersion(), 2);
+    }
+
+    TEST_F(PolicyFileWatcherTestFixture, LoadOnStartMissingFileFailure)
+    {
+        // Arrange
+        std::atomic<int> errorCount{0};
+
+        // Act
+        PolicyFileWatcher watcher(GetPolicyPath(), GetHolder(), [&](const std::exception&) noexcept
+                                  { ++errorCount; });
+
+        // Assert
+        ASSERT_TRUE(WaitFor([&]
+                            { return errorCount.load() == 1; }));
+        EXPECT_EQ(watcher.GetStatistics().FailedReloads, 1);
+        EXPECT_EQ(GetHolder()->GetVersion(), 1);
+    }
+
+    // #endregion
+} // Anonymous namespace
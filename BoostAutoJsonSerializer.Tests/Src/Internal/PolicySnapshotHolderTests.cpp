@@ -0,0 +1,197 @@
+/*************************************************************************************************
+ * @file PolicySnapshotHolderTests.cpp
+ *
+ * @brief Contains unit tests for class @ref PolicySnapshotHolder.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "Internal/PolicySnapshotHolder.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidFormat.hpp"
+
+#include "Internal/Mocks/JsonDataSerializerMock.hpp"
+#include "Internal/Mocks/JsonDataValidatorMock.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Test;
+
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+// #region GTest usings
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Throw;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Build a policy whose two settings hold the same generation, a torn read would show two values.
+     */
+    std::shared_ptr<const TestDataTestPolicy> CreatePolicy(int64_t generation)
+    {
+        TestDataTestPolicy policy;
+        policy.Settings["first"].data = generation;
+        policy.Settings["second"].data = generation;
+
+        return std::make_shared<const TestDataTestPolicy>(std::move(policy));
+    }
+
+    // #region Unit Tests
+
+    TEST(PolicySnapshotHolderTests, ConstructorInvalidArgumentFailure)
+    {
+        // Arrange -> Act -> Assert
+        ASSERT_THROW(PolicySnapshotHolder(nullptr, nullptr), XArgumentNull);
+    }
+
+    TEST(PolicySnapshotHolderTests, GetInitialPolicySuccessful)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+
+        PolicySnapshotHolder emptyHolder(serializerMock, nullptr);
+        PolicySnapshotHolder holder(serializerMock, nullptr, CreatePolicy(7));
+
+        // Act -> Assert
+        ASSERT_NE(emptyHolder.Get(), nullptr);
+        EXPECT_TRUE(emptyHolder.Get()->Settings.empty());
+        EXPECT_EQ(bv2::get<int64_t>(holder.Get()->Settings.at("first").data), 7);
+        EXPECT_EQ(holder.GetVersion(), 1);
+    }
+
+    TEST(PolicySnapshotHolderTests, PublishSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+        PolicySnapshotHolder holder(serializerMock, nullptr, CreatePolicy(1));
+
+        std::shared_ptr<const TestDataTestPolicy> previous = holder.Get();
+
+        // Act
+        const uint64_t version = holder.Publish(CreatePolicy(2));
+
+        // Assert
+        EXPECT_EQ(version, 2);
+        EXPECT_EQ(holder.GetVersion(), 2);
+        EXPECT_EQ(bv2::get<int64_t>(holder.Get()->Settings.at("first").data), 2);
+
+        // Snapshots already read are immutable and stay valid.
+        EXPECT_EQ(bv2::get<int64_t>(previous->Settings.at("first").data), 1);
+
+        EXPECT_THROW(holder.Publish(std::shared_ptr<const TestDataTestPolicy>()), XArgumentNull);
+    }
+
+    TEST(PolicySnapshotHolderTests, PublishPayloadSuccessful)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+        std::shared_ptr<JsonDataValidatorMock> validatorMock = std::make_shared<JsonDataValidatorMock>();
+
+        EXPECT_CALL(*validatorMock, Validate(std::string("payload"))).Times(1);
+        EXPECT_CALL(*serializerMock, Deserialize(std::string("payload")))
+            .WillOnce(Return(*CreatePolicy(3)));
+
+        PolicySnapshotHolder holder(serializerMock, validatorMock);
+
+        // Act
+        const uint64_t version = holder.Publish(std::string("payload"));
+
+        // Assert
+        EXPECT_EQ(version, 2);
+        EXPECT_EQ(bv2::get<int64_t>(holder.Get()->Settings.at("second").data), 3);
+    }
+
+    TEST(PolicySnapshotHolderTests, PublishInvalidPayloadKeepsPolicy)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+        std::shared_ptr<JsonDataValidatorMock> validatorMock = std::make_shared<JsonDataValidatorMock>();
+
+        EXPECT_CALL(*validatorMock, Validate(_))
+            .WillOnce(Throw(XInvalidFormat("Invalid JSON payload")));
+        EXPECT_CALL(*serializerMock, Deserialize(_)).Times(0);
+
+        PolicySnapshotHolder holder(serializerMock, validatorMock, CreatePolicy(4));
+
+        // Act -> Assert
+        EXPECT_THROW(holder.Publish(std::string("{")), XInvalidFormat);
+        EXPECT_EQ(holder.GetVersion(), 1);
+        EXPECT_EQ(bv2::get<int64_t>(holder.Get()->Settings.at("first").data), 4);
+    }
+
+    TEST(PolicySnapshotHolderTests, ConcurrentReadersSuccessful)
+    {
+        // Arrange
+        constexpr std::size_t ReaderCount = 4;
+        constexpr int64_t GenerationCount = 200;
+
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<JsonDataSerializerMock>();
+        PolicySnapshotHolder holder(serializerMock, nullptr, CreatePolicy(0));
+
+        std::atomic<bool> done{false};
+        std::atomic<int> failureCount{0};
+        std::vector<std::thread> readers;
+
+        // Act
+        for (std::size_t readerIndex = 0; readerIndex < ReaderCount; ++readerIndex)
+        {
+            readers.emplace_back([&]()
+                                 {
+                                     int64_t lastGeneration = 0;
+
+                                     while (!done.load())
+                                     {
+                                         const std::shared_ptr<const TestDataTestPolicy> policy = holder.Get();
+
+                                         const int64_t first = bv2::get<int64_t>(policy->Settings.at("first").data);
+                                         const int64_t second = bv2::get<int64_t>(policy->Settings.at("second").data);
+
+                                         // Never torn, never older than a snapshot already seen.
+                                         if (first != second || first < lastGeneration)
+                                         {
+                                             ++failureCount;
+                                         }
+
+                                         lastGeneration = first;
+                                         std::this_thread::yield();
+                                     } });
+        }
+
+        for (int64_t generation = 1; generation <= GenerationCount; ++generation)
+        {
+            holder.Publish(CreatePolicy(generation));
+            std::this_thread::yield();
+        }
+
+        done = true;
+
+        for (std::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        // Assert
+        EXPECT_EQ(failureCount.load(), 0);
+        EXPECT_EQ(holder.GetVersion(), static_cast<uint64_t>(GenerationCount) + 1);
+        EXPECT_EQ(bv2::get<int64_t>(holder.Get()->Settings.at("first").data), GenerationCount);
+    }
+
+    // #endregion
+} // Anonymous namespace
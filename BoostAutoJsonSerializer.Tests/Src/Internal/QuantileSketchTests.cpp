@@ -0,0 +1,170 @@
+/*************************************************************************************************
+ * @file QuantileSketchTests.cpp
+ *
+ * @brief Contains unit tests for class @ref QuantileSketch.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+#include "Internal/QuantileSketch.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief The values 0 to count - 1 in a shuffled order.
+     */
+    std::vector<double> CreateShuffledValues(std::size_t count, unsigned int seed)
+    {
+        std::vector<double> values(count);
+        std::iota(values.begin(), values.end(), 0.0);
+        std::shuffle(values.begin(), values.end(), std::mt19937(seed));
+
+        return values;
+    }
+
+    // #region Unit Tests
+
+    TEST(QuantileSketchTests, ExactQuantilesSuccessful)
+    {
+        // Arrange
+        QuantileSketch sketch(256);
+
+        for (double value : CreateShuffledValues(100, 1))
+        {
+            sketch.Add(value + 1);
+        }
+
+        // Act -> Assert, nothing is compacted yet.
+        EXPECT_EQ(sketch.GetCount(), 100);
+        EXPECT_EQ(sketch.GetRetainedCount(), 100);
+        EXPECT_EQ(sketch.GetQuantile(0.0), 1);
+        EXPECT_EQ(sketch.GetQuantile(0.5), 50);
+        EXPECT_EQ(sketch.GetQuantile(0.95), 95);
+        EXPECT_EQ(sketch.GetQuantile(0.99), 99);
+        EXPECT_EQ(sketch.GetQuantile(1.0), 100);
+    }
+
+    TEST(QuantileSketchTests, ApproximateQuantilesSuccessful)
+    {
+        // Arrange
+        constexpr std::size_t count = 200000;
+        QuantileSketch sketch(256);
+
+        for (double value : CreateShuffledValues(count, 2))
+        {
+            sketch.Add(value);
+        }
+
+        // Act -> Assert, the values are their own ranks.
+        EXPECT_EQ(sketch.GetCount(), count);
+        EXPECT_LT(sketch.GetRetainedCount(), 256 * 16);
+
+        for (double rank : {0.01, 0.25, 0.5, 0.95, 0.99})
+        {
+            EXPECT_NEAR(sketch.GetQuantile(rank), rank * count, 0.01 * count) << "rank " << rank;
+        }
+    }
+
+    TEST(QuantileSketchTests, MergeSuccessful)
+    {
+        // Arrange
+        constexpr std::size_t count = 100000;
+        const std::vector<double> values = CreateShuffledValues(count, 3);
+
+        std::vector<QuantileSketch> parts(7, QuantileSketch(128));
+
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            parts[index % parts.size()].Add(values[index]);
+        }
+
+        // Act
+        QuantileSketch merged(128);
+
+        for (const QuantileSketch& part : parts)
+        {
+            merged.Merge(part);
+        }
+
+        // Assert
+        EXPECT_EQ(merged.GetCount(), count);
+        EXPECT_LT(merged.GetRetainedCount(), 128 * 16);
+
+        for (double rank : {0.5, 0.95, 0.99})
+        {
+            EXPECT_NEAR(merged.GetQuantile(rank), rank * count, 0.02 * count) << "rank " << rank;
+        }
+    }
+
+    TEST(QuantileSketchTests, MergeItselfSuccessful)
+    {
+        // Arrange
+        QuantileSketch sketch(16);
+
+        for (int value = 1; value <= 10; ++value)
+        {
+            sketch.Add(value);
+        }
+
+        // Act
+        sketch.Merge(sketch);
+
+        // Assert
+        EXPECT_EQ(sketch.GetCount(), 20);
+        EXPECT_EQ(sketch.GetQuantile(0.0), 1);
+        EXPECT_EQ(sketch.GetQuantile(1.0), 10);
+    }
+
+    TEST(QuantileSketchTests, ClearSuccessful)
+    {
+        // Arrange
+        QuantileSketch sketch(8);
+
+        for (int value = 0; value < 100; ++value)
+        {
+            sketch.Add(value);
+        }
+
+        // Act
+        sketch.Clear();
+
+        // Assert
+        EXPECT_EQ(sketch.GetCount(), 0);
+        EXPECT_EQ(sketch.GetRetainedCount(), 0);
+        EXPECT_TRUE(std::isnan(sketch.GetQuantile(0.5)));
+
+        sketch.Add(42);
+        EXPECT_EQ(sketch.GetQuantile(0.5), 42);
+    }
+
+    TEST(QuantileSketchTests, InvalidArgumentFailure)
+    {
+        // Arrange
+        QuantileSketch sketch(8);
+        sketch.Add(1);
+
+        // Act -> Assert
+        EXPECT_THROW(QuantileSketch(1), XInvalidArgument);
+        EXPECT_THROW(sketch.GetQuantile(-0.1), XInvalidArgument);
+        EXPECT_THROW(sketch.GetQuantile(1.1), XInvalidArgument);
+        EXPECT_THROW(sketch.GetQuantile(std::nan("")), XInvalidArgument);
+        EXPECT_THROW(sketch.Merge(QuantileSketch(16)), XInvalidArgument);
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,343 @@
+/*************************************************************************************************
+ * @file SerializationPipelineTests.cpp
+ *
+ * @brief Contains unit tests for class @ref SerializationPipeline.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Internal/SerializationPipeline.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+#include "Internal/Mocks/JsonDataSerializerMock.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Test;
+
+namespace bv2 = boost::variant2;
+
+// #endregion
+
+// #region GTest usings
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @class RecordingSink
+     *
+     * @brief A sink recording the documents, it can hold the pipeline thread within a write.
+     */
+    class RecordingSink : public ISerializedResultSink
+    {
+    public:
+        void Write(std::string&& payload) override
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _entered = true;
+            _condition.notify_all();
+            _condition.wait(lock, [this]
+                            { return !_held; });
+
+            _payloads.push_back(std::move(payload));
+        }
+
+        /**
+         * @brief Make the next writes wait until @ref Release is called.
+         */
+        void Hold()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _held = true;
+            _entered = false;
+        }
+
+        /**
+         * @brief Wait until the pipeline thread is within a write.
+         */
+        void WaitEntered()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this]
+                            { return _entered; });
+        }
+
+        void Release()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _held = false;
+            _condition.notify_all();
+        }
+
+        std::vector<std::string> GetPayloads()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _payloads;
+        }
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _held = false;
+        bool _entered = false;
+        std::vector<std::string> _payloads;
+    };
+
+    /**
+     * @brief Create monitor results carrying an identifier.
+     */
+    TestDataMonitorResults CreateResults(const std::string& id)
+    {
+        TestDataMonitorResults results;
+        results.OtherData["id"] = {id};
+
+        return results;
+    }
+
+    /**
+     * @class SerializationPipelineTestFixture
+     *
+     * @brief Test fixture for SerializationPipeline, the serializer writes the identifier of the results.
+     */
+    class SerializationPipelineTestFixture : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            _serializerMock = std::make_shared<NiceMock<JsonDataSerializerMock>>();
+            _sink = std::make_shared<RecordingSink>();
+
+            ON_CALL(*_serializerMock, Serialize(_))
+                .WillByDefault([](const TestDataTestResults& entity)
+                               {
+                                   const std::string& id = bv2::get<std::string>(entity.MonitorResults.at(0).OtherData.at("id").data);
+
+                                   if ("bad" == id)
+                                   {
+                                       throw XSerialization("Data serialization failed");
+                                   }
+
+                                   return id; });
+        }
+
+        std::unique_ptr<SerializationPipeline> CreatePipeline(std::size_t capacity, BackpressurePolicy backpressure)
+        {
+            SerializationPipelineOptions options;
+            options.QueueCapacity = capacity;
+            options.Backpressure = backpressure;
+
+            return std::make_unique<SerializationPipeline>(_serializerMock, _sink, options);
+        }
+
+        std::shared_ptr<RecordingSink> GetSink()
+        {
+            return _sink;
+        }
+
+    private:
+        std::shared_ptr<NiceMock<JsonDataSerializerMock>> _serializerMock;
+        std::shared_ptr<RecordingSink> _sink;
+    };
+
+    // #region Unit Tests
+
+    TEST_F(SerializationPipelineTestFixture, ConstructorInvalidArgumentFailure)
+    {
+        // Arrange
+        std::shared_ptr<JsonDataSerializerMock> serializerMock = std::make_shared<NiceMock<JsonDataSerializerMock>>();
+
+        // Act -> Assert
+        ASSERT_THROW(SerializationPipeline(nullptr, GetSink()), XArgumentNull);
+        ASSERT_THROW(SerializationPipeline(serializerMock, nullptr), XArgumentNull);
+    }
+
+    TEST_F(SerializationPipelineTestFixture, SubmitWritesInOrder)
+    {
+        // Arrange
+        std::unique_ptr<SerializationPipeline> pipeline = CreatePipeline(4, BackpressurePolicy::Block);
+
+        // Act
+        for (int index = 0; index < 100; ++index)
+        {
+            ASSERT_TRUE(pipeline->Submit(CreateResults(std::to_string(index))));
+        }
+
+        pipeline->Flush();
+
+        // Assert
+        std::vector<std::string> payloads = GetSink()->GetPayloads();
+        ASSERT_EQ(payloads.size(), 100);
+
+        for (int index = 0; index < 100; ++index)
+        {
+            EXPECT_EQ(payloads[static_cast<std::size_t>(index)], std::to_string(index));
+        }
+
+        SerializationPipelineStatistics statistics = pipeline->GetStatistics();
+        EXPECT_EQ(statistics.QueueCapacity, 4);
+        EXPECT_EQ(statistics.Submitted, 100);
+        EXPECT_EQ(statistics.Written, 100);
+        EXPECT_LE(statistics.MaxQueueDepth, 4);
+    }
+
+    TEST_F(SerializationPipelineTestFixture, BlockWaitsForRoom)
+    {
+        // Arrange
+        std::unique_ptr<SerializationPipeline> pipeline = CreatePipeline(2, BackpressurePolicy::Block);
+
+        GetSink()->Hold();
+        pipeline->Submit(CreateResults("0"));
+        GetSink()->WaitEntered();
+
+        // Act
+        std::thread producer([&pipeline]()
+                             {
+                                 for (int index = 1; index < 6; ++index)
+                                 {
+                                     pipeline->Submit(CreateResults(std::to_string(index)));
+                                 } });
+
+        while (0 == pipeline->GetStatistics().ProducerWaits)
+        {
+            std::this_thread::yield();
+        }
+
+        GetSink()->Release();
+        producer.join();
+        pipeline->Flush();
+
+        // Assert
+        EXPECT_EQ(GetSink()->GetPayloads(), (std::vector<std::string>{"0", "1", "2", "3", "4", "5"}));
+        EXPECT_EQ(pipeline->GetStatistics().MaxQueueDepth, 2);
+    }
+
+    TEST_F(SerializationPipelineTestFixture, DropOldestKeepsNewest)
+    {
+        // Arrange
+        std::unique_ptr<SerializationPipeline> pipeline = CreatePipeline(2, BackpressurePolicy::DropOldest);
+
+        GetSink()->Hold();
+        pipeline->Submit(CreateResults("0"));
+        GetSink()->WaitEntered();
+
+        // Act
+        for (int index = 1; index < 10; ++index)
+        {
+            ASSERT_TRUE(pipeline->Submit(CreateResults(std::to_string(index))));
+        }
+
+        GetSink()->Release();
+        pipeline->Flush();
+
+        // Assert
+        EXPECT_EQ(GetSink()->GetPayloads(), (std::vector<std::string>{"0", "8", "9"}));
+
+        SerializationPipelineStatistics statistics = pipeline->GetStatistics();
+        EXPECT_EQ(statistics.Submitted, 10);
+        EXPECT_EQ(statistics.Dropped, 7);
+        EXPECT_EQ(statistics.Written, 3);
+    }
+
+    TEST_F(SerializationPipelineTestFixture, FailFastRejectsWithoutTakingResults)
+    {
+        // Arrange
+        std::unique_ptr<SerializationPipeline> pipeline = CreatePipeline(2, BackpressurePolicy::FailFast);
+
+        GetSink()->Hold();
+        pipeline->Submit(CreateResults("0"));
+        GetSink()->WaitEntered();
+
+        ASSERT_TRUE(pipeline->Submit(CreateResults("1")));
+        ASSERT_TRUE(pipeline->Submit(CreateResults("2")));
+
+        TestDataMonitorResults rejectedResults = CreateResults("3");
+
+        // Act
+        bool accepted = pipeline->Submit(std::move(rejectedResults));
+
+        GetSink()->Release();
+        pipeline->Flush();
+
+        // Assert
+        EXPECT_FALSE(accepted);
+        EXPECT_EQ(rejectedResults.OtherData.size(), 1);
+        EXPECT_EQ(GetSink()->GetPayloads(), (std::vector<std::string>{"0", "1", "2"}));
+        EXPECT_EQ(pipeline->GetStatistics().Rejected, 1);
+    }
+
+    TEST_F(SerializationPipelineTestFixture, SerializationFailureCounted)
+    {
+        // Arrange
+        std::unique_ptr<SerializationPipeline> pipeline = CreatePipeline(4, BackpressurePolicy::Block);
+
+        // Act
+        pipeline->Submit(CreateResults("first"));
+        pipeline->Submit(CreateResults("bad"));
+        pipeline->Submit(CreateResults("last"));
+        pipeline->Flush();
+
+        // Assert
+        EXPECT_EQ(GetSink()->GetPayloads(), (std::vector<std::string>{"first", "last"}));
+        EXPECT_EQ(pipeline->GetStatistics().Failed, 1);
+    }
+
+    TEST_F(SerializationPipelineTestFixture, ConcurrentProducersAllWritten)
+    {
+        // Arrange
+        constexpr int ProducerCount = 4;
+        constexpr int ResultCount = 500;
+
+        std::unique_ptr<SerializationPipeline> pipeline = CreatePipeline(8, BackpressurePolicy::Block);
+        std::vector<std::thread> producers;
+
+        // Act
+        for (int producer = 0; producer < ProducerCount; ++producer)
+        {
+            producers.emplace_back([&pipeline, producer]()
+                                   {
+                                       for (int index = 0; index < ResultCount; ++index)
+                                       {
+                                           pipeline->Submit(CreateResults(std::to_string(producer) + ":" + std::to_string(index)));
+                                       } });
+        }
+
+        for (std::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        pipeline.reset();
+
+        // Assert
+        std::vector<std::string> payloads = GetSink()->GetPayloads();
+        ASSERT_EQ(payloads.size(), ProducerCount * ResultCount);
+
+        std::vector<int> nextIndexes(ProducerCount, 0);
+
+        for (const std::string& payload : payloads)
+        {
+            const std::size_t separator = payload.find(':');
+            const std::size_t producer = std::stoul(payload.substr(0, separator));
+
+            EXPECT_EQ(std::stoi(payload.substr(separator + 1)), nextIndexes[producer]++);
+        }
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -0,0 +1,147 @@
+/*************************************************************************************************
+ * @file SerializedSizeCalculatorTests.cpp
+ *
+ * @brief Contains unit tests for class @ref SerializedSizeCalculator.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <array>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+
+#include "Internal/JsonValueWriter.hpp"
+#include "Internal/SerializedSizeCalculator.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Serialize the element the same way the serializer does.
+     */
+    template <typename TElement>
+    std::string Write(const TElement& element)
+    {
+        return JsonValueWriter::Write(bj::value_from(element));
+    }
+
+    /**
+     * @brief Create metrics holding every alternative of @ref SerializationVariant, with their edge values.
+     */
+    TestDataMetrics CreateEdgeValueMetrics()
+    {
+        TestDataMetrics metrics;
+
+        metrics.MetricData["string"] = {std::string("quote \" backslash \\ control \x01 newline \n")};
+        metrics.MetricData["empty_string"] = {std::string()};
+        metrics.MetricData["key \"escaped\"\t"] = {std::string("value")};
+        metrics.MetricData["true"] = {true};
+        metrics.MetricData["false"] = {false};
+        metrics.MetricData["float"] = {123.45f};
+        metrics.MetricData["float_integral"] = {2.0f};
+        metrics.MetricData["float_max"] = {std::numeric_limits<float>::max()};
+        metrics.MetricData["float_infinity"] = {std::numeric_limits<float>::infinity()};
+        metrics.MetricData["float_nan"] = {std::numeric_limits<float>::quiet_NaN()};
+        metrics.MetricData["int8"] = {std::numeric_limits<int8_t>::min()};
+        metrics.MetricData["int16"] = {std::numeric_limits<int16_t>::min()};
+        metrics.MetricData["int32"] = {std::numeric_limits<int32_t>::min()};
+        metrics.MetricData["int64"] = {std::numeric_limits<int64_t>::min()};
+        metrics.MetricData["uint8"] = {std::numeric_limits<uint8_t>::max()};
+        metrics.MetricData["uint16"] = {std::numeric_limits<uint16_t>::max()};
+        metrics.MetricData["uint32"] = {std::numeric_limits<uint32_t>::max()};
+        metrics.MetricData["uint64"] = {std::numeric_limits<uint64_t>::max()};
+        metrics.MetricData["zero"] = {int32_t{0}};
+        metrics.MetricData["enum"] = {EnumName{"Enumerator"}};
+
+        return metrics;
+    }
+
+    // #region Unit Tests
+
+    TEST(SerializedSizeCalculatorTests, CalculateEmptyResults)
+    {
+        // Arrange
+        TestDataTestResults testResults;
+
+        // Act
+        std::size_t size = SerializedSizeCalculator::Calculate(testResults);
+
+        // Assert
+        EXPECT_EQ(size, Write(testResults).size());
+    }
+
+    TEST(SerializedSizeCalculatorTests, CalculateEdgeValues)
+    {
+        // Arrange
+        TestDataMetrics metrics = CreateEdgeValueMetrics();
+
+        // Act
+        std::size_t size = SerializedSizeCalculator::Calculate(metrics);
+
+        // Assert
+        EXPECT_EQ(size, Write(metrics).size());
+    }
+
+    TEST(SerializedSizeCalculatorTests, CalculateNestedResults)
+    {
+        // Arrange
+        TestDataTestResults testResults;
+        testResults.OtherData["run"] = {std::string("nightly")};
+
+        for (int monitorIndex = 0; monitorIndex < 3; ++monitorIndex)
+        {
+            TestDataMonitorResults monitorResults;
+            monitorResults.OtherData["index"] = {monitorIndex};
+
+            for (int stepIndex = 0; stepIndex < monitorIndex; ++stepIndex)
+            {
+                TestDataStepResults stepResults;
+                stepResults.Metrics.push_back(CreateEdgeValueMetrics());
+                stepResults.Metrics.emplace_back();
+                stepResults.PageResults["url"] = {std::string("https://example.com/?a=b&c=\"d\"")};
+
+                monitorResults.StepResults.push_back(stepResults);
+            }
+
+            testResults.MonitorResults.push_back(monitorResults);
+        }
+
+        // Act
+        std::size_t size = SerializedSizeCalculator::Calculate(testResults);
+
+        // Assert
+        EXPECT_EQ(size, Write(testResults).size());
+    }
+
+    TEST(SerializedSizeCalculatorTests, CalculatePlainMembers)
+    {
+        // Arrange
+        const std::string text = "quote \" and newline \n";
+        const std::array<int32_t, 3> numbers = {-1, 0, std::numeric_limits<int32_t>::max()};
+        const std::unordered_map<std::string, double> ratios = {{"half", 0.5}, {"third", 1.0 / 3}};
+        const std::optional<uint64_t> present = std::numeric_limits<uint64_t>::max();
+        const std::optional<uint64_t> absent;
+
+        // Act -> Assert
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(text), Write(text).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(true), Write(true).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(-2.25f), Write(-2.25f).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(std::numeric_limits<int64_t>::min()),
+                  Write(std::numeric_limits<int64_t>::min()).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(numbers), Write(numbers).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(ratios), Write(ratios).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(present), Write(*present).size());
+        EXPECT_EQ(SerializedSizeCalculator::Calculate(absent), Write(nullptr).size());
+    }
+
+    // #endregion
+} // Anonymous namespace
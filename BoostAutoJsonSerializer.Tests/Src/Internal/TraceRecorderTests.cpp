@@ -0,0 +1,191 @@
+/*************************************************************************************************
+ * @file TraceRecorderTests.cpp
+ *
+ * @brief Contains unit tests for classes @ref TraceRecorder and @ref TraceScope.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <thread>
+
+#include "Internal/TraceRecorder.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+namespace bj = boost::json;
+
+// #endregion
+
+namespace
+{
+    // #region Unit Tests
+
+    TEST(TraceRecorderTests, FlushSuccessful)
+    {
+        // Arrange
+        constexpr std::size_t ThreadCount = 3;
+        constexpr std::size_t EventCount = 10;
+
+        TraceRecorder recorder;
+        std::vector<std::thread> threads;
+
+        // The threads are kept running until the flush, each one has its own ring.
+        std::atomic<std::size_t> recordedCount{0};
+        std::promise<void> flushed;
+        std::shared_future<void> flushedFuture = flushed.get_future().share();
+
+        for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&recorder, &recordedCount, flushedFuture]()
+                                 {
+                                     for (std::size_t event = 0; event < EventCount; ++event)
+                                     {
+                                         TraceScope scope(&recorder, "Tests", "Phase");
+                                         scope.SetBytes(42);
+                                     }
+
+                                     ++recordedCount;
+                                     flushedFuture.wait(); });
+        }
+
+        while (recordedCount.load() < ThreadCount)
+        {
+            std::this_thread::yield();
+        }
+
+        // Act
+        bj::value trace = bj::parse(recorder.Flush());
+
+        flushed.set_value();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Assert
+        const bj::array& events = trace.at("traceEvents").as_array();
+        ASSERT_EQ(events.size(), ThreadCount * EventCount);
+
+        std::set<int64_t> threadIds;
+
+        for (const bj::value& event : events)
+        {
+            EXPECT_EQ(event.at("name").as_string(), "Phase");
+            EXPECT_EQ(event.at("cat").as_string(), "Tests");
+            EXPECT_EQ(event.at("ph").as_string(), "X");
+            EXPECT_EQ(event.at("args").at("bytes").to_number<int64_t>(), 42);
+            EXPECT_GE(event.at("dur").to_number<double>(), 0.0);
+
+            threadIds.insert(event.at("tid").to_number<int64_t>());
+        }
+
+        EXPECT_EQ(threadIds.size(), ThreadCount);
+        EXPECT_EQ(trace.at("otherData").at("droppedEvents").to_number<int64_t>(), 0);
+
+        // The events are taken out by the flush.
+        EXPECT_TRUE(bj::parse(recorder.Flush()).at("traceEvents").as_array().empty());
+    }
+
+    TEST(TraceRecorderTests, FlushExitedThreadsSuccessful)
+    {
+        // Arrange
+        constexpr std::size_t ThreadCount = 3;
+        constexpr std::size_t EventCount = 10;
+
+        TraceRecorder recorder;
+        std::vector<std::thread> threads;
+
+        for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&recorder]()
+                                 {
+                                     for (std::size_t event = 0; event < EventCount; ++event)
+                                     {
+                                         TraceScope scope(&recorder, "Tests", "Phase");
+                                     } });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Act
+        bj::value trace = bj::parse(recorder.Flush());
+
+        // Assert, the events outlive their threads in the retired ring.
+        const bj::array& events = trace.at("traceEvents").as_array();
+        EXPECT_EQ(events.size(), ThreadCount * EventCount);
+        EXPECT_EQ(trace.at("otherData").at("droppedEvents").to_number<int64_t>(), 0);
+        EXPECT_TRUE(bj::parse(recorder.Flush()).at("traceEvents").as_array().empty());
+    }
+
+    TEST(TraceRecorderTests, RingFullDropsEvents)
+    {
+        // Arrange
+        TraceRecorder recorder;
+        const TraceRecorder::Clock::time_point now = TraceRecorder::Clock::now();
+
+        // Act
+        for (std::size_t event = 0; event < TraceRecorder::RingCapacity + 5; ++event)
+        {
+            recorder.Record("Tests", "Phase", now, now, 0);
+        }
+
+        bj::value trace = bj::parse(recorder.Flush());
+
+        // Assert
+        EXPECT_EQ(recorder.GetDroppedEventCount(), 5);
+        EXPECT_EQ(trace.at("traceEvents").as_array().size(), TraceRecorder::RingCapacity);
+
+        // The flush made room again.
+        recorder.Record("Tests", "Phase", now, now, 0);
+        EXPECT_EQ(recorder.GetDroppedEventCount(), 5);
+    }
+
+    TEST(TraceRecorderTests, FlushToFileSuccessful)
+    {
+        // Arrange
+        const std::string path = ::testing::TempDir() + "TraceRecorderTests.json";
+
+        TraceRecorder recorder;
+        {
+            TraceScope scope(&recorder, "Tests", "Phase");
+        }
+
+        // Act
+        recorder.FlushToFile(path);
+
+        // Assert
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+
+        EXPECT_EQ(bj::parse(content.str()).at("traceEvents").as_array().size(), 1);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(TraceRecorderTests, FlushToFileInvalidPathFailure)
+    {
+        // Arrange
+        TraceRecorder recorder;
+
+        // Act -> Assert
+        EXPECT_THROW(recorder.FlushToFile("/nonexistent-directory/trace.json"), XInvalidArgument);
+    }
+
+    // #endregion
+} // Anonymous namespace
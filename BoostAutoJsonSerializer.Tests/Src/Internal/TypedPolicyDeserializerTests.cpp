@@ -0,0 +1,231 @@
+/*************************************************************************************************
+ * @file TypedPolicyDeserializerTests.cpp
+ *
+ * @brief Contains unit tests for class @ref TypedPolicyDeserializer.
+ *
+ *************************************************************************************************/
+
+#include "CommonTestsConfig.hpp"
+
+#include "Internal/TypedPolicyDeserializer.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    // #region Typed Policies
+
+    enum class TypedBrowser
+    {
+        Chrome,
+        Firefox
+    };
+
+    BOOST_DESCRIBE_ENUM(TypedBrowser, Chrome, Firefox)
+
+    struct TypedCapabilities
+    {
+        bool Screenshots;
+        uint16_t MaxTabs;
+        std::optional<TypedBrowser> Browser;
+    };
+
+    BOOST_DESCRIBE_STRUCT(TypedCapabilities, (), (Screenshots, MaxTabs, Browser))
+
+    struct TypedSettings
+    {
+        int64_t Offset;
+        uint64_t Timeout;
+        double Ratio;
+        std::string Url;
+        std::optional<int32_t> Retries;
+    };
+
+    BOOST_DESCRIBE_STRUCT(TypedSettings, (), (Offset, Timeout, Ratio, Url, Retries))
+
+    struct TypedPolicy
+    {
+        TypedCapabilities Capabilities;
+        TypedSettings Settings;
+    };
+
+    BOOST_DESCRIBE_STRUCT(TypedPolicy, (), (Capabilities, Settings))
+
+    // #endregion
+
+    // #region Unit Tests
+
+    TEST(TypedPolicyDeserializerTests, DeserializeSuccessful)
+    {
+        // Arrange
+        const std::string payload = R"({
+                                        "Capabilities": {"Screenshots": true, "MaxTabs": 8},
+                                        "Settings": {
+                                            "Offset": -12,
+                                            "Timeout": 18446744073709551615,
+                                            "Ratio": 2,
+                                            "Url": "https://example.com/page",
+                                            "Retries": 3,
+                                            "Unknown": "ignored"
+                                        }
+                                    })";
+
+        // Act
+        TypedPolicy policy = TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload);
+
+        // Assert
+        EXPECT_TRUE(policy.Capabilities.Screenshots);
+        EXPECT_EQ(policy.Capabilities.MaxTabs, 8);
+        EXPECT_EQ(policy.Settings.Offset, -12);
+        EXPECT_EQ(policy.Settings.Timeout, std::numeric_limits<uint64_t>::max());
+        EXPECT_DOUBLE_EQ(policy.Settings.Ratio, 2.0);
+        EXPECT_EQ(policy.Settings.Url, "https://example.com/page");
+        ASSERT_TRUE(policy.Settings.Retries.has_value());
+        EXPECT_EQ(*policy.Settings.Retries, 3);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeOptionalMissingSuccessful)
+    {
+        // Arrange
+        TypedPolicy policy{};
+        policy.Settings.Retries = 5;
+
+        const std::string payload = R"({"Capabilities": {"Screenshots": false, "MaxTabs": 1},
+                                        "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 0.5, "Url": ""}})";
+
+        // Act
+        TypedPolicyDeserializer::Deserialize(payload, policy);
+
+        // Assert
+        EXPECT_FALSE(policy.Settings.Retries.has_value());
+        EXPECT_DOUBLE_EQ(policy.Settings.Ratio, 0.5);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeOptionalNullSuccessful)
+    {
+        // Arrange
+        TypedPolicy policy{};
+        policy.Capabilities.Browser = TypedBrowser::Chrome;
+        policy.Settings.Retries = 5;
+
+        const std::string payload = R"({"Capabilities": {"Screenshots": false, "MaxTabs": 1, "Browser": null},
+                                        "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 1, "Url": "", "Retries": null}})";
+
+        // Act
+        TypedPolicyDeserializer::Deserialize(payload, policy);
+
+        // Assert
+        EXPECT_FALSE(policy.Capabilities.Browser.has_value());
+        EXPECT_FALSE(policy.Settings.Retries.has_value());
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeEnumSuccessful)
+    {
+        // Arrange
+        const std::string payload = R"({"Capabilities": {"Screenshots": true, "MaxTabs": 2, "Browser": "Firefox"},
+                                        "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 1, "Url": ""}})";
+
+        // Act
+        TypedPolicy policy = TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload);
+
+        // Assert
+        ASSERT_TRUE(policy.Capabilities.Browser.has_value());
+        EXPECT_EQ(*policy.Capabilities.Browser, TypedBrowser::Firefox);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeUnknownEnumFailure)
+    {
+        // Arrange
+        const std::string payload = R"({"Capabilities": {"Screenshots": true, "MaxTabs": 2, "Browser": "Safari"},
+                                        "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 1, "Url": ""}})";
+
+        // Act -> Assert
+        EXPECT_THROW(TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload), XSerialization);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeAggregatedFailure)
+    {
+        // Arrange
+        const std::string payload = R"({"Capabilities": {"Screenshots": 1, "MaxTabs": 70000},
+                                        "Settings": {"Offset": 1.5, "Timeout": -1, "Url": 42}})";
+
+        // Act
+        std::string message;
+
+        try
+        {
+            TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload);
+        }
+        catch (const XSerialization& ex)
+        {
+            message = ex.what();
+        }
+
+        // Assert: every problem is reported, by its path.
+        EXPECT_NE(message.find("Capabilities.Screenshots: expected a boolean"), std::string::npos);
+        EXPECT_NE(message.find("Capabilities.MaxTabs: number out of range"), std::string::npos);
+        EXPECT_NE(message.find("Settings.Offset: number out of range or not exact"), std::string::npos);
+        EXPECT_NE(message.find("Settings.Timeout: number out of range"), std::string::npos);
+        EXPECT_NE(message.find("Settings.Ratio: missing"), std::string::npos);
+        EXPECT_NE(message.find("Settings.Url: expected a string"), std::string::npos);
+        EXPECT_EQ(message.find("Retries"), std::string::npos);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeInvalidPayloadFailure)
+    {
+        // Arrange -> Act -> Assert
+        EXPECT_THROW(TypedPolicyDeserializer::Deserialize<TypedPolicy>("{\"Capabilities\": "), XSerialization);
+        EXPECT_THROW(TypedPolicyDeserializer::Deserialize<TypedPolicy>("[]"), XSerialization);
+        EXPECT_THROW(TypedPolicyDeserializer::Deserialize<TypedPolicy>(R"({"Capabilities": []})"), XSerialization);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeWithConfigurationSuccessful)
+    {
+        // Arrange
+        const std::string payload = R"({"Capabilities": {"Screenshots": true, "MaxTabs": 2}, // Allowed
+                                        "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 1, "Url": "short"}})";
+
+        JsonParseConfiguration configuration;
+        configuration.AllowComments = true;
+
+        JsonParseConfiguration stringLimited = configuration;
+        stringLimited.MaxStringLength = 4;
+
+        // Act
+        TypedPolicy policy = TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload, configuration);
+
+        // Assert
+        EXPECT_EQ(policy.Settings.Url, "short");
+        EXPECT_THROW(TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload), XSerialization);
+        EXPECT_THROW(TypedPolicyDeserializer::Deserialize<TypedPolicy>(payload, stringLimited), XSerialization);
+    }
+
+    TEST(TypedPolicyDeserializerTests, DeserializeWithParserSuccessful)
+    {
+        // Arrange
+        LimitedJsonParser parser(JsonParseConfiguration{});
+        TypedPolicy policy{};
+
+        // Act
+        TypedPolicyDeserializer::Deserialize(R"({"Capabilities": {"Screenshots": true, "MaxTabs": 2},
+                                                 "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 1, "Url": "a"}})",
+                                             policy, parser);
+        TypedPolicyDeserializer::Deserialize(R"({"Capabilities": {"Screenshots": false, "MaxTabs": 3},
+                                                 "Settings": {"Offset": 0, "Timeout": 1, "Ratio": 1, "Url": "b"}})",
+                                             policy, parser);
+
+        // Assert: the parser is reset from one document to the next.
+        EXPECT_FALSE(policy.Capabilities.Screenshots);
+        EXPECT_EQ(policy.Capabilities.MaxTabs, 3);
+        EXPECT_EQ(policy.Settings.Url, "b");
+    }
+
+    // #endregion
+} // Anonymous namespace
@@ -46,10 +46,29 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
         -Wsuggest-override
         -Wuseless-cast
     )
+
+    ############################################################################
+    # Sanitizers
+    ############################################################################
+    option(BOOST_AUTO_JSON_SERIALIZER_ENABLE_TSAN "Build with the thread sanitizer" OFF)
+
+    if(BOOST_AUTO_JSON_SERIALIZER_ENABLE_TSAN)
+        add_compile_options(-fsanitize=thread -g)
+        add_link_options(-fsanitize=thread)
+    endif()
 else()
     message(FATAL_ERROR "compiler not supported")
 endif()
 
+################################################################################
+# Optional features
+################################################################################
+option(BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD "Build the zstd format of the compressing sink" OFF)
+
+if(BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD)
+    add_compile_definitions(BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD)
+endif()
+
 ################################################################################
 # Output
 ################################################################################
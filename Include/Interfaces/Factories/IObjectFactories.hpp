@@ -13,6 +13,7 @@
 #include "Interfaces/Factories/IGenericObjectFactoryT.hpp"
 
 #include "Interfaces/IProgram.hpp"
+#include "Interfaces/IJsonBulkDeserializer.hpp"
 #include "Interfaces/IJsonDataSerializer.hpp"
 #include "Interfaces/IJsonDataSerializerImpl.hpp"
 #include "Interfaces/IJsonDataValidator.hpp"
@@ -58,6 +59,13 @@ namespace FactoryInterfaces
      */
     using IJsonDataValidatorImplFactory = IGenericObjectFactoryT<Interfaces::IJsonDataValidatorImpl>;
 
+    /**
+     * @interface IJsonBulkDeserializerFactory
+     *
+     * @brief Factory interface for concrete classes that implements @ref IJsonBulkDeserializer.
+     */
+    using IJsonBulkDeserializerFactory = IGenericObjectFactoryT<Interfaces::IJsonBulkDeserializer>;
+
     // #endregion
 
 } // namespace FactoryInterfaces
@@ -0,0 +1,45 @@
+/*************************************************************************************************
+ * @file IChunkSink.hpp
+ *
+ * @brief Interface to define member contracts of a destination of serialized json written in chunks.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ICHUNKSINK_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ICHUNKSINK_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string_view>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IChunkSink
+     *
+     * @brief Interface to define member contracts of a destination the serializer writes into chunk by chunk, so
+     * that a large document never has to be held as a whole.
+     */
+    interface IChunkSink
+    {
+        DECLARE_INTERFACE_DEFAULTS(IChunkSink)
+
+        /**
+         * @brief Write the next chunk of output.
+         *
+         * @param[in] chunk The bytes of the chunk, only valid during the call.
+         */
+        virtual void Write(std::string_view chunk) = 0;
+
+        /**
+         * @brief Signal the end of the output, the sink flushes whatever it still buffers.
+         *
+         * It is called by the owner of the sink once the last document has been written, never by the serializer,
+         * so that several documents can be written into the same sink.
+         */
+        virtual void Finish() = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ICHUNKSINK_HPP
@@ -0,0 +1,41 @@
+/*************************************************************************************************
+ * @file IExecutor.hpp
+ *
+ * @brief Interface to define member contracts of an executor running tasks off the calling thread.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IEXECUTOR_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IEXECUTOR_HPP
+
+#include "CommonConfig.hpp"
+
+#include <functional>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IExecutor
+     *
+     * @brief Interface to define member contracts of an executor, it lets the callers plug their own event loop or
+     * thread pool into the asynchronous operations.
+     */
+    interface IExecutor
+    {
+        DECLARE_INTERFACE_DEFAULTS(IExecutor)
+
+        /**
+         * @brief Queue a task for execution.
+         *
+         * The task must eventually run exactly once, it never throws.
+         *
+         * @param[in] task The task to be executed.
+         *
+         * @throw XArgumentNull If the task is empty.
+         */
+        virtual void Post(std::function<void()> task) = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IEXECUTOR_HPP
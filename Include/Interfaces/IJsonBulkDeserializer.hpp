@@ -0,0 +1,42 @@
+/*************************************************************************************************
+ * @file IJsonBulkDeserializer.hpp
+ *
+ * @brief Interface to define member contracts to de-serialize multi-document JSON streams.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IJSONBULKDESERIALIZER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IJSONBULKDESERIALIZER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IJsonBulkDeserializer
+     *
+     * @brief Interface to define member contracts and operations to de-serialize a stream of policy documents.
+     */
+    interface IJsonBulkDeserializer
+    {
+        DECLARE_INTERFACE_DEFAULTS(IJsonBulkDeserializer)
+
+        /**
+         * @brief De-serialize every document of the stream.
+         *
+         * A document that fails to de-serialize is reported in its record, it does not abort the batch.
+         *
+         * @param[in] stream Newline delimited or concatenated JSON documents.
+         * @param[in] framing How the documents are delimited within the stream.
+         *
+         * @return One record per document, in stream order.
+         */
+        virtual std::vector<Internal::TestDataPolicyRecord> DeserializeAll(const std::string& stream,
+                                                                           Internal::JsonStreamFraming framing) = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IJSONBULKDESERIALIZER_HPP
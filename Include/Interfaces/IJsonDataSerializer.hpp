@@ -8,6 +8,10 @@
 
 #include "CommonConfig.hpp"
 
+#include <future>
+
+#include "Interfaces/IChunkSink.hpp"
+#include "Interfaces/IPerformanceCounters.hpp"
 #include "Internal/SerializableDataModels.hpp"
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -17,8 +21,11 @@ namespace Interfaces
      * @interface IJsonDataSerializer
      *
      * @brief Interface to define member contracts and operations to serialize/de-serialize .
+     *
+     * The instances created by the object factory are thread safe, one instance can be shared by all the threads.
+     * The serializations and de-serializations are counted, see @ref IPerformanceCounters.
      */
-    interface IJsonDataSerializer
+    interface IJsonDataSerializer : public IPerformanceCounters
     {
         DECLARE_INTERFACE_DEFAULTS(IJsonDataSerializer)
 
@@ -33,6 +40,36 @@ namespace Interfaces
          */
         virtual Internal::TestDataTestPolicy Deserialize(const std::string& payload) = 0;
 
+        /**
+         * @brief Deserialize the stringified JSON into an existing data entity, reusing the memory it owns.
+         *
+         * The map nodes and the string capacity of the entity are reused, so deserializing policies of the same
+         * shape again and again into the same entity allocates almost nothing.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in,out] policy The entity to fill, its content is unspecified if an exception is thrown.
+         *
+         * @throw XSerialization If deserialization failed due to any reason.
+         */
+        virtual void Deserialize(const std::string& payload, Internal::TestDataTestPolicy& policy) = 0;
+
+        /**
+         * @brief Deserialize the stringified JSON into a policy allocated from a memory resource.
+         *
+         * The maps, the keys and the strings of the policy are allocated from the resource, e.g. a
+         * std::pmr::monotonic_buffer_resource releasing them all at once. The resource must outlive the policy.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in] resource The memory resource of the policy.
+         *
+         * @return A data entity allocated from the resource.
+         *
+         * @throw XArgumentNull If the resource is null.
+         * @throw XSerialization If deserialization failed due to any reason.
+         */
+        virtual Internal::PmrTestDataTestPolicy Deserialize(const std::string& payload,
+                                                            std::pmr::memory_resource* resource) = 0;
+
         /**
          * @brief Serialize the provided input structures to stringified json.
          *
@@ -43,6 +80,49 @@ namespace Interfaces
          * @throw XSerialization If serialization failed due to any reason.
          */
         virtual std::string Serialize(const Internal::TestDataTestResults& entity) = 0;
+
+        /**
+         * @brief Serialize the provided data filled structure into a sink, chunk by chunk.
+         *
+         * The stringified json is handed over to the sink while it is produced, the whole text is never held in
+         * memory. The sink is not finished, more documents may follow.
+         *
+         * @param[in] entity Test result data entity.
+         * @param[in,out] sink The destination of the stringified json, e.g. a @ref CompressingChunkSink.
+         *
+         * @throw XSerialization If serialization failed due to any reason, the sink may have received a part of
+         * the document.
+         */
+        virtual void Serialize(const Internal::TestDataTestResults& entity, IChunkSink& sink) = 0;
+
+        /**
+         * @brief Get the exact length of the stringified json @ref Serialize produces for the entity.
+         *
+         * It lets the callers preallocate their transport buffers without serializing twice.
+         *
+         * @param[in] entity Test result data entity.
+         *
+         * @return Length in bytes of the serialized entity.
+         */
+        virtual std::size_t GetSerializedSize(const Internal::TestDataTestResults& entity) = 0;
+
+        /**
+         * @brief Deserialize the stringified JSON on the executor of the serializer.
+         *
+         * @param[in] payload String formatted json payload, moved into the operation.
+         *
+         * @return A future of the data entity, it holds the XSerialization if deserialization failed.
+         */
+        virtual std::future<Internal::TestDataTestPolicy> DeserializeAsync(std::string&& payload) = 0;
+
+        /**
+         * @brief Serialize the provided input structures on the executor of the serializer.
+         *
+         * @param[in] entity Test result data entity, moved into the operation so that it is never copied.
+         *
+         * @return A future of the stringified json, it holds the XSerialization if serialization failed.
+         */
+        virtual std::future<std::string> SerializeAsync(Internal::TestDataTestResults&& entity) = 0;
     };
 } // namespace Interfaces
 END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -9,6 +9,8 @@
 
 #include "CommonConfig.hpp"
 
+#include "Interfaces/IPerformanceCounters.hpp"
+
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Interfaces
 {
@@ -16,8 +18,10 @@ namespace Interfaces
      * @interface IJsonDataValidator
      *
      * @brief Interface to define member contracts and operations to validate stringified JSON data.
+     *
+     * The validations are counted, see @ref IPerformanceCounters.
      */
-    interface IJsonDataValidator
+    interface IJsonDataValidator : public IPerformanceCounters
     {
         DECLARE_INTERFACE_DEFAULTS(IJsonDataValidator)
 
@@ -0,0 +1,37 @@
+/*************************************************************************************************
+ * @file IPerformanceCounters.hpp
+ *
+ * @brief Interface to define member contracts to read the performance counters of an object.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPERFORMANCECOUNTERS_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPERFORMANCECOUNTERS_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IPerformanceCounters
+     *
+     * @brief Interface to define member contracts to read the call counts, byte counts, error counts and latency
+     * histograms an object keeps per operation.
+     */
+    interface IPerformanceCounters
+    {
+        DECLARE_INTERFACE_DEFAULTS(IPerformanceCounters)
+
+        /**
+         * @brief Aggregate the counters of all the threads, it may be called from any thread at any time.
+         *
+         * @return Snapshot of the counters, see PerformanceCounters::ToJson to dump it.
+         */
+        virtual Internal::PerformanceSnapshot GetPerformanceSnapshot() const = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPERFORMANCECOUNTERS_HPP
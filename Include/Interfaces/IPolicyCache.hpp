@@ -0,0 +1,53 @@
+/*************************************************************************************************
+ * @file IPolicyCache.hpp
+ *
+ * @brief Interface to define member contracts to share the policies deserialized from identical payloads.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYCACHE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYCACHE_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IPolicyCache
+     *
+     * @brief Interface to define member contracts and operations of a cache of deserialized policies.
+     */
+    interface IPolicyCache
+    {
+        DECLARE_INTERFACE_DEFAULTS(IPolicyCache)
+
+        /**
+         * @brief Get the policy of a payload, it is only deserialized if the same bytes were not seen recently.
+         *
+         * @param[in] payload String formatted json payload.
+         *
+         * @return The policy, shared with all the callers that passed the same payload.
+         *
+         * @throw XInvalidFormat If the payload is not valid json, this result is cached too.
+         * @throw XSerialization If deserialization failed due to any other reason.
+         */
+        virtual std::shared_ptr<const Internal::TestDataTestPolicy> Deserialize(const std::string& payload) = 0;
+
+        /**
+         * @brief Get a snapshot of the counters of the cache.
+         *
+         * @return The cache statistics.
+         */
+        virtual Internal::PolicyCacheStatistics GetStatistics() const = 0;
+
+        /**
+         * @brief Drop all the entries, the policies already handed out stay valid.
+         */
+        virtual void Clear() = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYCACHE_HPP
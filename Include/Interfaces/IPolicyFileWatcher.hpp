@@ -0,0 +1,36 @@
+/*************************************************************************************************
+ * @file IPolicyFileWatcher.hpp
+ *
+ * @brief Interface to define member contracts to reload a policy file when it changes.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYFILEWATCHER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYFILEWATCHER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IPolicyFileWatcher
+     *
+     * @brief Interface to define member contracts and operations of a policy file hot reloader.
+     */
+    interface IPolicyFileWatcher
+    {
+        DECLARE_INTERFACE_DEFAULTS(IPolicyFileWatcher)
+
+        /**
+         * @brief Get a snapshot of the counters of the watcher.
+         *
+         * @return The watcher statistics.
+         */
+        virtual Internal::PolicyFileWatcherStatistics GetStatistics() const = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYFILEWATCHER_HPP
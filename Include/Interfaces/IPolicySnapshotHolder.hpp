@@ -0,0 +1,66 @@
+/*************************************************************************************************
+ * @file IPolicySnapshotHolder.hpp
+ *
+ * @brief Interface to define member contracts to read and replace the current policy.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYSNAPSHOTHOLDER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYSNAPSHOTHOLDER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface IPolicySnapshotHolder
+     *
+     * @brief Interface to define member contracts and operations of a holder of immutable policy snapshots.
+     */
+    interface IPolicySnapshotHolder
+    {
+        DECLARE_INTERFACE_DEFAULTS(IPolicySnapshotHolder)
+
+        /**
+         * @brief Get the current policy.
+         *
+         * @return The current snapshot, it stays valid as long as the caller holds it.
+         */
+        virtual std::shared_ptr<const Internal::TestDataTestPolicy> Get() const = 0;
+
+        /**
+         * @brief Get the version of the current policy, it is incremented by every publication.
+         */
+        virtual uint64_t GetVersion() const = 0;
+
+        /**
+         * @brief Replace the current policy.
+         *
+         * @param[in] policy The new policy.
+         *
+         * @return The version of the new policy.
+         *
+         * @throw XArgumentNull If the policy is null.
+         */
+        virtual uint64_t Publish(std::shared_ptr<const Internal::TestDataTestPolicy> policy) = 0;
+
+        /**
+         * @brief Validate and deserialize a payload, then replace the current policy with it.
+         *
+         * The current policy stays in place if the payload is rejected.
+         *
+         * @param[in] payload String formatted json payload.
+         *
+         * @return The version of the new policy.
+         *
+         * @throw XInvalidFormat If the payload is not valid json.
+         * @throw XSerialization If deserialization failed due to any other reason.
+         */
+        virtual uint64_t Publish(const std::string& payload) = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_IPOLICYSNAPSHOTHOLDER_HPP
@@ -31,6 +31,16 @@ namespace Interfaces
          * returned. The exact values are TBD.
          */
         virtual int32_t Run() = 0;
+
+        /**
+         * @brief Synchronously executes a command of the application.
+         *
+         * @param[in] arguments The command and its arguments, the program name excluded. Without any, it runs
+         * like @ref Run().
+         *
+         * @return 0 if the command completed. Otherwise, a non-zero error code is returned.
+         */
+        virtual int32_t Run(const std::vector<std::string>& arguments) = 0;
     };
 } // namespace Interfaces
 END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,50 @@
+/*************************************************************************************************
+ * @file ISerializationPipeline.hpp
+ *
+ * @brief Interface to define member contracts to serialize results in the background.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ISERIALIZATIONPIPELINE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ISERIALIZATIONPIPELINE_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface ISerializationPipeline
+     *
+     * @brief Interface to define member contracts and operations of a background serialization stage.
+     */
+    interface ISerializationPipeline
+    {
+        DECLARE_INTERFACE_DEFAULTS(ISerializationPipeline)
+
+        /**
+         * @brief Hand results over to the pipeline, it may be called from any thread.
+         *
+         * @param[in,out] results Monitor results, moved from only when they are accepted.
+         *
+         * @return False if the queue is full and the results were rejected, the caller still owns them.
+         */
+        virtual bool Submit(Internal::TestDataMonitorResults&& results) = 0;
+
+        /**
+         * @brief Wait until every result accepted so far went through the sink, dropped or failed.
+         */
+        virtual void Flush() = 0;
+
+        /**
+         * @brief Get a snapshot of the counters of the pipeline.
+         *
+         * @return The pipeline statistics.
+         */
+        virtual Internal::SerializationPipelineStatistics GetStatistics() const = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ISERIALIZATIONPIPELINE_HPP
@@ -0,0 +1,36 @@
+/*************************************************************************************************
+ * @file ISerializedResultSink.hpp
+ *
+ * @brief Interface to define member contracts of a destination of serialized results.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ISERIALIZEDRESULTSINK_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ISERIALIZEDRESULTSINK_HPP
+
+#include "CommonConfig.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Interfaces
+{
+    /**
+     * @interface ISerializedResultSink
+     *
+     * @brief Interface to define member contracts of the destination a serialization pipeline writes to.
+     */
+    interface ISerializedResultSink
+    {
+        DECLARE_INTERFACE_DEFAULTS(ISerializedResultSink)
+
+        /**
+         * @brief Write one serialized document.
+         *
+         * It is always called from the same pipeline thread, one document at a time.
+         *
+         * @param[in] payload String formatted json document, the sink may take it over.
+         */
+        virtual void Write(std::string&& payload) = 0;
+    };
+} // namespace Interfaces
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERFACES_ISERIALIZEDRESULTSINK_HPP
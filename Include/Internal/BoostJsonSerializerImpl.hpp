@@ -11,7 +11,14 @@
 
 #include "CommonConfig.hpp"
 
+#include <optional>
+
 #include "Interfaces/IJsonDataSerializerImpl.hpp"
+#include "Internal/CountingMemoryResource.hpp"
+#include "Internal/InPlaceDeserializer.hpp"
+#include "Internal/LimitedJsonParser.hpp"
+#include "Internal/PerThread.hpp"
+#include "Internal/TraceRecorder.hpp"
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
@@ -20,6 +27,10 @@ namespace Internal
      * @class BoostJsonSerializerImpl
      *
      * @brief Concrete implementation of underlying impl layer of test data serialization.
+     *
+     * All the methods are thread safe, a single instance can be shared by any number of threads. Each thread
+     * parses and builds the intermediate json values within its own scratch context, so the threads never
+     * contend with each other once their context exists.
      */
     class BoostJsonSerializerImpl : public Interfaces::IJsonDataSerializerImpl
     {
@@ -28,8 +39,20 @@ namespace Internal
 
         /**
          * @brief Construct a new implementation layer object of boost json serializer.
+         *
+         * @param[in] allocationTracking Whether the allocations of the intermediate json values are counted, see
+         *                               @ref GetLastAllocationStatistics.
+         * @param[in] traceRecorder Recorder of the phases of the calls, null to disable the tracing.
+         * @param[in] memberMatching Handling of the unknown and missing members of the deserialized policies, see
+         *                           @ref GetLastMemberMatchingReport.
+         * @param[in] parseConfiguration Parse options and limits of the deserialized payloads.
+         *
+         * @throw XInvalidArgument If the parse configuration is not supported.
          */
-        BoostJsonSerializerImpl();
+        explicit BoostJsonSerializerImpl(AllocationTracking allocationTracking = AllocationTracking::Disabled,
+                                         std::shared_ptr<TraceRecorder> traceRecorder = nullptr,
+                                         const MemberMatchingOptions& memberMatching = {},
+                                         const JsonParseConfiguration& parseConfiguration = {});
 
         /**
          * @brief Destroy implementation layer object of boost json serializer.
@@ -42,12 +65,136 @@ namespace Internal
 
         virtual TestDataTestPolicy Deserialize(const std::string& payload) override;
 
+        virtual void Deserialize(const std::string& payload, TestDataTestPolicy& policy) override;
+
+        virtual PmrTestDataTestPolicy Deserialize(const std::string& payload,
+                                                  std::pmr::memory_resource* resource) override;
+
         virtual std::string Serialize(const TestDataTestResults& entity) override;
 
+        virtual void Serialize(const TestDataTestResults& entity, Interfaces::IChunkSink& sink) override;
+
+        virtual std::size_t GetSerializedSize(const TestDataTestResults& entity) override;
+
         // #endregion
 
+        /**
+         * @brief Get the number of per-thread contexts alive.
+         *
+         * @return Count of the running threads that used this instance, a context is released when its thread
+         *         exits.
+         */
+        std::size_t GetContextCount() const;
+
+        /**
+         * @brief Get the allocations made by the intermediate json values of the last call of the calling thread.
+         *
+         * The counts are zero unless the allocations are tracked, see @ref AllocationTracking.
+         *
+         * @return Allocations of the last @ref Deserialize or @ref Serialize made by the calling thread.
+         */
+        AllocationStatistics GetLastAllocationStatistics();
+
+        /**
+         * @brief Get the member names collected by the last deserialization of the calling thread.
+         *
+         * The names are only collected for the @ref MemberKeyPolicy::Collect policies.
+         *
+         * @return Unknown and missing members of the last @ref Deserialize made by the calling thread.
+         */
+        MemberMatchingReport GetLastMemberMatchingReport();
+
     private:
         DECLARE_NON_COPYABLE_CLASS(BoostJsonSerializerImpl)
+
+        /**
+         * @brief Category of the trace events of the calls.
+         */
+        static constexpr const char* TraceCategory = "BoostJsonSerializerImpl";
+
+        /**
+         * @brief Size of the scratch buffer every context starts with.
+         */
+        static constexpr std::size_t ScratchBufferSize = 64 * 1024;
+
+        /**
+         * @brief Size of the chunks handed over to the sinks.
+         */
+        static constexpr std::size_t ChunkSize = 64 * 1024;
+
+        /**
+         * @struct ThreadContext
+         *
+         * @brief Scratch state reused by all the calls made from one thread.
+         *
+         * The intermediate json values are allocated from the monotonic resource and released at once after each
+         * call, the parser keeps its internal stacks and the in-place deserializer its scratch vectors from one
+         * call to the next.
+         */
+        struct ThreadContext
+        {
+            ThreadContext();
+
+            /**
+             * @brief Get the storage of the json values of a call.
+             *
+             * @param[in] allocationTracking Whether the storage counts its allocations.
+             */
+            boost::json::storage_ptr BeginCall(AllocationTracking allocationTracking);
+
+            /**
+             * @brief Release the json values of a call, they must have been destroyed.
+             */
+            void EndCall();
+
+            std::unique_ptr<unsigned char[]> Buffer;
+
+            boost::json::monotonic_resource Resource;
+
+            CountingMemoryResource Counting;
+
+            AllocationStatistics LastStatistics;
+
+            /**
+             * @brief Created by the first deserialization, the contexts are default constructed.
+             */
+            std::optional<LimitedJsonParser> Parser;
+
+            InPlaceDeserializer::Scratch Scratch;
+
+            /**
+             * @brief Staging buffer of the chunks written into the sinks.
+             */
+            std::string ChunkBuffer;
+
+            MemberMatchingReport LastMemberReport;
+        };
+
+        // #region Private Methods
+
+        /**
+         * @brief Parse the payload and fill the policy in place, within the configured limits.
+         *
+         * @tparam TPolicy @ref TestDataTestPolicy or @ref PmrTestDataTestPolicy.
+         */
+        template <typename TPolicy>
+        void DeserializeInto(const std::string& payload, TPolicy& policy);
+
+        // #endregion
+
+        // #region Private Members
+
+        const AllocationTracking _allocationTracking;
+
+        const std::shared_ptr<TraceRecorder> _traceRecorder;
+
+        const MemberMatchingOptions _memberMatching;
+
+        const JsonParseConfiguration _parseConfiguration;
+
+        PerThread<ThreadContext> _contexts;
+
+        // #endregion
     };
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
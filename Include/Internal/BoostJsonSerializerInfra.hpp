@@ -12,8 +12,12 @@
 
 #include "CommonConfig.hpp"
 
+#include <cmath>
 #include <type_traits>
 
+#include "Internal/CompactValue.hpp"
+#include "Internal/DescribedEnum.hpp"
+#include "Internal/DescribedMemberReader.hpp"
 #include "Internal/SerializableDataModels.hpp"
 
 #include "Exceptions/XSerialization.hpp"
@@ -46,26 +50,34 @@ namespace Internal
 
     BOOST_DESCRIBE_STRUCT(TestDataTestResults, (), (MonitorResults, OtherData))
 
+    BOOST_DESCRIBE_STRUCT(PmrTestDataTestPolicy, (), (Capabilities, Settings))
+
+    BOOST_DESCRIBE_STRUCT(PmrTestDataMetrics, (), (MetricData))
+
+    BOOST_DESCRIBE_STRUCT(PmrTestDataStepResults, (), (Metrics, OtherData, PageResults))
+
+    BOOST_DESCRIBE_STRUCT(PmrTestDataMonitorResults, (), (StepResults, OtherData))
+
+    BOOST_DESCRIBE_STRUCT(PmrTestDataTestResults, (), (MonitorResults, OtherData))
+
+    BOOST_DESCRIBE_STRUCT(LatencyBucket, (), (UpperBoundNanoseconds, Count))
+
+    BOOST_DESCRIBE_STRUCT(OperationStatistics, (), (Operation, Calls, Errors, ErrorsByCategory, BytesIn, BytesOut,
+                                                    TotalNanoseconds, MaxNanoseconds, P50Nanoseconds, P99Nanoseconds,
+                                                    LatencyHistogram))
+
+    BOOST_DESCRIBE_STRUCT(PerformanceSnapshot, (), (Operations))
+
+    BOOST_DESCRIBE_STRUCT(AllocationStatistics, (), (Allocations, Deallocations, AllocatedBytes, PeakBytes))
+
+    BOOST_DESCRIBE_STRUCT(MemoryFootprintLevel, (), (Instances, Elements, HeapBytes, SlackBytes))
+
+    BOOST_DESCRIBE_STRUCT(MemoryFootprintReport, (), (InlineBytes, HeapBytes, SlackBytes, SerializedSize, Levels))
+
     // #endregion
 
     // #region Deserialization Infrastructure
 
-    /**
-     * @brief Helper extraction function for mapping objects as value types
-     *
-     * @tparam TElement Type of element being mapped
-     * @param[in] obj The object extracting from
-     * @param[in] name The name of the object being extracted
-     * @param[out] value The extracted value
-     */
-    template <typename TElement>
-    inline void Extract(const bj::object& obj,
-                        const char* name,
-                        TElement& value)
-    {
-        value = bj::value_to<TElement>(obj.at(name));
-    }
-
     /**
      * @brief Auto conversion function to convert a value into a TElement type
      *
@@ -89,12 +101,12 @@ namespace Internal
               typename TEnableIf = std::enable_if_t<boost::mp11::mp_empty<TPrivate>::value && !std::is_union<TElement>::value>>
     inline TElement tag_invoke(const bj::value_to_tag<TElement>&, const bj::value& v)
     {
-        const bj::object& obj = v.as_object();
-
         TElement t{};
 
-        boost::mp11::mp_for_each<TPublic>([&](auto D)
-                                          { Extract(obj, D.name, t.*D.pointer); });
+        // The members are matched in document order, see DescribedMemberReader. The unknown members are ignored and
+        // a missing member is an error.
+        DescribedMemberReader::Read(v.as_object(), t, [](const bj::value& member, auto& field)
+                                    { field = bj::value_to<std::remove_reference_t<decltype(field)>>(member); });
 
         return t;
     }
@@ -141,6 +153,193 @@ namespace Internal
         return DeserializationValue{data};
     }
 
+    /**
+     * @brief Narrow a parsed number to float, the widest floating alternative of the serialized values.
+     *
+     * The floats are written as the shortest doubles that read back exactly, so a serialized float is always
+     * read back as itself.
+     *
+     * @param[in] number The parsed number.
+     * @return float The same number.
+     *
+     * @throw XSerialization If the number is not exactly representable as a float.
+     */
+    inline float ToExactFloat(double number)
+    {
+        const float narrowed = static_cast<float>(number);
+
+        if (static_cast<double>(narrowed) != number && !std::isnan(number))
+        {
+            throw Exceptions::XSerialization("The number cannot be represented as a float!");
+        }
+
+        return narrowed;
+    }
+
+    /**
+     * @brief A tag_invoke overload reading back a SerializationValue, so serialized results can be loaded again.
+     *
+     * The integers are read as 64 bits and the doubles as float, the widest floating alternative.
+     *
+     * @param[in] bjValue The boost::json::value object to be mapped with SerializationVariant.
+     * @return SerializationValue The wrapped variant object.
+     *
+     * @throw XSerialization on getting a json value which is not a scalar, or a number a float cannot represent.
+     */
+    SerializationValue inline tag_invoke(bj::value_to_tag<SerializationValue>, const bj::value& bjValue)
+    {
+        switch (bjValue.kind())
+        {
+        case bj::kind::string:
+            return SerializationValue{bj::value_to<std::string>(bjValue)};
+        case bj::kind::int64:
+            return SerializationValue{bjValue.get_int64()};
+        case bj::kind::uint64:
+            return SerializationValue{bjValue.get_uint64()};
+        case bj::kind::double_:
+            return SerializationValue{ToExactFloat(bjValue.get_double())};
+        case bj::kind::bool_:
+            return SerializationValue{bjValue.get_bool()};
+        case bj::kind::null:
+        case bj::kind::object:
+        case bj::kind::array:
+            throw Exceptions::XSerialization("Unexpected Json value type!");
+        default:
+            throw Exceptions::XSerialization("Unknown Json value type!");
+        }
+    }
+
+    /**
+     * @brief A tag_invoke overload mapping the name of an enumerator to a described enum.
+     *
+     * @tparam TEnum An enum declared with BOOST_DESCRIBE_ENUM.
+     *
+     * @param[in] bjValue The boost::json::value object holding the name.
+     * @return TEnum The enumerator.
+     *
+     * @throw XSerialization If the value is not a string or not one of the enumerators.
+     */
+    template <typename TEnum,
+              typename TEnableIf = std::enable_if_t<bd::has_describe_enumerators<TEnum>::value>>
+    inline TEnum tag_invoke(const bj::value_to_tag<TEnum>&, const bj::value& bjValue)
+    {
+        const bj::string* name = bjValue.if_string();
+
+        if (nullptr == name)
+        {
+            throw Exceptions::XSerialization("Enumerators must be strings!");
+        }
+
+        return DescribedEnum<TEnum>::Parse(std::string_view(name->data(), name->size()));
+    }
+
+    /**
+     * @brief A tag_invoke overload mapping a json scalar to a @ref PmrDeserializationValue, the way it is mapped
+     * to a DeserializationValue.
+     *
+     * The string is allocated from the default memory resource, the containers constructing the value from it
+     * move it into their own. InPlaceDeserializer allocates it from the memory resource of the map directly.
+     *
+     * @param[in] bjValue The boost::json::value object to be mapped with PmrDeserializationVariant.
+     * @return PmrDeserializationValue The wrapped variant object.
+     *
+     * @throw XSerialization on getting a json value which is not a scalar.
+     */
+    PmrDeserializationValue inline tag_invoke(bj::value_to_tag<PmrDeserializationValue>, const bj::value& bjValue)
+    {
+        switch (bjValue.kind())
+        {
+        case bj::kind::string:
+        {
+            const bj::string& text = bjValue.get_string();
+            return PmrDeserializationValue{std::pmr::string(text.data(), text.size())};
+        }
+        case bj::kind::int64:
+            return PmrDeserializationValue{bjValue.get_int64()};
+        case bj::kind::uint64:
+            return PmrDeserializationValue{bjValue.get_uint64()};
+        case bj::kind::double_:
+            return PmrDeserializationValue{bjValue.get_double()};
+        case bj::kind::bool_:
+            return PmrDeserializationValue{bjValue.get_bool()};
+        case bj::kind::null:
+        case bj::kind::object:
+        case bj::kind::array:
+            throw Exceptions::XSerialization("Unexpected Json value type!");
+        default:
+            throw Exceptions::XSerialization("Unknown Json value type!");
+        }
+    }
+
+    /**
+     * @brief A tag_invoke overload reading back a @ref PmrSerializationValue, the way a SerializationValue is.
+     *
+     * @param[in] bjValue The boost::json::value object to be mapped with PmrSerializationVariant.
+     * @return PmrSerializationValue The wrapped variant object.
+     *
+     * @throw XSerialization on getting a json value which is not a scalar, or a number a float cannot represent.
+     */
+    PmrSerializationValue inline tag_invoke(bj::value_to_tag<PmrSerializationValue>, const bj::value& bjValue)
+    {
+        switch (bjValue.kind())
+        {
+        case bj::kind::string:
+        {
+            const bj::string& text = bjValue.get_string();
+            return PmrSerializationValue{std::pmr::string(text.data(), text.size())};
+        }
+        case bj::kind::int64:
+            return PmrSerializationValue{bjValue.get_int64()};
+        case bj::kind::uint64:
+            return PmrSerializationValue{bjValue.get_uint64()};
+        case bj::kind::double_:
+            return PmrSerializationValue{ToExactFloat(bjValue.get_double())};
+        case bj::kind::bool_:
+            return PmrSerializationValue{bjValue.get_bool()};
+        case bj::kind::null:
+        case bj::kind::object:
+        case bj::kind::array:
+            throw Exceptions::XSerialization("Unexpected Json value type!");
+        default:
+            throw Exceptions::XSerialization("Unknown Json value type!");
+        }
+    }
+
+    /**
+     * @brief A tag_invoke overload mapping a json scalar to a @ref CompactValue, the way it is mapped to a
+     * DeserializationValue.
+     *
+     * @param[in] bjValue The boost::json::value object to be mapped.
+     * @return CompactValue The compact value.
+     *
+     * @throw XSerialization on getting a json value which is not a scalar.
+     */
+    CompactValue inline tag_invoke(bj::value_to_tag<CompactValue>, const bj::value& bjValue)
+    {
+        switch (bjValue.kind())
+        {
+        case bj::kind::string:
+        {
+            const bj::string& text = bjValue.get_string();
+            return CompactValue(std::string_view(text.data(), text.size()));
+        }
+        case bj::kind::int64:
+            return CompactValue(bjValue.get_int64());
+        case bj::kind::uint64:
+            return CompactValue(bjValue.get_uint64());
+        case bj::kind::double_:
+            return CompactValue(bjValue.get_double());
+        case bj::kind::bool_:
+            return CompactValue(bjValue.get_bool());
+        case bj::kind::null:
+        case bj::kind::object:
+        case bj::kind::array:
+            throw Exceptions::XSerialization("Unexpected Json value type!");
+        default:
+            throw Exceptions::XSerialization("Unknown Json value type!");
+        }
+    }
+
     // #endregion
 
     // #region Serialization Infrastructure
@@ -158,7 +357,7 @@ namespace Internal
      * @tparam TPrivate A helper object to ensure private variables are not mapped
      * @tparam std::enable_if_t<boost::mp11::mp_empty<TPrivate>::value && !std::is_union<TElement>::value> A helper to ensure we don't map private variables
      *
-     * @param[in,out] v The resultant value object
+     * @param[in,out] v The resultant value object, the members are built in its storage
      * @param[in] t The element needing conversion
      */
     template <typename TElement,
@@ -170,32 +369,129 @@ namespace Internal
         bj::object& obj = v.emplace_object();
 
         boost::mp11::mp_for_each<TPublic>([&](auto D)
-                                          { obj[D.name] = bj::value_from(t.*D.pointer); });
+                                          { obj[D.name] = bj::value_from(t.*D.pointer, v.storage()); });
     }
 
     /**
-     * @brief This class provides SerializationValue mapping to a boost::json::value via the variant apply_visitor or visit.
+     * @brief A tag_invoke overload mapping a described enum to the name of its enumerator.
+     *
+     * @tparam TEnum An enum declared with BOOST_DESCRIBE_ENUM.
+     *
+     * @param[out] bjValue The resultant value object.
+     * @param[in] value The enumerator.
+     *
+     * @throw XSerialization If the value is not one of the enumerators.
      */
-    class SerializationValueVisitor : public boost::static_visitor<bj::value>
+    template <typename TEnum,
+              typename TEnableIf = std::enable_if_t<bd::has_describe_enumerators<TEnum>::value>>
+    inline void tag_invoke(const bj::value_from_tag&, bj::value& bjValue, TEnum value)
     {
-    public:
-        template <typename T>
-        bj::value operator()(const T& val) const { return bj::value(val); }
-    };
+        const std::string_view name = DescribedEnum<TEnum>::ToString(value);
+
+        if (name.empty())
+        {
+            throw Exceptions::XSerialization("Unknown enum value " +
+                                             std::to_string(static_cast<std::underlying_type_t<TEnum>>(value)) + "!");
+        }
+
+        bjValue.emplace_string().assign(name.data(), name.size());
+    }
+
+    /**
+     * @brief Assign the scalar held by a serialization variant to a boost::json::value.
+     *
+     * @tparam TVariant The variant of @ref SerializationValue or of @ref PmrSerializationValue.
+     *
+     * @param[out] bjValue The resultant value object, the strings are allocated from its storage.
+     * @param[in] variant The variant.
+     */
+    template <typename TVariant>
+    inline void AssignSerializationVariant(bj::value& bjValue, const TVariant& variant)
+    {
+        bv2::visit([&](const auto& data)
+                   {
+                       using TData = std::decay_t<decltype(data)>;
+
+                       if constexpr (std::is_same_v<TData, std::string> || std::is_same_v<TData, std::pmr::string>)
+                       {
+                           bjValue.emplace_string().assign(data.data(), data.size());
+                       }
+                       else if constexpr (std::is_same_v<TData, EnumName>)
+                       {
+                           bjValue.emplace_string().assign(data.Name.data(), data.Name.size());
+                       }
+                       else
+                       {
+                           bjValue = data;
+                       }
+                   },
+                   variant);
+    }
 
     /**
      * @brief A tag_invoke overload specific to sorting out the variant object within SerializationValue.
      *
-     * @param[out] bjValue The value being retrieved from the variant
+     * @param[out] bjValue The value being retrieved from the variant, the strings are allocated from its storage.
      * @param[in] SerializationValue The variant wrapper
      */
     void inline tag_invoke(bj::value_from_tag, bj::value& bjValue, const SerializationValue& SerializationValue)
     {
-        bjValue = bv2::visit(SerializationValueVisitor{}, SerializationValue.data);
+        AssignSerializationVariant(bjValue, SerializationValue.data);
+    }
+
+    /**
+     * @brief A tag_invoke overload mapping a @ref PmrSerializationValue to a boost::json::value, the way the
+     * SerializationValue holding the same scalar is mapped.
+     *
+     * @param[out] bjValue The resultant value object, the strings are allocated from its storage.
+     * @param[in] value The variant wrapper.
+     */
+    void inline tag_invoke(bj::value_from_tag, bj::value& bjValue, const PmrSerializationValue& value)
+    {
+        AssignSerializationVariant(bjValue, value.data);
+    }
+
+    /**
+     * @brief A tag_invoke overload mapping a @ref CompactValue to a boost::json::value, the way the
+     * SerializationValue holding the same scalar is mapped.
+     *
+     * @param[out] bjValue The resultant value object, the strings are allocated from its storage.
+     * @param[in] value The compact value.
+     */
+    void inline tag_invoke(bj::value_from_tag, bj::value& bjValue, const CompactValue& value)
+    {
+        value.Visit([&](auto scalar)
+                    {
+                        using TScalar = decltype(scalar);
+
+                        if constexpr (std::is_same_v<TScalar, std::string_view>)
+                        {
+                            bjValue.emplace_string().assign(scalar.data(), scalar.size());
+                        }
+                        else if constexpr (std::is_same_v<TScalar, EnumName>)
+                        {
+                            bjValue.emplace_string().assign(scalar.Name.data(), scalar.Name.size());
+                        }
+                        else
+                        {
+                            bjValue = scalar;
+                        }
+                    });
     }
 
     // #endregion
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
 
+/**
+ * @brief Make the conversions of the serializer visible to the described types of another namespace.
+ *
+ * Boost.JSON finds tag_invoke by argument dependent lookup, so the overloads above only apply to the types of the
+ * Internal namespace. Use this macro once in the namespace of any other described struct or enum, after this
+ * header is included. Without it, such types fall back to the described struct support of Boost.JSON itself,
+ * which needs Boost 1.81.0 and neither skips the private members nor throws @ref Exceptions::XSerialization.
+ */
+#define BOOST_AUTO_JSON_SERIALIZER_USE_CONVERSIONS() \
+    using BOOST_AUTO_JSON_SERIALIZER_NS::Internal::tag_invoke
+
 #endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_BOOSTJSONSERIALIZERINFRA_HPP
\ No newline at end of file
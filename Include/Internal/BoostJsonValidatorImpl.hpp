@@ -10,6 +10,8 @@
 #include "CommonConfig.hpp"
 
 #include "Interfaces/IJsonDataValidatorImpl.hpp"
+#include "Internal/SerializableDataModels.hpp"
+#include "Internal/TraceRecorder.hpp"
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
@@ -22,12 +24,23 @@ namespace Internal
     class BoostJsonValidatorImpl : public Interfaces::IJsonDataValidatorImpl
     {
     public:
+        /**
+         * @brief Payloads of at least this size are validated by @ref JsonStructuralValidator first.
+         */
+        static constexpr std::size_t StructuralFastPathThreshold = 64 * 1024;
+
         // #region Construction/Destruction
 
         /**
          * @brief  Construct a new implementation layer object of boost json data validator.
+         *
+         * @param[in] traceRecorder Recorder of the phases of the calls, null to disable the tracing.
+         * @param[in] parseConfiguration Parse options and limits the payloads must comply with.
+         *
+         * @throw XInvalidArgument If the parse configuration is not supported.
          */
-        BoostJsonValidatorImpl();
+        explicit BoostJsonValidatorImpl(std::shared_ptr<TraceRecorder> traceRecorder = nullptr,
+                                        const JsonParseConfiguration& parseConfiguration = {});
 
         /**
          * @brief  Destroy implementation layer object of boost json data validator.
@@ -43,7 +56,7 @@ namespace Internal
          *
          * @param payload Json payload to be validated.
          * 
-         * @throw XInvalidFormat If the payload is not proper json format. 
+         * @throw XInvalidFormat If the payload is not proper json format, or exceeds the configured limits.
          */
         virtual void Validate(const std::string& payload) override;
 
@@ -51,6 +64,19 @@ namespace Internal
 
     private:
         DECLARE_NON_COPYABLE_CLASS(BoostJsonValidatorImpl)
+
+        /**
+         * @brief Category of the trace events of the calls.
+         */
+        static constexpr const char* TraceCategory = "BoostJsonValidatorImpl";
+
+        // #region Private Members
+
+        const std::shared_ptr<TraceRecorder> _traceRecorder;
+
+        const JsonParseConfiguration _parseConfiguration;
+
+        // #endregion
     };
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
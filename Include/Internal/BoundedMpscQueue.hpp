@@ -0,0 +1,210 @@
+/*************************************************************************************************
+ * @file BoundedMpscQueue.hpp
+ *
+ * @brief Declarations for the template class @ref BoundedMpscQueue.
+ *
+ * A bounded lock-free queue handing elements from any number of producers over to a consumer.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_BOUNDEDMPSCQUEUE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_BOUNDEDMPSCQUEUE_HPP
+
+#include "CommonConfig.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class BoundedMpscQueue
+     *
+     * @brief Bounded lock-free queue based on a ring of sequenced cells (D. Vyukov's bounded queue).
+     *
+     * Push and pop never lock nor allocate, each of them claims a cell with a single compare-exchange. Pop is
+     * safe from any thread as well, which lets a producer evict the oldest element of a full queue.
+     *
+     * @tparam TElement Default constructible and movable element type.
+     */
+    template <typename TElement>
+    class BoundedMpscQueue
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new queue.
+         *
+         * @param[in] capacity Minimal number of elements the queue holds, it is rounded up to a power of two.
+         *
+         * @throw XInvalidArgument If the capacity is 0.
+         */
+        explicit BoundedMpscQueue(std::size_t capacity)
+        {
+            if (0 == capacity)
+            {
+                throw Exceptions::XInvalidArgument("BoundedMpscQueue::capacity must not be 0");
+            }
+
+            std::size_t roundedCapacity = 2;
+
+            while (roundedCapacity < capacity)
+            {
+                roundedCapacity *= 2;
+            }
+
+            _cells = std::make_unique<Cell[]>(roundedCapacity);
+            _mask = roundedCapacity - 1;
+
+            for (std::size_t index = 0; index < roundedCapacity; ++index)
+            {
+                _cells[index].Sequence.store(index, std::memory_order_relaxed);
+            }
+
+            _enqueuePosition.store(0, std::memory_order_relaxed);
+            _dequeuePosition.store(0, std::memory_order_relaxed);
+        }
+
+        ~BoundedMpscQueue() = default;
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Push an element unless the queue is full.
+         *
+         * @param[in,out] element The element, it is only moved from when it is pushed.
+         *
+         * @return True if the element was pushed, false if the queue is full.
+         */
+        bool TryPush(TElement& element)
+        {
+            std::size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                Cell& cell = _cells[position & _mask];
+                const std::size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+                if (0 == difference)
+                {
+                    if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        cell.Data = std::move(element);
+                        cell.Sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // The cell still holds the element pushed one lap earlier.
+                    return false;
+                }
+                else
+                {
+                    position = _enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Pop the oldest element unless the queue is empty.
+         *
+         * @param[out] element Receives the element.
+         *
+         * @return True if an element was popped, false if the queue is empty.
+         */
+        bool TryPop(TElement& element)
+        {
+            std::size_t position = _dequeuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                Cell& cell = _cells[position & _mask];
+                const std::size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+                if (0 == difference)
+                {
+                    if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        element = std::move(cell.Data);
+                        cell.Data = TElement{};
+                        cell.Sequence.store(position + _mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = _dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Get the number of elements the queue holds at most.
+         */
+        std::size_t GetCapacity() const
+        {
+            return _mask + 1;
+        }
+
+        /**
+         * @brief Get the number of elements in the queue, it may already be stale when it is returned.
+         */
+        std::size_t GetApproximateSize() const
+        {
+            const std::size_t dequeuePosition = _dequeuePosition.load(std::memory_order_acquire);
+            const std::size_t enqueuePosition = _enqueuePosition.load(std::memory_order_acquire);
+
+            return (enqueuePosition > dequeuePosition) ? std::min(enqueuePosition - dequeuePosition, GetCapacity()) : 0;
+        }
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(BoundedMpscQueue)
+
+        /**
+         * @brief Size of a cache line, the two positions are kept apart so that producers and consumer do not
+         * invalidate each other's line.
+         */
+        static constexpr std::size_t CacheLineSize = 64;
+
+        /**
+         * @struct Cell
+         *
+         * @brief A slot of the ring, its sequence tells whether it is free or holds an element for the current lap.
+         */
+        struct Cell
+        {
+            std::atomic<std::size_t> Sequence{0};
+
+            TElement Data{};
+        };
+
+        // #region Private Members
+
+        std::unique_ptr<Cell[]> _cells;
+
+        std::size_t _mask = 0;
+
+        alignas(CacheLineSize) std::atomic<std::size_t> _enqueuePosition{0};
+
+        alignas(CacheLineSize) std::atomic<std::size_t> _dequeuePosition{0};
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_BOUNDEDMPSCQUEUE_HPP
@@ -0,0 +1,85 @@
+/*************************************************************************************************
+ * @file ColumnarMetricsConverter.hpp
+ *
+ * @brief Declarations for the concrete class @ref ColumnarMetricsConverter.
+ *
+ * It converts the metrics of a step between their row and columnar forms, and writes the columnar one.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COLUMNARMETRICSCONVERTER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COLUMNARMETRICSCONVERTER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class ColumnarMetricsConverter
+     *
+     * @brief Lossless conversion between the rows of @ref TestDataStepResults::Metrics and @ref ColumnarMetrics.
+     *
+     * Each column is typed after the values of its key: as long as they all hold the same alternative of
+     * @ref SerializationVariant they are stored in a vector of that type, otherwise in a vector of
+     * @ref SerializationValue. Converting the columns back gives rows equal to the original ones, types
+     * included.
+     */
+    class ColumnarMetricsConverter
+    {
+    public:
+        /**
+         * @brief Convert rows of metrics into columns.
+         *
+         * @param[in] rows The metrics of a step.
+         *
+         * @return One column per distinct key, the keys are sorted.
+         */
+        static ColumnarMetrics ToColumns(const std::vector<TestDataMetrics>& rows);
+
+        /**
+         * @brief Convert columns of metrics back into rows.
+         *
+         * @param[in] columns The columnar metrics.
+         *
+         * @return The rows, each holding the keys present in it.
+         *
+         * @throw XInvalidArgument If the keys and the columns do not match, or a column does not hold one value
+         * per row holding its key.
+         */
+        static std::vector<TestDataMetrics> ToRows(const ColumnarMetrics& columns);
+
+        /**
+         * @brief Append the columnar JSON encoding of the metrics.
+         *
+         * The encoding is @c {"keys":[...],"columns":[[...],...]}, each column holding one value per row and
+         * null for the rows not holding its key. Strings and numbers are written the way the row form writes
+         * them.
+         *
+         * @param[in] columns The columnar metrics.
+         * @param[in,out] output The string to be appended.
+         *
+         * @throw XInvalidArgument If the columns are not consistent, see @ref ToRows.
+         */
+        static void Write(const ColumnarMetrics& columns, std::string& output);
+
+        /**
+         * @copydoc Write(const ColumnarMetrics&, std::string&)
+         *
+         * @return The JSON text.
+         */
+        static std::string Write(const ColumnarMetrics& columns);
+
+    private:
+        /**
+         * @brief Check that the columns can be walked row by row.
+         *
+         * @throw XInvalidArgument If the columns are not consistent.
+         */
+        static void Validate(const ColumnarMetrics& columns);
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COLUMNARMETRICSCONVERTER_HPP
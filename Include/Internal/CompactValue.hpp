@@ -0,0 +1,348 @@
+/*************************************************************************************************
+ * @file CompactValue.hpp
+ *
+ * @brief Declarations for the concrete class @ref CompactValue.
+ *
+ * It is a 16 bytes alternative to the @ref SerializationValue and @ref DeserializationValue wrappers.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COMPACTVALUE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COMPACTVALUE_HPP
+
+#include "CommonConfig.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "Internal/SerializableDataModels.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class CompactValue
+     *
+     * @brief Tagged scalar of 16 bytes holding any alternative of @ref SerializationVariant or
+     * @ref DeserializationVariant.
+     *
+     * The numbers and the booleans are stored inline next to a one byte tag. The strings of up to
+     * @ref MaxInlineStringLength bytes are stored inline too, the longer ones in a buffer of their exact size
+     * owned by the value, so the value keeps the copy semantics of the wrappers. An @ref EnumName only refers to
+     * the static name table of its enum, it is never copied.
+     *
+     * The values convert to and from both wrappers and to and from boost::json values, so the data models can
+     * hold them in place of the wrappers. The constructors from a scalar are explicit, so that a plain number or
+     * string never silently becomes a value when an overload taking it directly is missing.
+     */
+    class alignas(8) CompactValue
+    {
+    public:
+        /**
+         * @brief Type of the held value.
+         */
+        enum class Kind : std::uint8_t
+        {
+            String,
+            Bool,
+            Float,
+            Double,
+            Int8,
+            Int16,
+            Int32,
+            Int64,
+            UInt8,
+            UInt16,
+            UInt32,
+            UInt64,
+            EnumName
+        };
+
+        /**
+         * @brief Longest string stored within the value itself.
+         */
+        static constexpr std::size_t MaxInlineStringLength = 14;
+
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct an empty string, like a default constructed wrapper.
+         */
+        CompactValue() noexcept;
+
+        /**
+         * @throw XInvalidArgument If the string is longer than 4 GiB.
+         */
+        explicit CompactValue(std::string_view text);
+
+        explicit CompactValue(const std::string& text);
+
+        explicit CompactValue(const char* text);
+
+        explicit CompactValue(EnumName name) noexcept;
+
+        explicit CompactValue(bool value) noexcept;
+
+        explicit CompactValue(float value) noexcept;
+
+        explicit CompactValue(double value) noexcept;
+
+        explicit CompactValue(int8_t value) noexcept;
+
+        explicit CompactValue(int16_t value) noexcept;
+
+        explicit CompactValue(int32_t value) noexcept;
+
+        explicit CompactValue(int64_t value) noexcept;
+
+        explicit CompactValue(uint8_t value) noexcept;
+
+        explicit CompactValue(uint16_t value) noexcept;
+
+        explicit CompactValue(uint32_t value) noexcept;
+
+        explicit CompactValue(uint64_t value) noexcept;
+
+        explicit CompactValue(const SerializationValue& value);
+
+        explicit CompactValue(const DeserializationValue& value);
+
+        CompactValue(const CompactValue& other);
+
+        CompactValue(CompactValue&& other) noexcept;
+
+        ~CompactValue();
+
+        CompactValue& operator=(const CompactValue& other);
+
+        CompactValue& operator=(CompactValue&& other) noexcept;
+
+        // #endregion
+
+        // #region Public Methods
+
+        Kind GetKind() const noexcept
+        {
+            return _kind;
+        }
+
+        /**
+         * @brief Get the text of a string or the name of an enumerator.
+         *
+         * @throw XInvalidArgument If the value is neither.
+         */
+        std::string_view GetString() const;
+
+        /**
+         * @brief Get a number or a boolean.
+         *
+         * @tparam TValue The exact type of the held value.
+         *
+         * @throw XInvalidArgument If the value holds another type.
+         */
+        template <typename TValue>
+        TValue Get() const
+        {
+            static_assert(std::is_arithmetic_v<TValue>, "Only the numbers and the booleans are read by Get.");
+
+            if (KindOf<TValue>() != _kind)
+            {
+                throw Exceptions::XInvalidArgument("The compact value does not hold the requested type!");
+            }
+
+            return Load<TValue>();
+        }
+
+        /**
+         * @brief Call a visitor with the held value.
+         *
+         * The strings are passed as std::string_view and the enumerators as @ref EnumName, the other values with
+         * their own type. The visitor must return the same type for all of them.
+         *
+         * @param[in] visitor The callable.
+         *
+         * @return What the visitor returned.
+         */
+        template <typename TVisitor>
+        decltype(auto) Visit(TVisitor&& visitor) const
+        {
+            switch (_kind)
+            {
+            case Kind::Bool:
+                return visitor(Load<bool>());
+            case Kind::Float:
+                return visitor(Load<float>());
+            case Kind::Double:
+                return visitor(Load<double>());
+            case Kind::Int8:
+                return visitor(Load<int8_t>());
+            case Kind::Int16:
+                return visitor(Load<int16_t>());
+            case Kind::Int32:
+                return visitor(Load<int32_t>());
+            case Kind::Int64:
+                return visitor(Load<int64_t>());
+            case Kind::UInt8:
+                return visitor(Load<uint8_t>());
+            case Kind::UInt16:
+                return visitor(Load<uint16_t>());
+            case Kind::UInt32:
+                return visitor(Load<uint32_t>());
+            case Kind::UInt64:
+                return visitor(Load<uint64_t>());
+            case Kind::EnumName:
+                return visitor(EnumName{GetText()});
+            default:
+                return visitor(GetText());
+            }
+        }
+
+        /**
+         * @brief Get the number of bytes held out of the value, i.e. the buffer of a long string.
+         */
+        std::size_t GetOutOfLineBytes() const noexcept;
+
+        /**
+         * @brief Convert to the serialization wrapper, a double is narrowed to float.
+         */
+        SerializationValue ToSerializationValue() const;
+
+        /**
+         * @brief Convert to the deserialization wrapper, the integers are widened to 64 bits, a float to double
+         * and an enumerator to its name.
+         */
+        DeserializationValue ToDeserializationValue() const;
+
+        bool operator==(const CompactValue& other) const;
+
+        bool operator!=(const CompactValue& other) const
+        {
+            return !(*this == other);
+        }
+
+        // #endregion
+
+    private:
+        /**
+         * @brief Length marking a string stored out of the value.
+         */
+        static constexpr std::uint8_t LongStringLength = 0xFF;
+
+        // #region Private Methods
+
+        template <typename TValue>
+        static constexpr Kind KindOf()
+        {
+            if constexpr (std::is_same_v<TValue, bool>)
+            {
+                return Kind::Bool;
+            }
+            else if constexpr (std::is_same_v<TValue, float>)
+            {
+                return Kind::Float;
+            }
+            else if constexpr (std::is_same_v<TValue, double>)
+            {
+                return Kind::Double;
+            }
+            else if constexpr (std::is_same_v<TValue, int8_t>)
+            {
+                return Kind::Int8;
+            }
+            else if constexpr (std::is_same_v<TValue, int16_t>)
+            {
+                return Kind::Int16;
+            }
+            else if constexpr (std::is_same_v<TValue, int32_t>)
+            {
+                return Kind::Int32;
+            }
+            else if constexpr (std::is_same_v<TValue, int64_t>)
+            {
+                return Kind::Int64;
+            }
+            else if constexpr (std::is_same_v<TValue, uint8_t>)
+            {
+                return Kind::UInt8;
+            }
+            else if constexpr (std::is_same_v<TValue, uint16_t>)
+            {
+                return Kind::UInt16;
+            }
+            else if constexpr (std::is_same_v<TValue, uint32_t>)
+            {
+                return Kind::UInt32;
+            }
+            else
+            {
+                static_assert(std::is_same_v<TValue, uint64_t>, "Unsupported compact value type.");
+                return Kind::UInt64;
+            }
+        }
+
+        template <typename TValue>
+        TValue Load() const noexcept
+        {
+            TValue value;
+            std::memcpy(&value, _payload, sizeof(TValue));
+
+            return value;
+        }
+
+        template <typename TValue>
+        void Store(TValue value) noexcept
+        {
+            _kind = KindOf<TValue>();
+            _length = 0;
+            std::memcpy(_payload, &value, sizeof(TValue));
+        }
+
+        /**
+         * @brief Get the text of a string or of an enumerator, whichever the value holds.
+         */
+        std::string_view GetText() const noexcept;
+
+        /**
+         * @brief Store a string inline, or a pointer to it with its size when it does not fit.
+         */
+        void StoreText(Kind kind, const char* data, std::uint32_t size) noexcept;
+
+        void AssignString(std::string_view text);
+
+        /**
+         * @brief Take over the bytes of another value, leaving it an empty string.
+         */
+        void MoveFrom(CompactValue& other) noexcept;
+
+        /**
+         * @brief Free the buffer of a long string.
+         */
+        void Release() noexcept;
+
+        // #endregion
+
+        // #region Private Members
+
+        /**
+         * @brief The number, the inline string, or the pointer to the text followed by its 32 bits size.
+         */
+        unsigned char _payload[MaxInlineStringLength];
+
+        /**
+         * @brief Length of an inline string, @ref LongStringLength for a text stored out of the value.
+         */
+        std::uint8_t _length;
+
+        Kind _kind;
+
+        // #endregion
+    };
+
+    static_assert(sizeof(CompactValue) == 16, "A compact value must fit into 16 bytes.");
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COMPACTVALUE_HPP
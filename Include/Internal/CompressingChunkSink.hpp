@@ -0,0 +1,171 @@
+/*************************************************************************************************
+ * @file CompressingChunkSink.hpp
+ *
+ * @brief Declarations for the concrete class @ref CompressingChunkSink.
+ *
+ * It compresses the chunks written by the serializer before handing them over to another sink.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COMPRESSINGCHUNKSINK_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COMPRESSINGCHUNKSINK_HPP
+
+#include "CommonConfig.hpp"
+
+#include <deque>
+#include <future>
+#include <string_view>
+
+#include "Interfaces/IChunkSink.hpp"
+#include "Interfaces/IExecutor.hpp"
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @brief A compression stream of one of the formats, defined along the implementation of the sink.
+     */
+    class StreamCompressor;
+
+    /**
+     * @class CompressingChunkSink
+     *
+     * @brief Sink compressing its chunks with gzip, or zstd when available, into another sink.
+     *
+     * The output is compressed while it is produced: in streaming mode every chunk goes through a single
+     * compression stream and the compressed bytes are forwarded as soon as the compressor releases them. In block
+     * mode the output is cut into blocks of @ref CompressionOptions::BlockSize bytes, each compressed on its own,
+     * on the executor if there is one, and forwarded in order. Either way the uncompressed document is never held
+     * as a whole.
+     *
+     * The sink is meant to be written by a single thread.
+     */
+    class CompressingChunkSink : public Interfaces::IChunkSink
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new compressing sink.
+         *
+         * @param[in] output The destination of the compressed bytes, it is finished with this sink.
+         * @param[in] options Format, level and blocks of the compression.
+         * @param[in] executor Executor of the block compressions, null to compress the blocks on the calling
+         *                     thread. It is not used in streaming mode.
+         *
+         * @throw XArgumentNull If the output is null.
+         * @throw XInvalidArgument If the format is not available, the level is out of the range of the format or
+         * no block can be in flight.
+         */
+        explicit CompressingChunkSink(std::shared_ptr<Interfaces::IChunkSink> output,
+                                      const CompressionOptions& options = CompressionOptions{},
+                                      std::shared_ptr<Interfaces::IExecutor> executor = nullptr);
+
+        /**
+         * @brief Destroy the sink, the output of a sink which was not finished is incomplete.
+         */
+        virtual ~CompressingChunkSink() override;
+
+        // #endregion
+
+        // #region IChunkSink Implementation
+
+        /**
+         * @copydoc IChunkSink::Write
+         *
+         * @throw XInvalidArgument If the sink is already finished.
+         * @throw XSerialization If the compression failed.
+         */
+        virtual void Write(std::string_view chunk) override;
+
+        /**
+         * @brief Compress what is left, end the compressed stream and finish the output.
+         *
+         * @throw XSerialization If the compression failed.
+         */
+        virtual void Finish() override;
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Get whether a compression format was built in.
+         *
+         * @param[in] format The compression format.
+         *
+         * @return True if the sinks can be constructed with the format.
+         */
+        static bool IsAvailable(CompressionFormat format);
+
+        /**
+         * @brief Compress a whole buffer at once, into a complete gzip member or zstd frame.
+         *
+         * @param[in] format The compression format.
+         * @param[in] level The compression level, -1 for the default one.
+         * @param[in] input The bytes to be compressed.
+         *
+         * @return The compressed bytes.
+         *
+         * @throw XInvalidArgument If the format is not available or the level is out of its range.
+         * @throw XSerialization If the compression failed.
+         */
+        static std::string Compress(CompressionFormat format, int level, std::string_view input);
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(CompressingChunkSink)
+
+        // #region Private Methods
+
+        /**
+         * @brief Hand the current block over for compression, waiting for the oldest one if too many are in flight.
+         */
+        void SubmitBlock();
+
+        /**
+         * @brief Forward the compressed blocks in order, waiting for them unless only the ready ones are asked for.
+         */
+        void DrainBlocks(bool readyOnly);
+
+        // #endregion
+
+        // #region Private Members
+
+        const std::shared_ptr<Interfaces::IChunkSink> _output;
+
+        const CompressionOptions _options;
+
+        const std::shared_ptr<Interfaces::IExecutor> _executor;
+
+        /**
+         * @brief The compression stream of the streaming mode, null in block mode.
+         */
+        std::unique_ptr<StreamCompressor> _compressor;
+
+        /**
+         * @brief Compressed bytes of the streaming mode, its capacity is reused from one chunk to the next.
+         */
+        std::string _compressed;
+
+        /**
+         * @brief Uncompressed bytes of the block being filled.
+         */
+        std::string _block;
+
+        /**
+         * @brief The compressed blocks not forwarded yet, in output order.
+         */
+        std::deque<std::future<std::string>> _pendingBlocks;
+
+        std::size_t _blockCount = 0;
+
+        bool _finished = false;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COMPRESSINGCHUNKSINK_HPP
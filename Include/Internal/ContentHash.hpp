@@ -0,0 +1,74 @@
+/*************************************************************************************************
+ * @file ContentHash.hpp
+ *
+ * @brief Declarations for the concrete class @ref ContentHash.
+ *
+ * It computes the 128-bit digests payloads are identified by.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CONTENTHASH_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CONTENTHASH_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string_view>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @struct ContentDigest
+     *
+     * @brief 128-bit digest of a payload.
+     */
+    struct ContentDigest
+    {
+        uint64_t Low = 0;
+        uint64_t High = 0;
+
+        bool operator==(const ContentDigest& other) const
+        {
+            return Low == other.Low && High == other.High;
+        }
+
+        bool operator!=(const ContentDigest& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * @class ContentHash
+     *
+     * @brief Fast non-cryptographic 128-bit hash of byte strings.
+     *
+     * It reads 16 bytes per step into two independent lanes that are mixed together at the end, so that every
+     * input byte affects both halves of the digest. It is meant to identify payloads, not to resist attackers.
+     */
+    class ContentHash
+    {
+    public:
+        /**
+         * @brief Compute the digest of a byte string.
+         *
+         * @param[in] data The bytes to hash.
+         *
+         * @return The digest, always the same for the same bytes.
+         */
+        static ContentDigest Compute(std::string_view data);
+
+        /**
+         * @brief Hasher of digests for the unordered containers, a digest is already well mixed.
+         */
+        struct DigestHasher
+        {
+            std::size_t operator()(const ContentDigest& digest) const noexcept
+            {
+                return digest.Low;
+            }
+        };
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CONTENTHASH_HPP
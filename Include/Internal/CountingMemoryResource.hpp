@@ -0,0 +1,87 @@
+/*************************************************************************************************
+ * @file CountingMemoryResource.hpp
+ *
+ * @brief Declarations for the concrete class @ref CountingMemoryResource.
+ *
+ * It counts the allocations a json value makes through its storage.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COUNTINGMEMORYRESOURCE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COUNTINGMEMORYRESOURCE_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class CountingMemoryResource
+     *
+     * @brief Memory resource forwarding to an upstream resource and counting the requests it forwards.
+     *
+     * The counts only depend on the values built through the resource, not on the upstream, so they can be
+     * pinned by the tests. It is not thread safe, an instance is meant to be used by one thread at a time.
+     */
+    class CountingMemoryResource : public boost::json::memory_resource
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new counting resource.
+         *
+         * @param[in] upstream The resource serving the allocations, the default resource if not supplied.
+         */
+        explicit CountingMemoryResource(boost::json::storage_ptr upstream = {});
+
+        virtual ~CountingMemoryResource() override;
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Get the allocations counted since the construction or the last reset.
+         */
+        AllocationStatistics GetStatistics() const;
+
+        /**
+         * @brief Start counting from zero, the bytes still allocated become the base of the peak.
+         */
+        void Reset();
+
+        // #endregion
+
+    protected:
+        // #region memory_resource Implementation
+
+        virtual void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        virtual void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+        virtual bool do_is_equal(const boost::json::memory_resource& other) const noexcept override;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(CountingMemoryResource)
+
+        // #region Private Members
+
+        boost::json::storage_ptr _upstream;
+
+        AllocationStatistics _statistics;
+
+        /**
+         * @brief Bytes allocated and not yet deallocated, it is not reset.
+         */
+        uint64_t _liveBytes;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_COUNTINGMEMORYRESOURCE_HPP
@@ -0,0 +1,61 @@
+/*************************************************************************************************
+ * @file CpuFeatures.hpp
+ *
+ * @brief Declarations for the runtime CPU feature detection used to dispatch vectorized code paths.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CPUFEATURES_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CPUFEATURES_HPP
+
+#include "CommonConfig.hpp"
+
+/**
+ * @brief Defined to 1 when the x86 vector code paths (SSE2/AVX2) are compiled in.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD 1
+#else
+#define BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD 0
+#endif
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @brief Instruction set levels the vectorized code paths are available for.
+     */
+    enum class SimdLevel
+    {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    /**
+     * @class CpuFeatures
+     *
+     * @brief Runtime detection of the instruction sets of the executing CPU.
+     */
+    class CpuFeatures
+    {
+    public:
+        /**
+         * @brief Get the best instruction set level supported by the executing CPU.
+         *
+         * @return The best supported level, it is detected only once.
+         */
+        static SimdLevel GetBestSimdLevel();
+
+        /**
+         * @brief Check whether the executing CPU supports an instruction set level.
+         *
+         * @param[in] level The level to check.
+         *
+         * @return bool @b true if supported, @b false otherwise.
+         */
+        static bool IsSupported(SimdLevel level);
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_CPUFEATURES_HPP
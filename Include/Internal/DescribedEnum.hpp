@@ -0,0 +1,234 @@
+/*************************************************************************************************
+ * @file DescribedEnum.hpp
+ *
+ * @brief Declarations for the concrete class @ref DescribedEnum.
+ *
+ * It maps the enumerators of enums declared with BOOST_DESCRIBE_ENUM to and from their names.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_DESCRIBEDENUM_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_DESCRIBEDENUM_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "Internal/SerializableDataModels.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class DescribedEnum
+     *
+     * @brief Name tables of a described enum, built at compile time.
+     *
+     * The enumerators are kept in two constexpr tables, one sorted by value and one sorted by name, and both
+     * conversions are binary searches over them. No map is built and nothing is allocated, the names are views
+     * of the string literals generated by the describe macro.
+     *
+     * @tparam TEnum An enum declared with BOOST_DESCRIBE_ENUM.
+     */
+    template <typename TEnum>
+    class DescribedEnum
+    {
+        static_assert(boost::describe::has_describe_enumerators<TEnum>::value,
+                      "The enum must be declared with BOOST_DESCRIBE_ENUM.");
+
+        using Underlying = std::underlying_type_t<TEnum>;
+
+        struct Entry
+        {
+            std::string_view Name;
+            TEnum Value;
+        };
+
+        static constexpr std::size_t Size = boost::mp11::mp_size<boost::describe::describe_enumerators<TEnum>>::value;
+
+        using Table = std::array<Entry, Size>;
+
+    public:
+        /**
+         * @brief Get the name of an enumerator.
+         *
+         * @param[in] value The enum value.
+         *
+         * @return The name of the enumerator, empty if the value is not one of the enumerators.
+         */
+        static constexpr std::string_view ToString(TEnum value) noexcept
+        {
+            std::size_t low = 0;
+            std::size_t high = Size;
+
+            while (low < high)
+            {
+                const std::size_t middle = low + (high - low) / 2;
+
+                if (static_cast<Underlying>(ByValue[middle].Value) < static_cast<Underlying>(value))
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            return (low < Size && ByValue[low].Value == value) ? ByValue[low].Name : std::string_view();
+        }
+
+        /**
+         * @brief Find the enumerator of a name, the names are case sensitive.
+         *
+         * @param[in] name The name of the enumerator.
+         * @param[out] value The enum value, left untouched if the name is unknown.
+         *
+         * @return True if the name is one of the enumerators.
+         */
+        static constexpr bool TryParse(std::string_view name, TEnum& value) noexcept
+        {
+            std::size_t low = 0;
+            std::size_t high = Size;
+
+            while (low < high)
+            {
+                const std::size_t middle = low + (high - low) / 2;
+
+                if (ByName[middle].Name < name)
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            if (low < Size && ByName[low].Name == name)
+            {
+                value = ByName[low].Value;
+                return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Get the enumerator of a name.
+         *
+         * @param[in] name The name of the enumerator.
+         *
+         * @return The enum value.
+         *
+         * @throw XSerialization If the name is not one of the enumerators.
+         */
+        static TEnum Parse(std::string_view name)
+        {
+            TEnum value{};
+
+            if (!TryParse(name, value))
+            {
+                throw Exceptions::XSerialization("Unknown enumerator '" + std::string(name) + "'!");
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Wrap an enumerator, so that it can be stored into OtherData, PageResults or MetricData.
+         *
+         * @param[in] value The enum value.
+         *
+         * @return The value holding the name of the enumerator.
+         *
+         * @throw XSerialization If the value is not one of the enumerators.
+         */
+        static SerializationValue ToValue(TEnum value)
+        {
+            const std::string_view name = ToString(value);
+
+            if (name.empty())
+            {
+                throw Exceptions::XSerialization("Unknown enum value " +
+                                                 std::to_string(static_cast<Underlying>(value)) + "!");
+            }
+
+            return SerializationValue{EnumName{name}};
+        }
+
+        /**
+         * @brief Get the enumerator held by a policy value, e.g. a Settings entry.
+         *
+         * @param[in] value The policy value, a string.
+         *
+         * @return The enum value.
+         *
+         * @throw XSerialization If the value is not a string or not one of the enumerators.
+         */
+        static TEnum FromValue(const DeserializationValue& value)
+        {
+            const std::string* name = boost::variant2::get_if<std::string>(&value.data);
+
+            if (nullptr == name)
+            {
+                throw Exceptions::XSerialization("Enumerators must be strings!");
+            }
+
+            return Parse(*name);
+        }
+
+    private:
+        template <template <typename...> class TList, typename... TDescriptors>
+        static constexpr Table Collect(TList<TDescriptors...>)
+        {
+            return Table{{Entry{TDescriptors::name, TDescriptors::value}...}};
+        }
+
+        /**
+         * @brief Sort the enumerators at compile time, an insertion sort is plenty for the size of an enum.
+         */
+        template <typename TLess>
+        static constexpr Table Sort(Table table, TLess less)
+        {
+            for (std::size_t index = 1; index < Size; ++index)
+            {
+                const Entry entry = table[index];
+                std::size_t position = index;
+
+                for (; position > 0 && less(entry, table[position - 1]); --position)
+                {
+                    table[position] = table[position - 1];
+                }
+
+                table[position] = entry;
+            }
+
+            return table;
+        }
+
+        static const Table ByValue;
+
+        static const Table ByName;
+    };
+
+    // The tables are defined out of the class, their initializers need the complete class.
+
+    template <typename TEnum>
+    constexpr typename DescribedEnum<TEnum>::Table DescribedEnum<TEnum>::ByValue =
+        DescribedEnum<TEnum>::Sort(DescribedEnum<TEnum>::Collect(boost::describe::describe_enumerators<TEnum>()),
+                                   [](const Entry& left, const Entry& right)
+                                   { return static_cast<Underlying>(left.Value) < static_cast<Underlying>(right.Value); });
+
+    template <typename TEnum>
+    constexpr typename DescribedEnum<TEnum>::Table DescribedEnum<TEnum>::ByName =
+        DescribedEnum<TEnum>::Sort(DescribedEnum<TEnum>::Collect(boost::describe::describe_enumerators<TEnum>()),
+                                   [](const Entry& left, const Entry& right)
+                                   { return left.Name < right.Name; });
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_DESCRIBEDENUM_HPP
@@ -0,0 +1,159 @@
+/*************************************************************************************************
+ * @file DescribedMemberReader.hpp
+ *
+ * @brief Declarations for the concrete class @ref DescribedMemberReader.
+ *
+ * It matches the members of a json object against the fields of a described struct.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_DESCRIBEDMEMBERREADER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_DESCRIBEDMEMBERREADER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/SerializableDataModels.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    namespace bd = boost::describe;
+    namespace bj = boost::json;
+
+    /**
+     * @class DescribedMemberReader
+     *
+     * @brief Ordered matching of the json members against the described fields.
+     *
+     * The members are walked in document order alongside the fields in declaration order. A document written in
+     * the canonical order, the one the serializer writes, is matched by comparing each key with the expected
+     * name only, without any lookup. A member found out of order is looked up by key and the walk resumes right
+     * after it, so a single misplaced member only costs a single lookup.
+     *
+     * The unknown members are only searched for when the object has more members than the fields matched, which
+     * never happens for a well-formed document.
+     */
+    class DescribedMemberReader
+    {
+    public:
+        /**
+         * @brief Read the members of a json object into the fields of a described struct.
+         *
+         * @tparam TElement A described struct.
+         * @tparam TReadField Callable taking the json value of a member and a reference to its field.
+         *
+         * @param[in] obj The json object.
+         * @param[in,out] element The struct to fill, the missing fields are left untouched.
+         * @param[in] readField Reader of a single field.
+         * @param[in] options Handling of the unknown and missing members.
+         * @param[in,out] report Receiver of the collected names, may be null to drop them.
+         *
+         * @throw XSerialization If a member is unknown or missing and the policy is @ref MemberKeyPolicy::Error.
+         */
+        template <typename TElement,
+                  typename TReadField,
+                  typename TPublic = bd::describe_members<TElement, bd::mod_public | bd::mod_protected>>
+        static void Read(const bj::object& obj,
+                         TElement& element,
+                         TReadField&& readField,
+                         const MemberMatchingOptions& options = {},
+                         MemberMatchingReport* report = nullptr)
+        {
+            bj::object::const_iterator cursor = obj.begin();
+            std::size_t matchedCount = 0;
+
+            boost::mp11::mp_for_each<TPublic>([&](auto D)
+                                              { matchedCount += ReadMember(obj, cursor, D.name, element.*D.pointer,
+                                                                           readField, options, report); });
+
+            if (matchedCount < obj.size() && MemberKeyPolicy::Ignore != options.UnknownKeys)
+            {
+                for (const bj::key_value_pair& member : obj)
+                {
+                    bool known = false;
+
+                    boost::mp11::mp_for_each<TPublic>([&](auto D)
+                                                      { known = known || (member.key() == bj::string_view(D.name)); });
+
+                    if (!known)
+                    {
+                        HandleMember(options.UnknownKeys, "Unknown", member.key(),
+                                     (nullptr == report) ? nullptr : &report->UnknownKeys);
+                    }
+                }
+            }
+        }
+
+    private:
+        /**
+         * @brief Read the member of a field, the one under the cursor if it matches or else the one of its key.
+         *
+         * @param[in] obj The json object.
+         * @param[in,out] cursor Next member in document order, moved past the member read.
+         * @param[in] name Name of the field.
+         * @param[in,out] field The field.
+         * @param[in] readField Reader of a single field.
+         * @param[in] options Handling of the missing members.
+         * @param[in,out] report Receiver of the collected names, may be null.
+         *
+         * @return 1 if the member was read, 0 if it is missing.
+         */
+        template <typename TField, typename TReadField>
+        static std::size_t ReadMember(const bj::object& obj,
+                                      bj::object::const_iterator& cursor,
+                                      const char* name,
+                                      TField& field,
+                                      TReadField& readField,
+                                      const MemberMatchingOptions& options,
+                                      MemberMatchingReport* report)
+        {
+            const bj::string_view key(name);
+            bj::object::const_iterator member = cursor;
+
+            if (obj.end() == member || member->key() != key)
+            {
+                // Out of the canonical order, fall back to the keyed lookup.
+                member = obj.find(key);
+
+                if (obj.end() == member)
+                {
+                    HandleMember(options.MissingKeys, "Missing", key,
+                                 (nullptr == report) ? nullptr : &report->MissingKeys);
+                    return 0;
+                }
+            }
+
+            readField(member->value(), field);
+            cursor = member + 1;
+
+            return 1;
+        }
+
+        /**
+         * @brief Apply the policy of an unmatched member.
+         *
+         * @param[in] policy The policy of the kind of the member.
+         * @param[in] kind Kind of the member, for the error message.
+         * @param[in] name The key of the member.
+         * @param[in,out] names Collected names of the kind of the member, may be null.
+         */
+        static void HandleMember(MemberKeyPolicy policy, const char* kind, bj::string_view name,
+                                 std::vector<std::string>* names)
+        {
+            if (MemberKeyPolicy::Error == policy)
+            {
+                throw Exceptions::XSerialization(std::string(kind) + " member '" +
+                                                 std::string(name.data(), name.size()) + "'!");
+            }
+
+            if (MemberKeyPolicy::Collect == policy && nullptr != names)
+            {
+                names->emplace_back(name.data(), name.size());
+            }
+        }
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_DESCRIBEDMEMBERREADER_HPP
@@ -0,0 +1,29 @@
+/*************************************************************************************************
+ * @file ElapsedTime.hpp
+ *
+ * @brief Helpers to measure the time elapsed between two points of the steady clock.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_ELAPSEDTIME_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_ELAPSEDTIME_HPP
+
+#include "CommonConfig.hpp"
+
+#include <chrono>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @brief Get the nanoseconds elapsed between two time points, 0 if they are out of order.
+     */
+    inline uint64_t GetElapsedNanoseconds(std::chrono::steady_clock::time_point from,
+                                          std::chrono::steady_clock::time_point to)
+    {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+        return (elapsed > 0) ? static_cast<uint64_t>(elapsed) : 0;
+    }
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_ELAPSEDTIME_HPP
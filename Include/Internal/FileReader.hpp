@@ -0,0 +1,52 @@
+/*************************************************************************************************
+ * @file FileReader.hpp
+ *
+ * @brief Helpers to read the files given to the library and to the program.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_FILEREADER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_FILEREADER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @brief Read a whole file.
+     *
+     * @param[in] path Path of the file.
+     * @param[in] kind What the file holds, e.g. "policy", it is part of the error messages.
+     *
+     * @return The content of the file.
+     *
+     * @throw XInvalidArgument If the file cannot be read.
+     */
+    inline std::string ReadWholeFile(const std::string& path, const std::string& kind)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file)
+        {
+            throw Exceptions::XInvalidArgument("Cannot open " + kind + " file: " + path);
+        }
+
+        std::ostringstream content;
+        content << file.rdbuf();
+
+        if (file.bad())
+        {
+            throw Exceptions::XInvalidArgument("Cannot read " + kind + " file: " + path);
+        }
+
+        return content.str();
+    }
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_FILEREADER_HPP
@@ -0,0 +1,340 @@
+/*************************************************************************************************
+ * @file InPlaceDeserializer.hpp
+ *
+ * @brief Declarations for the concrete class @ref InPlaceDeserializer.
+ *
+ * It fills an existing policy from a parsed json value, reusing the memory the policy already owns.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_INPLACEDESERIALIZER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_INPLACEDESERIALIZER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include "Internal/BoostJsonSerializerInfra.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class InPlaceDeserializer
+     *
+     * @brief Deserializer of the policies into existing instances, the counterpart of boost::json::value_to.
+     *
+     * The maps are not rebuilt: the entries whose keys are still present are assigned in place and the nodes of
+     * the others are renamed for the new members, so the nodes and the capacity of the key strings and of the
+     * string values are reused. Deserializing policies of the same shape again and again allocates nothing once
+     * the first one has been read.
+     *
+     * The strings are copied out of the parsed document, a boost::json::string cannot hand its buffer over to a
+     * std::string, but they are copied into the capacity the policy already has.
+     *
+     * A @ref PmrTestDataTestPolicy is filled the same way, its new nodes and strings being allocated from the memory
+     * resource of its maps.
+     *
+     * The accepted documents and the reported errors are the same as boost::json::value_to's with the overloads of
+     * BoostJsonSerializerInfra.hpp.
+     */
+    class InPlaceDeserializer
+    {
+    public:
+        using ValueMap = std::map<std::string, DeserializationValue>;
+
+        using PmrValueMap = std::pmr::map<std::pmr::string, PmrDeserializationValue>;
+
+        /**
+         * @struct Scratch
+         *
+         * @brief Working memory of the calls, kept by the caller so that its capacity is reused from one call to
+         * the next.
+         */
+        struct Scratch
+        {
+            /**
+             * @brief The members of the object being read, sorted by key.
+             */
+            std::vector<const bj::key_value_pair*> Members;
+
+            /**
+             * @brief The nodes detached from the map being filled, waiting to be renamed.
+             */
+            std::vector<ValueMap::node_type> Nodes;
+
+            /**
+             * @brief The nodes detached from the polymorphic allocator map being filled.
+             */
+            std::vector<PmrValueMap::node_type> PmrNodes;
+        };
+
+        /**
+         * @brief Fill an existing described struct from a parsed json value.
+         *
+         * @tparam TElement A described struct of maps of @ref DeserializationValue or @ref PmrDeserializationValue,
+         * e.g. @ref TestDataTestPolicy.
+         *
+         * @param[in] value The parsed payload.
+         * @param[in,out] element The struct to fill, it is partially filled if an exception is thrown.
+         * @param[in,out] scratch Working memory of the call.
+         * @param[in] options Handling of the unknown and missing members of the described structs.
+         * @param[in,out] report Receiver of the names collected by the options, may be null.
+         *
+         * @throw XSerialization On getting an unexpected value type, or an unknown or missing member the options
+         * make an error.
+         * @throw std::exception Any exception boost::json::value_to would throw for the same document.
+         */
+        template <typename TElement,
+                  typename TEnableIf = std::enable_if_t<bd::has_describe_members<TElement>::value>>
+        static void Deserialize(const bj::value& value,
+                                TElement& element,
+                                Scratch& scratch,
+                                const MemberMatchingOptions& options = {},
+                                MemberMatchingReport* report = nullptr)
+        {
+            DescribedMemberReader::Read(value.as_object(), element, [&](const bj::value& member, auto& field)
+                                        { Deserialize(member, field, scratch, options, report); },
+                                        options, report);
+        }
+
+        /**
+         * @brief Fill an existing map from a parsed json object.
+         *
+         * The members and the entries are merged in key order: an entry whose key is still present is assigned in
+         * place, the nodes of the entries that are gone are renamed for the new members and only the members left
+         * over allocate new nodes. Any key is accepted, the member matching options only apply to described structs.
+         *
+         * @param[in] value The parsed object.
+         * @param[in,out] map The map to fill, it holds exactly the members of the object once filled.
+         * @param[in,out] scratch Working memory of the call.
+         *
+         * @throw XSerialization On getting an unexpected value type.
+         */
+        static void Deserialize(const bj::value& value,
+                                ValueMap& map,
+                                Scratch& scratch,
+                                const MemberMatchingOptions& = {},
+                                MemberMatchingReport* = nullptr)
+        {
+            DeserializeMap(value, map, scratch.Nodes, scratch);
+        }
+
+        /**
+         * @brief Fill an existing polymorphic allocator map from a parsed json object, like a @ref ValueMap.
+         *
+         * @param[in] value The parsed object.
+         * @param[in,out] map The map to fill, its new nodes and strings are allocated from its memory resource.
+         * @param[in,out] scratch Working memory of the call.
+         *
+         * @throw XSerialization On getting an unexpected value type.
+         */
+        static void Deserialize(const bj::value& value,
+                                PmrValueMap& map,
+                                Scratch& scratch,
+                                const MemberMatchingOptions& = {},
+                                MemberMatchingReport* = nullptr)
+        {
+            DeserializeMap(value, map, scratch.PmrNodes, scratch);
+        }
+
+        /**
+         * @brief Assign a parsed scalar to an existing value, a string value keeps its capacity.
+         *
+         * @param[in] value The parsed scalar.
+         * @param[in,out] data The value to assign.
+         *
+         * @throw XSerialization On getting an unexpected value type.
+         */
+        static void Deserialize(const bj::value& value, DeserializationValue& data)
+        {
+            DeserializeScalar(value, data, std::allocator<char>());
+        }
+
+        /**
+         * @brief Assign a parsed scalar to an existing polymorphic allocator value.
+         *
+         * @param[in] value The parsed scalar.
+         * @param[in,out] data The value to assign.
+         * @param[in] allocator The allocator of a new string, the one of the map holding the value.
+         *
+         * @throw XSerialization On getting an unexpected value type.
+         */
+        static void Deserialize(const bj::value& value, PmrDeserializationValue& data, const PmrAllocator& allocator)
+        {
+            DeserializeScalar(value, data, allocator);
+        }
+
+    private:
+        /**
+         * @brief Releases the detached nodes and the members of a call, whichever way the call leaves.
+         *
+         * The nodes of a polymorphic allocator map must not outlive the call, the memory resource they were
+         * allocated from may be destroyed before the next call.
+         */
+        template <typename TNode>
+        class ScratchReleaser
+        {
+        public:
+            ScratchReleaser(std::vector<TNode>& nodes, Scratch& scratch)
+                : _nodes(nodes),
+                  _scratch(scratch)
+            {
+            }
+
+            ~ScratchReleaser()
+            {
+                _nodes.clear();
+                _scratch.Members.clear();
+            }
+
+        private:
+            DECLARE_NON_COPYABLE_CLASS(ScratchReleaser)
+
+            std::vector<TNode>& _nodes;
+
+            Scratch& _scratch;
+        };
+
+        // #region Private Methods
+
+        template <typename TMap>
+        static void DeserializeMap(const bj::value& value,
+                                   TMap& map,
+                                   std::vector<typename TMap::node_type>& nodes,
+                                   Scratch& scratch)
+        {
+            const bj::object& obj = value.as_object();
+            const typename TMap::key_type::allocator_type allocator(map.get_allocator());
+
+            scratch.Members.clear();
+            nodes.clear();
+
+            // Also releases the nodes of the entries the document no longer has, once the map is filled.
+            ScratchReleaser<typename TMap::node_type> releaser(nodes, scratch);
+
+            for (const bj::key_value_pair& member : obj)
+            {
+                scratch.Members.push_back(&member);
+            }
+
+            // The members of an object are contiguous, ordering the duplicated keys by address keeps the last one
+            // assigned last, so that it wins. Unlike std::stable_sort, std::sort never allocates.
+            std::sort(scratch.Members.begin(), scratch.Members.end(),
+                      [](const bj::key_value_pair* left, const bj::key_value_pair* right)
+                      {
+                          const int comparison = left->key().compare(right->key());
+                          return (comparison < 0) || (0 == comparison && std::less<>()(left, right));
+                      });
+
+            std::size_t newCount = 0;
+            typename TMap::iterator entry = map.begin();
+
+            for (const bj::key_value_pair* member : scratch.Members)
+            {
+                const bj::string_view key = member->key();
+
+                while (map.end() != entry && bj::string_view(entry->first) < key)
+                {
+                    nodes.push_back(map.extract(entry++));
+                }
+
+                if (map.end() != entry && bj::string_view(entry->first) == key)
+                {
+                    DeserializeScalar(member->value(), entry->second, allocator);
+                }
+                else
+                {
+                    // Inserted once all the stale entries are detached, the members are compacted to the front.
+                    scratch.Members[newCount++] = member;
+                }
+            }
+
+            while (map.end() != entry)
+            {
+                nodes.push_back(map.extract(entry++));
+            }
+
+            for (std::size_t index = 0; index < newCount; ++index)
+            {
+                const bj::key_value_pair* member = scratch.Members[index];
+                const bj::string_view key = member->key();
+
+                if (nodes.empty())
+                {
+                    // Constructed by the map, so that a polymorphic allocator value gets its memory resource.
+                    typename TMap::mapped_type& data =
+                        map.try_emplace(typename TMap::key_type(key.data(), key.size(), allocator)).first->second;
+                    DeserializeScalar(member->value(), data, allocator);
+                    continue;
+                }
+
+                typename TMap::node_type node = std::move(nodes.back());
+                nodes.pop_back();
+
+                node.key().assign(key.data(), key.size());
+                DeserializeScalar(member->value(), node.mapped(), allocator);
+
+                typename TMap::insert_return_type inserted = map.insert(std::move(node));
+
+                if (!inserted.inserted)
+                {
+                    // A duplicated key, the last member wins.
+                    inserted.position->second = std::move(inserted.node.mapped());
+                    nodes.push_back(std::move(inserted.node));
+                }
+            }
+        }
+
+        template <typename TData, typename TAllocator>
+        static void DeserializeScalar(const bj::value& value, TData& data, const TAllocator& allocator)
+        {
+            using TString = std::decay_t<decltype(bv2::get<0>(data.data))>;
+
+            switch (value.kind())
+            {
+            case bj::kind::string:
+            {
+                const bj::string& text = value.get_string();
+
+                if (TString* current = bv2::get_if<TString>(&data.data))
+                {
+                    current->assign(text.data(), text.size());
+                }
+                else
+                {
+                    data.data.template emplace<TString>(text.data(), text.size(), allocator);
+                }
+
+                break;
+            }
+            case bj::kind::int64:
+                data.data = value.get_int64();
+                break;
+            case bj::kind::uint64:
+                data.data = value.get_uint64();
+                break;
+            case bj::kind::double_:
+                data.data = value.get_double();
+                break;
+            case bj::kind::bool_:
+                data.data = value.get_bool();
+                break;
+            case bj::kind::null:
+            case bj::kind::object:
+            case bj::kind::array:
+                throw Exceptions::XSerialization("Unexpected Json value type!");
+            default:
+                throw Exceptions::XSerialization("Unknown Json value type!");
+            }
+        }
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_INPLACEDESERIALIZER_HPP
@@ -0,0 +1,81 @@
+/*************************************************************************************************
+ * @file JsonBulkDeserializer.hpp
+ *
+ * @brief Declarations for the concrete class @ref JsonBulkDeserializer.
+ *
+ * The documents of a stream are split by @ref JsonDocumentSplitter and de-serialized in parallel.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONBULKDESERIALIZER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONBULKDESERIALIZER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Interfaces/IJsonBulkDeserializer.hpp"
+#include "Interfaces/IJsonDataSerializer.hpp"
+#include "Internal/ThreadPool.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class JsonBulkDeserializer
+     *
+     * @brief Concrete implementation of the multi-document policy de-serializer.
+     */
+    class JsonBulkDeserializer : public Interfaces::IJsonBulkDeserializer
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new bulk de-serializer object.
+         *
+         * @param[in] serializer The serializer used for every single document, it must be safe to share across threads.
+         * @param[in] threadPool The pool on which the documents are de-serialized.
+         *
+         * @throw XArgumentNull If input params are null.
+         */
+        JsonBulkDeserializer(std::shared_ptr<Interfaces::IJsonDataSerializer> serializer,
+                             std::shared_ptr<ThreadPool> threadPool);
+
+        /**
+         * @brief Destroy the bulk de-serializer object.
+         */
+        virtual ~JsonBulkDeserializer() override;
+
+        // #endregion
+
+        // #region IJsonBulkDeserializer Implementation
+
+        /**
+         * @copydoc IJsonBulkDeserializer::DeserializeAll
+         *
+         * The calling thread takes part in the work, so it is safe to call this method from a task of the same pool.
+         */
+        virtual std::vector<TestDataPolicyRecord> DeserializeAll(const std::string& stream,
+                                                                 JsonStreamFraming framing) override;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(JsonBulkDeserializer)
+
+        // #region Private Members
+
+        /**
+         * @brief The serializer shared by all the workers.
+         */
+        std::shared_ptr<Interfaces::IJsonDataSerializer> _serializer;
+
+        /**
+         * @brief Pool of worker threads.
+         */
+        std::shared_ptr<ThreadPool> _threadPool;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONBULKDESERIALIZER_HPP
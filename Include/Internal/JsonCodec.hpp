@@ -0,0 +1,295 @@
+/*************************************************************************************************
+ * @file JsonCodec.hpp
+ *
+ * @brief Declarations for the concrete class @ref JsonCodec.
+ *
+ * It serializes and deserializes any described type without going through the serializer interfaces.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONCODEC_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONCODEC_HPP
+
+#include "CommonConfig.hpp"
+
+#include <set>
+#include <stdexcept>
+#include <string_view>
+#include <typeinfo>
+
+#include "Interfaces/IChunkSink.hpp"
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/JsonValueWriter.hpp"
+#include "Internal/LimitedJsonParser.hpp"
+#include "Internal/SerializedSizeCalculator.hpp"
+#include "Internal/TraceRecorder.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class JsonCodec
+     *
+     * @brief Header only codec of the data models and of any other type declared with BOOST_DESCRIBE_STRUCT.
+     *
+     * The calls are plain templates, so small messages such as heartbeats or a single @ref TestDataMetrics are
+     * encoded without any virtual dispatch or shared pointer, and the conversions are specialized for the type at
+     * compile time. It is also the pipeline @ref BoostJsonSerializerImpl runs within its per-thread scratch
+     * contexts: the same conversions, the same writer, an output reserved once by @ref SerializedSizeCalculator,
+     * the same @ref LimitedJsonParser and the same translation of the errors.
+     *
+     * The intermediate json values of the calls without storage live in a stack buffer and only spill to the
+     * heap for large entities. For those, the per-thread scratch contexts of @ref BoostJsonSerializerImpl remain
+     * the better choice.
+     *
+     * The described types of other namespaces need #BOOST_AUTO_JSON_SERIALIZER_USE_CONVERSIONS in their namespace
+     * to be converted the same way as the data models.
+     */
+    class JsonCodec
+    {
+    public:
+        /**
+         * @brief Size of the stack buffer of the intermediate json values.
+         */
+        static constexpr std::size_t StackBufferSize = 4096;
+
+        /**
+         * @brief Category of the trace events of the calls, unless the caller gives its own.
+         */
+        static constexpr const char* TraceCategory = "JsonCodec";
+
+        /**
+         * @brief Serialize an entity into stringified JSON.
+         *
+         * @tparam TElement A described struct, or any type @ref SerializedSizeCalculator can size.
+         *
+         * @param[in] entity The entity to be serialized.
+         *
+         * @return The serialized JSON payload.
+         *
+         * @throw XSerialization If the entity cannot be converted.
+         */
+        template <typename TElement>
+        static std::string Serialize(const TElement& entity)
+        {
+            std::string payload;
+            Serialize(entity, payload);
+
+            return payload;
+        }
+
+        /**
+         * @brief Serialize an entity and append it to an existing string, so that its capacity can be reused.
+         *
+         * @tparam TElement A described struct, or any type @ref SerializedSizeCalculator can size.
+         *
+         * @param[in] entity The entity to be serialized.
+         * @param[in,out] output The string to be appended.
+         *
+         * @throw XSerialization If the entity cannot be converted.
+         */
+        template <typename TElement>
+        static void Serialize(const TElement& entity, std::string& output)
+        {
+            unsigned char buffer[StackBufferSize];
+            bj::monotonic_resource resource(buffer, sizeof(buffer));
+
+            Serialize(entity, output, bj::storage_ptr(&resource));
+        }
+
+        /**
+         * @brief Serialize an entity and append it to an existing string, the json values in a given storage.
+         *
+         * @tparam TElement A described struct, or any type @ref SerializedSizeCalculator can size.
+         *
+         * @param[in] entity The entity to be serialized.
+         * @param[in,out] output The string to be appended.
+         * @param[in] storage Storage of the intermediate json values, they are destroyed before the call returns.
+         * @param[in] traceRecorder Recorder of the phases of the call, null to disable the tracing.
+         * @param[in] traceCategory Category of the trace events, it must be a string literal.
+         *
+         * @throw XSerialization If the entity cannot be converted.
+         */
+        template <typename TElement>
+        static void Serialize(const TElement& entity, std::string& output, bj::storage_ptr storage,
+                              TraceRecorder* traceRecorder = nullptr, const char* traceCategory = TraceCategory)
+        {
+            try
+            {
+                // The value shares the storage of the converted entity, so assigning the entity moves it.
+                bj::value value(storage);
+
+                {
+                    TraceScope convertScope(traceRecorder, traceCategory, "Convert");
+                    value = bj::value_from(entity, storage);
+                }
+
+                {
+                    TraceScope sizeScope(traceRecorder, traceCategory, "Size");
+
+                    // Sized up front so that large results are written without any reallocation.
+                    const std::size_t size = SerializedSizeCalculator::Calculate(entity);
+                    output.reserve(output.size() + size);
+                    sizeScope.SetBytes(size);
+                }
+
+                TraceScope formatScope(traceRecorder, traceCategory, "Format");
+                const std::size_t initialSize = output.size();
+
+                // Written by our own writer so that every string goes through the vectorized escaper.
+                JsonValueWriter::Write(value, output);
+                formatScope.SetBytes(output.size() - initialSize);
+            }
+            catch (const std::exception& ex)
+            {
+                ThrowSerializationException(ex, "Serialization");
+            }
+        }
+
+        /**
+         * @brief Serialize an entity into a sink, chunk by chunk, the json values in a given storage.
+         *
+         * @tparam TElement A described struct.
+         *
+         * @param[in] entity The entity to be serialized.
+         * @param[in,out] sink The destination of the chunks, it is not finished.
+         * @param[in,out] buffer Staging buffer of the chunks, its capacity is reused.
+         * @param[in] chunkSize Minimal size of the chunks but the last one.
+         * @param[in] storage Storage of the intermediate json values, they are destroyed before the call returns.
+         * @param[in] traceRecorder Recorder of the phases of the call, null to disable the tracing.
+         * @param[in] traceCategory Category of the trace events, it must be a string literal.
+         *
+         * @throw XSerialization If the entity cannot be converted.
+         */
+        template <typename TElement>
+        static void Serialize(const TElement& entity, Interfaces::IChunkSink& sink, std::string& buffer,
+                              std::size_t chunkSize, bj::storage_ptr storage, TraceRecorder* traceRecorder = nullptr,
+                              const char* traceCategory = TraceCategory)
+        {
+            try
+            {
+                bj::value value(storage);
+
+                {
+                    TraceScope convertScope(traceRecorder, traceCategory, "Convert");
+                    value = bj::value_from(entity, storage);
+                }
+
+                TraceScope formatScope(traceRecorder, traceCategory, "Format");
+
+                // Only a chunk of the text is held at a time.
+                buffer.reserve(chunkSize + JsonValueWriter::MaxNumberLength);
+                JsonValueWriter::Write(value, buffer, sink, chunkSize);
+            }
+            catch (const std::exception& ex)
+            {
+                ThrowSerializationException(ex, "Serialization");
+            }
+        }
+
+        /**
+         * @brief Deserialize stringified JSON into an entity.
+         *
+         * @tparam TElement A described struct, or any type boost::json::value_to can convert to.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in] configuration Parse options and limits of the payload.
+         *
+         * @return The deserialized entity.
+         *
+         * @throw XInvalidArgument If the configuration is not supported.
+         * @throw XSerialization If the payload is not json, exceeds a limit or does not match the entity.
+         */
+        template <typename TElement>
+        static TElement Deserialize(std::string_view payload, const JsonParseConfiguration& configuration = {})
+        {
+            LimitedJsonParser parser(configuration);
+
+            return Deserialize<TElement>(payload, parser);
+        }
+
+        /**
+         * @brief Deserialize stringified JSON into an entity with a parser reused from one call to the next.
+         *
+         * @tparam TElement A described struct, or any type boost::json::value_to can convert to.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in,out] parser The parser, along with its options and limits.
+         *
+         * @return The deserialized entity.
+         *
+         * @throw XSerialization If the payload is not json, exceeds a limit or does not match the entity.
+         */
+        template <typename TElement>
+        static TElement Deserialize(std::string_view payload, LimitedJsonParser& parser)
+        {
+            unsigned char buffer[StackBufferSize];
+            bj::monotonic_resource resource(buffer, sizeof(buffer));
+
+            try
+            {
+                const bj::value value = Parse(payload, parser, bj::storage_ptr(&resource));
+
+                return bj::value_to<TElement>(value);
+            }
+            catch (const std::exception& ex)
+            {
+                ThrowSerializationException(ex, "Deserialization");
+            }
+        }
+
+        /**
+         * @brief Parse a whole document into a json value, within the limits of a parser.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in,out] parser The parser, along with its options and limits.
+         * @param[in] storage Storage of the json value.
+         *
+         * @return The json value.
+         *
+         * @throw XSerialization If the payload is not json or exceeds a limit.
+         */
+        static bj::value Parse(std::string_view payload, LimitedJsonParser& parser, bj::storage_ptr storage)
+        {
+            bj::error_code errorCode;
+            bj::value value = parser.Parse(payload, std::move(storage), errorCode);
+
+            if (errorCode)
+            {
+                throw Exceptions::XSerialization(std::string("Deserialization -> ") + errorCode.message());
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief A common exception handler that handles all exceptions related to serialization errors.
+         *
+         * The conversion errors of boost json are translated into @ref XSerialization, any other exception is
+         * rethrown as is. It must be called from a catch block.
+         *
+         * @param[in] ex base exception which is carrying actual exception object.
+         * @param[in] errorMessage A message to prefixed with exception info.
+         */
+        [[noreturn]] static void ThrowSerializationException(const std::exception& ex, const std::string& errorMessage)
+        {
+            static const std::set<const std::type_info*> SerializationException = {
+                /* &typeid(boost::wrapexcept<std::bad_alloc>) */
+                &typeid(boost::wrapexcept<std::invalid_argument>),
+                &typeid(boost::wrapexcept<std::length_error>),
+                &typeid(boost::wrapexcept<std::out_of_range>),
+                &typeid(boost::wrapexcept<boost::system::system_error>)};
+
+            if (SerializationException.count(&typeid(ex)))
+            {
+                throw Exceptions::XSerialization(errorMessage + std::string(" -> ") + ex.what());
+            }
+
+            throw;
+        }
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONCODEC_HPP
@@ -11,8 +11,12 @@
 
 #include "CommonConfig.hpp"
 
+#include <type_traits>
+
+#include "Interfaces/IExecutor.hpp"
 #include "Interfaces/IJsonDataSerializer.hpp"
 #include "Interfaces/IJsonDataSerializerImpl.hpp"
+#include "Internal/PerformanceCounters.hpp"
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
@@ -28,7 +32,8 @@ namespace Internal
         // #region Construction/Destruction
 
         /**
-         * @brief Construct a new test data serializer object.
+         * @brief Construct a new test data serializer object, its asynchronous operations run on the calling
+         * thread.
          *
          * @param[in] impl Any instance of underlying implementation layer.
          *
@@ -36,6 +41,17 @@ namespace Internal
          */
         explicit JsonDataSerializer(std::shared_ptr<Interfaces::IJsonDataSerializerImpl> impl);
 
+        /**
+         * @brief Construct a new test data serializer object running its asynchronous operations on an executor.
+         *
+         * @param[in] impl Any instance of underlying implementation layer.
+         * @param[in] executor The executor of the asynchronous operations.
+         *
+         * @throw XArgumentNullException If input params are null.
+         */
+        JsonDataSerializer(std::shared_ptr<Interfaces::IJsonDataSerializerImpl> impl,
+                           std::shared_ptr<Interfaces::IExecutor> executor);
+
         /**
          * @brief Destroy the JSON serializer object.
          */
@@ -47,13 +63,85 @@ namespace Internal
 
         virtual TestDataTestPolicy Deserialize(const std::string& payload) override;
 
+        virtual void Deserialize(const std::string& payload, TestDataTestPolicy& policy) override;
+
+        virtual PmrTestDataTestPolicy Deserialize(const std::string& payload,
+                                                  std::pmr::memory_resource* resource) override;
+
         virtual std::string Serialize(const TestDataTestResults& entity) override;
 
+        virtual void Serialize(const TestDataTestResults& entity, Interfaces::IChunkSink& sink) override;
+
+        virtual std::size_t GetSerializedSize(const TestDataTestResults& entity) override;
+
+        virtual std::future<TestDataTestPolicy> DeserializeAsync(std::string&& payload) override;
+
+        virtual std::future<std::string> SerializeAsync(TestDataTestResults&& entity) override;
+
+        // #endregion
+
+        // #region IPerformanceCounters Implementation
+
+        virtual PerformanceSnapshot GetPerformanceSnapshot() const override;
+
         // #endregion
 
     private:
         DECLARE_NON_COPYABLE_CLASS(JsonDataSerializer)
 
+        /**
+         * @brief Indexes of the counted operations.
+         */
+        enum CountedOperation : std::size_t
+        {
+            DeserializeOperation,
+            SerializeOperation
+        };
+
+        // #region Private Methods
+
+        /**
+         * @brief Deserialize through the implementation layer and count the call.
+         */
+        static TestDataTestPolicy CountedDeserialize(Interfaces::IJsonDataSerializerImpl& impl,
+                                                     PerformanceCounters& counters,
+                                                     const std::string& payload);
+
+        /**
+         * @brief Serialize through the implementation layer and count the call.
+         */
+        static std::string CountedSerialize(Interfaces::IJsonDataSerializerImpl& impl,
+                                            PerformanceCounters& counters,
+                                            const TestDataTestResults& entity);
+
+        /**
+         * @brief Time a call of the implementation layer and count it as a success or as a failure.
+         *
+         * @param[in,out] counters The counters of the call.
+         * @param[in] operation The counted operation.
+         * @param[in] bytesIn Size of the input of the call.
+         * @param[in] call The call, it sets the size of its output through its only argument.
+         *
+         * @return The result of the call.
+         *
+         * @throw std::exception Any exception of the call, counted and rethrown.
+         */
+        template <typename TCall>
+        static auto Measured(PerformanceCounters& counters, CountedOperation operation, uint64_t bytesIn,
+                             TCall&& call) -> std::invoke_result_t<TCall&, uint64_t&>;
+
+        /**
+         * @brief Run a call of the implementation layer on the executor, or on the calling thread without one.
+         *
+         * @param[in] operation The call, it owns its arguments.
+         *
+         * @return A future of the result of the call.
+         */
+        template <typename TResult, typename TOperation>
+        std::future<TResult> RunOnExecutor(TOperation&& operation);
+
+        // #endregion
+
         // #region Private Members
 
         /**
@@ -61,6 +149,16 @@ namespace Internal
          */
         std::shared_ptr<Interfaces::IJsonDataSerializerImpl> _impl;
 
+        /**
+         * @brief Executor of the asynchronous operations, null to run them on the calling thread.
+         */
+        std::shared_ptr<Interfaces::IExecutor> _executor;
+
+        /**
+         * @brief Counters of the calls, shared with the asynchronous operations still running.
+         */
+        std::shared_ptr<PerformanceCounters> _counters;
+
         // #endregion
     };
 } // namespace Internal
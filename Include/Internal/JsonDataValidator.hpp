@@ -11,6 +11,7 @@
 
 #include "Interfaces/IJsonDataValidator.hpp"
 #include "Interfaces/IJsonDataValidatorImpl.hpp"
+#include "Internal/PerformanceCounters.hpp"
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
@@ -47,6 +48,12 @@ namespace Internal
 
         // #endregion
 
+        // #region IPerformanceCounters Implementation
+
+        virtual PerformanceSnapshot GetPerformanceSnapshot() const override;
+
+        // #endregion
+
     private:
         DECLARE_NON_COPYABLE_CLASS(JsonDataValidator)
 
@@ -57,6 +64,11 @@ namespace Internal
          */
         std::shared_ptr<Interfaces::IJsonDataValidatorImpl> _impl;
 
+        /**
+         * @brief Counters of the validations.
+         */
+        PerformanceCounters _counters;
+
         // #endregion
     };
 } // namespace Internal
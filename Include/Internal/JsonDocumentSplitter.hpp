@@ -0,0 +1,72 @@
+/*************************************************************************************************
+ * @file JsonDocumentSplitter.hpp
+ *
+ * @brief Declarations for the concrete class @ref JsonDocumentSplitter.
+ *
+ * It finds the boundaries of the documents of a multi-document JSON stream without parsing them.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONDOCUMENTSPLITTER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONDOCUMENTSPLITTER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string_view>
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @struct JsonDocumentSpan
+     *
+     * @brief Location of a single document within a stream.
+     */
+    struct JsonDocumentSpan
+    {
+        std::size_t Offset = 0;
+        std::size_t Length = 0;
+
+        /**
+         * @brief 1-based line number at which the document starts.
+         */
+        std::size_t LineNumber = 0;
+    };
+
+    /**
+     * @class JsonDocumentSplitter
+     *
+     * @brief Single pass scanner that splits a stream into document spans.
+     *
+     * The scanner only tracks strings, escapes and bracket depth, it does not validate the documents. A malformed
+     * document is still reported as a span so that the parser can report it at its line number.
+     */
+    class JsonDocumentSplitter
+    {
+    public:
+        /**
+         * @brief Split the stream into document spans, in stream order.
+         *
+         * @param[in] stream The multi-document stream.
+         * @param[in] framing How the documents are delimited.
+         *
+         * @return Spans of all the non-blank documents.
+         */
+        static std::vector<JsonDocumentSpan> Split(std::string_view stream, JsonStreamFraming framing);
+
+    private:
+        /**
+         * @brief Split a newline delimited stream, every non-blank line is a document.
+         */
+        static std::vector<JsonDocumentSpan> SplitLines(std::string_view stream);
+
+        /**
+         * @brief Split a concatenated stream by tracking the nesting depth of the documents.
+         */
+        static std::vector<JsonDocumentSpan> SplitConcatenated(std::string_view stream);
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONDOCUMENTSPLITTER_HPP
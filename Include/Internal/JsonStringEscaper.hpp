@@ -0,0 +1,92 @@
+/*************************************************************************************************
+ * @file JsonStringEscaper.hpp
+ *
+ * @brief Declarations for the concrete class @ref JsonStringEscaper.
+ *
+ * All the strings written by the serializer, keys and values alike, are escaped through this class.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONSTRINGESCAPER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONSTRINGESCAPER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string_view>
+
+#include "Internal/CpuFeatures.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class JsonStringEscaper
+     *
+     * @brief Vectorized JSON string escaping.
+     *
+     * The clean runs of a string are located 16 (SSE2) or 32 (AVX2) bytes at a time and copied in bulk, only
+     * quotes, backslashes and control characters are escaped one by one. The instruction set is selected at
+     * runtime, the scalar path is used on CPUs without vector support.
+     */
+    class JsonStringEscaper
+    {
+    public:
+        /**
+         * @brief Maximum length of the escape sequence of a single byte, i.e. "\u001f".
+         */
+        static constexpr std::size_t MaxEscapeSequenceLength = 6;
+
+        /**
+         * @brief Find the first byte that has to be escaped.
+         *
+         * @param[in] data Start of the text.
+         * @param[in] size Size of the text.
+         *
+         * @return Position of the first byte to be escaped, @p size if there is none.
+         */
+        static std::size_t FindEscapable(const char* data, std::size_t size);
+
+        /**
+         * @copydoc FindEscapable(const char*, std::size_t)
+         *
+         * @param[in] level The instruction set to use, it must be supported by the CPU.
+         */
+        static std::size_t FindEscapable(const char* data, std::size_t size, SimdLevel level);
+
+        /**
+         * @brief Write the escape sequence of a byte.
+         *
+         * @param[in] byte A byte that has to be escaped.
+         * @param[out] buffer Output buffer of at least @ref MaxEscapeSequenceLength bytes.
+         *
+         * @return Length of the escape sequence.
+         */
+        static std::size_t EscapeByte(char byte, char* buffer);
+
+        /**
+         * @brief Get the size of the text once quoted and escaped, without escaping it.
+         *
+         * @param[in] text The raw text.
+         *
+         * @return Size of what @ref AppendQuoted appends for the text.
+         */
+        static std::size_t GetQuotedSize(std::string_view text);
+
+        /**
+         * @brief Append the text as a quoted and escaped JSON string.
+         *
+         * @param[in,out] output The string to be appended.
+         * @param[in] text The raw text.
+         */
+        static void AppendQuoted(std::string& output, std::string_view text);
+
+        /**
+         * @copydoc AppendQuoted(std::string&, std::string_view)
+         *
+         * @param[in] level The instruction set to use, it must be supported by the CPU.
+         */
+        static void AppendQuoted(std::string& output, std::string_view text, SimdLevel level);
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONSTRINGESCAPER_HPP
@@ -0,0 +1,74 @@
+/*************************************************************************************************
+ * @file JsonStructuralValidator.hpp
+ *
+ * @brief Declarations for the concrete class @ref JsonStructuralValidator.
+ *
+ * It is the fast path of @ref BoostJsonValidatorImpl for large payloads.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONSTRUCTURALVALIDATOR_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONSTRUCTURALVALIDATOR_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string_view>
+
+#include "Internal/CpuFeatures.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class JsonStructuralValidator
+     *
+     * @brief Two stage JSON validator in the style of simdjson.
+     *
+     * Stage one classifies the payload 64 bytes at a time with vector instructions, it resolves escapes and
+     * string boundaries, rejects control characters within strings, validates UTF-8 and records the positions
+     * of the structural characters, the quotes and the starts of the scalars. Stage two checks the grammar by
+     * walking that index only, the bytes are looked at again for the string escapes and the scalars only.
+     *
+     * The validator is conservative: it accepts a subset of what boost::json::parse accepts with the default
+     * parse options. Inputs it cannot decide cheaply (e.g. exponents of more than 4 digits, nesting at the
+     * depth limit) are reported as not accepted, hence a negative result has to be confirmed with the
+     * reference parser.
+     */
+    class JsonStructuralValidator
+    {
+    public:
+        /**
+         * @brief Nesting depth limit of boost::json::parse with default parse options.
+         */
+        static constexpr std::size_t DefaultMaxDepth = 32;
+
+        /**
+         * @brief Check whether the payload is definitely a well formed JSON text.
+         *
+         * @param[in] payload The JSON text.
+         * @param[in] maxDepth Nesting depth limit of the reference parser.
+         *
+         * @return bool @b true if the reference parser accepts the payload, @b false if it may reject it.
+         */
+        static bool IsAccepted(std::string_view payload, std::size_t maxDepth = DefaultMaxDepth);
+
+        /**
+         * @copydoc IsAccepted(std::string_view, std::size_t)
+         *
+         * @param[in] level The instruction set to use, it must be supported by the CPU.
+         */
+        static bool IsAccepted(std::string_view payload, std::size_t maxDepth, SimdLevel level);
+
+        /**
+         * @brief Check whether the text is valid UTF-8, ASCII runs are skipped with vector instructions.
+         *
+         * @param[in] text The text to check.
+         * @param[in] level The instruction set to use, it must be supported by the CPU.
+         *
+         * @return bool @b true if valid, @b false otherwise.
+         */
+        static bool IsValidUtf8(std::string_view text, SimdLevel level);
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONSTRUCTURALVALIDATOR_HPP
@@ -0,0 +1,121 @@
+/*************************************************************************************************
+ * @file JsonValueWriter.hpp
+ *
+ * @brief Declarations for the concrete class @ref JsonValueWriter.
+ *
+ * It replaces boost::json::serialize so that all the strings are escaped by @ref JsonStringEscaper.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONVALUEWRITER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONVALUEWRITER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Interfaces/IChunkSink.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class JsonValueWriter
+     *
+     * @brief Writes a boost::json::value as compact stringified JSON.
+     */
+    class JsonValueWriter
+    {
+    public:
+        /**
+         * @brief Size of the buffer required by the FormatNumber methods.
+         */
+        static constexpr std::size_t MaxNumberLength = 32;
+
+        /**
+         * @brief Append the compact JSON text of a value.
+         *
+         * @param[in] value The value to be written.
+         * @param[in,out] output The string to be appended.
+         */
+        static void Write(const boost::json::value& value, std::string& output);
+
+        /**
+         * @brief Write the compact JSON text of a value into a sink, chunk by chunk.
+         *
+         * The text is staged in the buffer and handed over to the sink each time it holds at least a chunk, only
+         * between the members and the elements of the containers, so a chunk may exceed the chunk size by a
+         * single scalar. What is left is handed over at the end, the sink is not finished.
+         *
+         * @param[in] value The value to be written.
+         * @param[in,out] buffer Staging buffer, cleared first and left empty, its capacity is reused.
+         * @param[in,out] sink The destination of the chunks.
+         * @param[in] chunkSize Minimal size of the chunks but the last one.
+         */
+        static void Write(const boost::json::value& value,
+                          std::string& buffer,
+                          Interfaces::IChunkSink& sink,
+                          std::size_t chunkSize);
+
+        /**
+         * @brief Get the compact JSON text of a value.
+         *
+         * @param[in] value The value to be written.
+         *
+         * @return The stringified JSON.
+         */
+        static std::string Write(const boost::json::value& value);
+
+        /**
+         * @brief Format a signed integer number.
+         *
+         * @param[in] number The number.
+         * @param[out] buffer Output buffer of at least @ref MaxNumberLength bytes.
+         *
+         * @return Length of the text.
+         */
+        static std::size_t FormatNumber(int64_t number, char* buffer);
+
+        /**
+         * @brief Format an unsigned integer number.
+         *
+         * @copydetails FormatNumber(int64_t, char*)
+         */
+        static std::size_t FormatNumber(uint64_t number, char* buffer);
+
+        /**
+         * @brief Format a floating point number in its shortest round-trip form.
+         *
+         * The text is the one of boost::json::serialize: the scientific form with an upper case exponent and no
+         * exponent padding, e.g. 1.2345E2 or 1E-1, so it is always parsed back as floating point. Infinities are
+         * written as out of range numbers and NaN as null.
+         *
+         * @copydetails FormatNumber(int64_t, char*)
+         */
+        static std::size_t FormatNumber(double number, char* buffer);
+
+        /**
+         * @brief Append a signed integer number.
+         */
+        static void AppendNumber(std::string& output, int64_t number);
+
+        /**
+         * @brief Append an unsigned integer number.
+         */
+        static void AppendNumber(std::string& output, uint64_t number);
+
+        /**
+         * @brief Append a floating point number, see @ref FormatNumber(double, char*).
+         */
+        static void AppendNumber(std::string& output, double number);
+
+    private:
+        /**
+         * @brief Append the text of a value to the buffer, handing the full chunks over to the sink.
+         */
+        static void WriteChunked(const boost::json::value& value,
+                                 std::string& buffer,
+                                 Interfaces::IChunkSink& sink,
+                                 std::size_t chunkSize);
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_JSONVALUEWRITER_HPP
@@ -0,0 +1,183 @@
+/*************************************************************************************************
+ * @file LimitedJsonParser.hpp
+ *
+ * @brief Declarations for the concrete class @ref LimitedJsonParser.
+ *
+ * It parses json documents with the options and the resource limits of a @ref JsonParseConfiguration.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_LIMITEDJSONPARSER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_LIMITEDJSONPARSER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <string_view>
+#include <vector>
+
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class LimitedJsonParser
+     *
+     * @brief Incremental json parser enforcing the limits of a @ref JsonParseConfiguration.
+     *
+     * The limits are checked by the parse callbacks, so an oversized string, object or array is rejected while it
+     * is being read rather than once the whole document has been built. The same parser either builds the json
+     * value, like boost::json::parser, or only checks the document without allocating any value.
+     *
+     * An instance keeps its internal stacks from one document to the next, it is meant to be reused by a single
+     * thread.
+     */
+    class LimitedJsonParser
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new parser.
+         *
+         * @param[in] configuration The parse options and limits.
+         *
+         * @throw XInvalidArgument If the configuration is not supported, see @ref ToParseOptions.
+         */
+        explicit LimitedJsonParser(const JsonParseConfiguration& configuration);
+
+        /**
+         * @brief Destroy the parser.
+         */
+        ~LimitedJsonParser();
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Parse a whole document into a json value.
+         *
+         * @param[in] payload The document.
+         * @param[in] storage Storage of the json value.
+         * @param[out] errorCode Set if the document is not json or exceeds a limit.
+         *
+         * @return The json value, null if the error code is set.
+         */
+        boost::json::value Parse(std::string_view payload, boost::json::storage_ptr storage,
+                                 boost::json::error_code& errorCode);
+
+        /**
+         * @brief Check a whole document without building any json value.
+         *
+         * @param[in] payload The document.
+         * @param[out] errorCode Set if the document is not json or exceeds a limit.
+         */
+        void Check(std::string_view payload, boost::json::error_code& errorCode);
+
+        /**
+         * @brief Translate a configuration into the options of boost json.
+         *
+         * @param[in] configuration The parse options and limits.
+         *
+         * @return The parse options, the size limits are not part of them.
+         *
+         * @throw XInvalidArgument If the maximal depth is zero, or a number precision other than
+         * @ref NumberPrecision::Imprecise is requested from a Boost older than 1.83.
+         */
+        static boost::json::parse_options ToParseOptions(const JsonParseConfiguration& configuration);
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(LimitedJsonParser)
+
+        /**
+         * @struct Handler
+         *
+         * @brief Callbacks of boost::json::basic_parser, they count the sizes and build the value if asked to.
+         */
+        struct Handler
+        {
+            /**
+             * @struct Container
+             *
+             * @brief Element count of an open object or array.
+             */
+            struct Container
+            {
+                std::size_t Count;
+
+                boost::json::error TooLarge;
+            };
+
+            // The limits of boost json's own values, the configured ones are checked by the callbacks.
+            static constexpr std::size_t max_object_size = boost::json::object::max_size();
+            static constexpr std::size_t max_array_size = boost::json::array::max_size();
+            static constexpr std::size_t max_key_size = boost::json::string::max_size();
+            static constexpr std::size_t max_string_size = boost::json::string::max_size();
+
+            explicit Handler(const JsonParseConfiguration& configuration);
+
+            bool on_document_begin(boost::json::error_code& errorCode);
+            bool on_document_end(boost::json::error_code& errorCode);
+            bool on_object_begin(boost::json::error_code& errorCode);
+            bool on_object_end(std::size_t size, boost::json::error_code& errorCode);
+            bool on_array_begin(boost::json::error_code& errorCode);
+            bool on_array_end(std::size_t size, boost::json::error_code& errorCode);
+            bool on_key_part(boost::json::string_view part, std::size_t size, boost::json::error_code& errorCode);
+            bool on_key(boost::json::string_view part, std::size_t size, boost::json::error_code& errorCode);
+            bool on_string_part(boost::json::string_view part, std::size_t size, boost::json::error_code& errorCode);
+            bool on_string(boost::json::string_view part, std::size_t size, boost::json::error_code& errorCode);
+            bool on_number_part(boost::json::string_view part, boost::json::error_code& errorCode);
+            bool on_int64(std::int64_t value, boost::json::string_view text, boost::json::error_code& errorCode);
+            bool on_uint64(std::uint64_t value, boost::json::string_view text, boost::json::error_code& errorCode);
+            bool on_double(double value, boost::json::string_view text, boost::json::error_code& errorCode);
+            bool on_bool(bool value, boost::json::error_code& errorCode);
+            bool on_null(boost::json::error_code& errorCode);
+            bool on_comment_part(boost::json::string_view part, boost::json::error_code& errorCode);
+            bool on_comment(boost::json::string_view part, boost::json::error_code& errorCode);
+
+            /**
+             * @brief Count a value into the container holding it.
+             */
+            bool AddElement(boost::json::error_code& errorCode);
+
+            /**
+             * @brief Check the length of a string or of a key, read so far.
+             */
+            bool CheckLength(std::size_t size, boost::json::error tooLarge, boost::json::error_code& errorCode) const;
+
+            const std::size_t MaxStringLength;
+
+            const std::size_t MaxObjectSize;
+
+            /**
+             * @brief Whether the value is built, or the document only checked.
+             */
+            bool Building;
+
+            /**
+             * @brief The open containers, only kept when the object size is limited.
+             */
+            std::vector<Container> Containers;
+
+            boost::json::value_stack Stack;
+        };
+
+        /**
+         * @brief Run the parser over a whole document.
+         */
+        void Run(std::string_view payload, bool building, boost::json::error_code& errorCode);
+
+        // #region Private Members
+
+        const std::size_t _maxPayloadBytes;
+
+        boost::json::basic_parser<Handler> _parser;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_LIMITEDJSONPARSER_HPP
@@ -0,0 +1,206 @@
+/*************************************************************************************************
+ * @file MemoryFootprintInspector.hpp
+ *
+ * @brief Declarations for the concrete class @ref MemoryFootprintInspector.
+ *
+ * It reports the heap memory held by a data model tree, level by level.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_MEMORYFOOTPRINTINSPECTOR_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_MEMORYFOOTPRINTINSPECTOR_HPP
+
+#include "CommonConfig.hpp"
+
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/CompactValue.hpp"
+#include "Internal/SerializedSizeCalculator.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class MemoryFootprintInspector
+     *
+     * @brief Walk of a data model tree driven by the describe metadata, like @ref SerializedSizeCalculator.
+     *
+     * Every vector, map and string is attributed to the path it is found at, the elements of a vector being
+     * under "<path>[]", the values of a map under "<path>{}" and its keys under "<path>{key}". The heap bytes of
+     * a level are the ones its containers request for themselves: the capacity of a vector, one node per entry
+     * of a map, the buffer of a string longer than the small string buffer. The allocator's own bookkeeping is not
+     * included, so the figures are a lower bound of the resident memory.
+     */
+    class MemoryFootprintInspector
+    {
+    public:
+        /**
+         * @brief Bytes of a map node besides its entry, the color and the parent, left and right links of the
+         * red-black trees of the common standard libraries.
+         */
+        static constexpr std::size_t MapNodeOverhead = 4 * sizeof(void*);
+
+        /**
+         * @brief Inspect a described data model.
+         *
+         * @tparam TElement A described struct, sequence or string keyed map of serializable elements, the
+         * policies and the trees of a memory resource included.
+         *
+         * @param[in] root The data model.
+         *
+         * @return The heap bytes per level, their totals and the serialized size of the data model.
+         */
+        template <typename TElement>
+        static MemoryFootprintReport Inspect(const TElement& root)
+        {
+            MemoryFootprintReport report;
+            report.InlineBytes = sizeof(TElement);
+
+            Visit(root, std::string(), report);
+
+            for (const auto& [path, level] : report.Levels)
+            {
+                report.HeapBytes += level.HeapBytes;
+                report.SlackBytes += level.SlackBytes;
+            }
+
+            report.SerializedSize = SerializedSizeCalculator::Calculate(root);
+
+            return report;
+        }
+
+    private:
+        // #region Private Methods
+
+        template <typename TElement,
+                  typename TPublic = bd::describe_members<TElement, bd::mod_public | bd::mod_protected>>
+        static void Visit(const TElement& element, const std::string& path, MemoryFootprintReport& report)
+        {
+            boost::mp11::mp_for_each<TPublic>([&](auto D)
+                                              { Visit(element.*D.pointer, path.empty() ? std::string(D.name)
+                                                                                       : path + "." + D.name,
+                                                      report); });
+        }
+
+        template <typename TElement, typename TAllocator>
+        static void Visit(const std::vector<TElement, TAllocator>& elements, const std::string& path,
+                          MemoryFootprintReport& report)
+        {
+            MemoryFootprintLevel& level = report.Levels[path];
+            ++level.Instances;
+            level.Elements += elements.size();
+            level.HeapBytes += elements.capacity() * sizeof(TElement);
+            level.SlackBytes += (elements.capacity() - elements.size()) * sizeof(TElement);
+
+            const std::string elementPath = path + "[]";
+
+            for (const TElement& element : elements)
+            {
+                Visit(element, elementPath, report);
+            }
+        }
+
+        template <typename TKey, typename TElement, typename TCompare, typename TAllocator>
+        static void Visit(const std::map<TKey, TElement, TCompare, TAllocator>& elements, const std::string& path,
+                          MemoryFootprintReport& report)
+        {
+            using TEntry = typename std::map<TKey, TElement, TCompare, TAllocator>::value_type;
+
+            MemoryFootprintLevel& level = report.Levels[path];
+            ++level.Instances;
+            level.Elements += elements.size();
+            level.HeapBytes += elements.size() * (MapNodeOverhead + sizeof(TEntry));
+
+            const std::string keyPath = path + "{key}";
+            const std::string valuePath = path + "{}";
+
+            for (const auto& [key, element] : elements)
+            {
+                Visit(key, keyPath, report);
+                Visit(element, valuePath, report);
+            }
+        }
+
+        /**
+         * @brief The strings of a memory resource are counted as heap memory too, whichever resource holds them.
+         */
+        template <typename TAllocator>
+        static void Visit(const std::basic_string<char, std::char_traits<char>, TAllocator>& text,
+                          const std::string& path, MemoryFootprintReport& report)
+        {
+            MemoryFootprintLevel& level = report.Levels[path];
+            ++level.Instances;
+            level.Elements += text.size();
+
+            // A string within its small buffer holds no heap memory, a longer one holds its capacity and a
+            // terminator.
+            if (text.capacity() > std::string().capacity())
+            {
+                level.HeapBytes += text.capacity() + 1;
+                level.SlackBytes += text.capacity() - text.size();
+            }
+        }
+
+        /**
+         * @brief Only the strings of the values hold heap memory, the other alternatives are counted with the
+         * node or the vector holding the value.
+         */
+        static void Visit(const SerializationValue& value, const std::string& path, MemoryFootprintReport& report)
+        {
+            VisitText<std::string>(value.data, path, report);
+        }
+
+        static void Visit(const DeserializationValue& value, const std::string& path,
+                          MemoryFootprintReport& report)
+        {
+            VisitText<std::string>(value.data, path, report);
+        }
+
+        static void Visit(const PmrSerializationValue& value, const std::string& path,
+                          MemoryFootprintReport& report)
+        {
+            VisitText<std::pmr::string>(value.data, path, report);
+        }
+
+        static void Visit(const PmrDeserializationValue& value, const std::string& path,
+                          MemoryFootprintReport& report)
+        {
+            VisitText<std::pmr::string>(value.data, path, report);
+        }
+
+        template <typename TString, typename TVariant>
+        static void VisitText(const TVariant& variant, const std::string& path, MemoryFootprintReport& report)
+        {
+            const TString* text = bv2::get_if<TString>(&variant);
+
+            if (nullptr != text)
+            {
+                Visit(*text, path, report);
+            }
+        }
+
+        static void Visit(const CompactValue& value, const std::string& path, MemoryFootprintReport& report)
+        {
+            if (CompactValue::Kind::String == value.GetKind())
+            {
+                MemoryFootprintLevel& level = report.Levels[path];
+                ++level.Instances;
+                level.Elements += value.GetString().size();
+                level.HeapBytes += value.GetOutOfLineBytes();
+            }
+        }
+
+        template <typename TScalar,
+                  typename TEnableIf = std::enable_if_t<std::is_arithmetic_v<TScalar> || std::is_enum_v<TScalar>>>
+        static void Visit(TScalar, const std::string&, MemoryFootprintReport&)
+        {
+        }
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_MEMORYFOOTPRINTINSPECTOR_HPP
@@ -0,0 +1,179 @@
+/*************************************************************************************************
+ * @file MetricsSummarizer.hpp
+ *
+ * @brief Declarations for the concrete class @ref MetricsSummarizer.
+ *
+ * It computes the summary statistics of the metrics of the test results, per key.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_METRICSSUMMARIZER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_METRICSSUMMARIZER_HPP
+
+#include "CommonConfig.hpp"
+
+#include "Internal/CpuFeatures.hpp"
+#include "Internal/QuantileSketch.hpp"
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class MetricsSummarizer
+     *
+     * @brief Per key summary statistics of the @ref TestDataStepResults::Metrics of the test results.
+     *
+     * The metrics of a step are walked once, the numeric values of every key being gathered into a contiguous
+     * series. The minimum, maximum and sum of a series are reduced 2 (SSE2) or 4 (AVX2) values at a time, the
+     * instruction set being selected at runtime, and the series is fed into a @ref QuantileSketch. The summaries
+     * of a monitor merge the ones of its steps, so its metrics are not walked a second time.
+     *
+     * The string, enum and boolean values are not numeric and are skipped, as are the NaN values.
+     *
+     * The summarizer reuses its series from one call to the next, an instance must not be shared by threads.
+     */
+    class MetricsSummarizer
+    {
+    public:
+        /**
+         * @struct SeriesReduction
+         *
+         * @brief Minimum, maximum and sum of a series of values.
+         */
+        struct SeriesReduction
+        {
+            double Min;
+            double Max;
+            double Sum;
+        };
+
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new summarizer.
+         *
+         * @param[in] options Accuracy of the quantiles and embedding of the summaries.
+         *
+         * @throw XInvalidArgument If the capacity of the sketches is lower than 2.
+         */
+        explicit MetricsSummarizer(const MetricSummaryOptions& options = MetricSummaryOptions{});
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Summarize the metrics of a step.
+         *
+         * @param[in] step The step results.
+         *
+         * @return The summaries by metric key, the keys without any numeric value are left out.
+         */
+        std::map<std::string, MetricSummary> Summarize(const TestDataStepResults& step);
+
+        /**
+         * @brief Summarize the metrics of all the steps of a monitor.
+         *
+         * @param[in] monitor The monitor results.
+         *
+         * @return The summaries by metric key, the keys without any numeric value are left out.
+         */
+        std::map<std::string, MetricSummary> Summarize(const TestDataMonitorResults& monitor);
+
+        /**
+         * @brief Embed the summaries of every step and monitor into their OtherData.
+         *
+         * A statistic is stored under "<prefix><key>.<statistic>", e.g. "Summary.Latency.P95", where the
+         * statistic is one of Count, Min, Max, Mean, P50, P95 and P99. The count is an unsigned integer, the
+         * other statistics are narrowed to float like any floating point value of the results. The Metrics of
+         * the steps are cleared afterwards unless @ref MetricSummaryOptions::KeepRawSeries is set.
+         *
+         * @param[in,out] results The test results, their metrics are walked once.
+         */
+        void Embed(TestDataTestResults& results);
+
+        /**
+         * @brief Reduce a series of values with the best instruction set of the executing CPU.
+         *
+         * @param[in] values Start of the series, no value may be NaN.
+         * @param[in] count Number of values.
+         *
+         * @return The reduction, the minimum is +infinity and the maximum -infinity for an empty series.
+         */
+        static SeriesReduction Reduce(const double* values, std::size_t count);
+
+        /**
+         * @copydoc Reduce(const double*, std::size_t)
+         *
+         * @param[in] level The instruction set to use, it must be supported by the CPU.
+         */
+        static SeriesReduction Reduce(const double* values, std::size_t count, SimdLevel level);
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(MetricsSummarizer)
+
+        /**
+         * @struct Accumulator
+         *
+         * @brief Mergeable state of the summary of one key.
+         */
+        struct Accumulator
+        {
+            explicit Accumulator(std::size_t sketchCapacity);
+
+            /**
+             * @brief Add a series of values.
+             */
+            void Add(const std::vector<double>& values);
+
+            /**
+             * @brief Add the values of another accumulator.
+             */
+            void Merge(const Accumulator& other);
+
+            MetricSummary ToSummary() const;
+
+            std::uint64_t Count;
+            double Min;
+            double Max;
+            double Sum;
+            QuantileSketch Sketch;
+        };
+
+        using Accumulators = std::map<std::string, Accumulator>;
+
+        // #region Private Methods
+
+        /**
+         * @brief Walk the metrics of a step and accumulate their series, by key.
+         */
+        void AccumulateStep(const TestDataStepResults& step, Accumulators& accumulators);
+
+        /**
+         * @brief Add the accumulators of a step into the ones of its monitor.
+         */
+        static void MergeInto(Accumulators& target, const Accumulators& source);
+
+        static std::map<std::string, MetricSummary> ToSummaries(const Accumulators& accumulators);
+
+        void EmbedInto(const Accumulators& accumulators, std::map<std::string, SerializationValue>& otherData) const;
+
+        // #endregion
+
+        // #region Private Members
+
+        const MetricSummaryOptions _options;
+
+        /**
+         * @brief Numeric values of every key of the current step, the series keep their capacity.
+         */
+        std::map<std::string, std::vector<double>> _series;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_METRICSSUMMARIZER_HPP
@@ -9,7 +9,11 @@
 
 #include "CommonConfig.hpp"
 
+#include <mutex>
+
 #include "Interfaces/Factories/IObjectFactories.hpp"
+#include "Internal/SerializableDataModels.hpp"
+#include "Internal/ThreadPool.hpp"
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
@@ -24,6 +28,7 @@ namespace Internal
                           public FactoryInterfaces::IJsonDataSerializerImplFactory,
                           public FactoryInterfaces::IJsonDataValidatorFactory,
                           public FactoryInterfaces::IJsonDataValidatorImplFactory,
+                          public FactoryInterfaces::IJsonBulkDeserializerFactory,
                           public std::enable_shared_from_this<ObjectFactory>
     {
         // #region Type Aliases
@@ -33,6 +38,7 @@ namespace Internal
         using JsonDataSerializerImplFactoryInterfacePtr = FactoryInterfaces::IJsonDataSerializerImplFactory::InterfaceSharedPointer;
         using JsonDataValidatorFactoryInterfacePtr = FactoryInterfaces::IJsonDataValidatorFactory::InterfaceSharedPointer;
         using JsonDataValidatorImplFactoryInterfacePtr = FactoryInterfaces::IJsonDataValidatorImplFactory::InterfaceSharedPointer;
+        using JsonBulkDeserializerFactoryInterfacePtr = FactoryInterfaces::IJsonBulkDeserializerFactory::InterfaceSharedPointer;
 
         // #endregion
 
@@ -41,8 +47,10 @@ namespace Internal
 
         /**
          * @brief Construct a new Factory object
+         *
+         * @param[in] parseConfiguration Parse options and limits of the serializers and validators created.
          */
-        ObjectFactory();
+        explicit ObjectFactory(const JsonParseConfiguration& parseConfiguration = {});
 
         /**
          * @brief Destroy the Object Factory object
@@ -63,6 +71,8 @@ namespace Internal
 
         virtual void Create(JsonDataValidatorImplFactoryInterfacePtr &objectPtr) override;
 
+        virtual void Create(JsonBulkDeserializerFactoryInterfacePtr &objectPtr) override;
+
         // #endregion
 
     private:
@@ -77,6 +87,29 @@ namespace Internal
          */
         std::shared_ptr<ObjectFactory> Self();
 
+        /**
+         * @brief Get the worker pool shared by all the objects of the factory, it is created on first use.
+         *
+         * Thread safe, the objects may be created by any number of threads. The workers of the pool are only
+         * started once a task is posted to it.
+         *
+         * @return The shared thread pool.
+         */
+        std::shared_ptr<ThreadPool> GetThreadPool();
+
+        /**
+         * @brief Worker pool shared by all the objects which need one, it runs the asynchronous serializations
+         * and the bulk deserializations.
+         */
+        std::shared_ptr<ThreadPool> _threadPool;
+
+        std::once_flag _threadPoolOnce;
+
+        /**
+         * @brief Parse options and limits handed over to the serializer and validator implementations.
+         */
+        const JsonParseConfiguration _parseConfiguration;
+
         // #endregion
     };
 } // namespace Internal
@@ -0,0 +1,308 @@
+/*************************************************************************************************
+ * @file PerThread.hpp
+ *
+ * @brief Declarations for the template class @ref PerThread.
+ *
+ * It gives every thread its own lazily created instance of a scratch context, per owning object.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_PERTHREAD_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_PERTHREAD_HPP
+
+#include "CommonConfig.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class PerThread
+     *
+     * @brief Lazily created per-thread instances of a context, owned by the object holding the @ref PerThread.
+     *
+     * The hot path is a lookup in a thread local table and takes no lock, the lock is only taken the first time a
+     * thread asks for its context and when the thread exits. The context of a thread is released when the thread
+     * exits or when the owner is destroyed, whichever comes first. Owners that keep totals across the threads
+     * give a merge function, the context of an exiting thread is merged into a retired context before it is
+     * released and the retired context is visited like the others.
+     *
+     * Every owner gets an id which is never reused, so that the thread local tables never resolve a stale entry
+     * left behind by a destroyed owner. The tables only hold weak references to the owners, the stale entries
+     * are swept when a table has doubled since its last sweep.
+     *
+     * @tparam TContext Default constructible context type.
+     */
+    template <typename TContext>
+    class PerThread
+    {
+    public:
+        /**
+         * @brief Merges the context of an exiting thread, the first argument, into the retired context.
+         */
+        using MergeFunction = std::function<void(TContext&, TContext&)>;
+
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new set of contexts.
+         *
+         * @param[in] mergeExited Merge function of the contexts of the exiting threads, they are only released
+         *                        when it is empty. It runs under the lock, from the exiting threads, and must
+         *                        only rely on members of the owner declared before the @ref PerThread.
+         */
+        explicit PerThread(MergeFunction mergeExited = nullptr)
+            : _id(NextId()),
+              _state(std::make_shared<State>(std::move(mergeExited)))
+        {
+        }
+
+        ~PerThread()
+        {
+            // A thread exiting concurrently may still hold the state, it must find nothing left to release.
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+
+            _state->Contexts.clear();
+            _state->Retired.reset();
+            _state->MergeExited = nullptr;
+        }
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Get the context of the calling thread, it is created on first use.
+         *
+         * @return The context, only the calling thread ever gets this instance.
+         */
+        TContext& Get()
+        {
+            ThreadTable& threadTable = GetThreadTable();
+
+            auto found = threadTable.Entries.find(_id);
+
+            if (threadTable.Entries.end() != found)
+            {
+                return *found->second.Context;
+            }
+
+            std::unique_ptr<TContext> context = std::make_unique<TContext>();
+            TContext* threadContext = context.get();
+
+            {
+                std::lock_guard<std::mutex> lock(_state->Mutex);
+                _state->Contexts.push_back(std::move(context));
+            }
+
+            threadTable.Add(_id, ThreadEntry{_state, threadContext});
+
+            return *threadContext;
+        }
+
+        /**
+         * @brief Visit the contexts of all the threads, the contexts may be in use while they are visited.
+         *
+         * The retired context, if any, is visited last.
+         *
+         * @param[in] visitor Callable taking a reference to a context.
+         */
+        template <typename TVisitor>
+        void ForEach(TVisitor&& visitor)
+        {
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+
+            for (const std::unique_ptr<TContext>& context : _state->Contexts)
+            {
+                visitor(*context);
+            }
+
+            if (_state->Retired)
+            {
+                visitor(*_state->Retired);
+            }
+        }
+
+        /**
+         * @brief Visit the contexts of all the threads, the contexts may be in use while they are visited.
+         *
+         * The retired context, if any, is visited last.
+         *
+         * @param[in] visitor Callable taking a const reference to a context.
+         */
+        template <typename TVisitor>
+        void ForEach(TVisitor&& visitor) const
+        {
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+
+            for (const std::unique_ptr<TContext>& context : _state->Contexts)
+            {
+                const TContext& threadContext = *context;
+                visitor(threadContext);
+            }
+
+            if (_state->Retired)
+            {
+                const TContext& retiredContext = *_state->Retired;
+                visitor(retiredContext);
+            }
+        }
+
+        /**
+         * @brief Get the number of contexts alive, one per running thread that used the owner.
+         */
+        std::size_t GetContextCount() const
+        {
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+            return _state->Contexts.size();
+        }
+
+        /**
+         * @brief Get the number of entries in the table of the calling thread, including the stale ones.
+         */
+        static std::size_t GetThreadEntryCount()
+        {
+            return GetThreadTable().Entries.size();
+        }
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(PerThread)
+
+        /**
+         * @brief Size a table is first swept at.
+         */
+        static constexpr std::size_t MinSweepSize = 16;
+
+        /**
+         * @struct State
+         *
+         * @brief The contexts of an owner, shared with the tables of the threads that use it.
+         */
+        struct State
+        {
+            explicit State(MergeFunction mergeExited)
+                : MergeExited(std::move(mergeExited))
+            {
+            }
+
+            /**
+             * @brief Release the context of an exiting thread, unless the owner already did.
+             */
+            void Release(TContext* context)
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+
+                auto found = std::find_if(Contexts.begin(), Contexts.end(),
+                                          [context](const std::unique_ptr<TContext>& candidate)
+                                          { return candidate.get() == context; });
+
+                if (Contexts.end() == found)
+                {
+                    return;
+                }
+
+                if (MergeExited)
+                {
+                    if (!Retired)
+                    {
+                        Retired = std::make_unique<TContext>();
+                    }
+
+                    MergeExited(**found, *Retired);
+                }
+
+                Contexts.erase(found);
+            }
+
+            std::mutex Mutex;
+
+            std::vector<std::unique_ptr<TContext>> Contexts;
+
+            /**
+             * @brief Created by the first merge.
+             */
+            std::unique_ptr<TContext> Retired;
+
+            MergeFunction MergeExited;
+        };
+
+        struct ThreadEntry
+        {
+            std::weak_ptr<State> Owner;
+
+            TContext* Context;
+        };
+
+        /**
+         * @struct ThreadTable
+         *
+         * @brief The contexts of the calling thread, by owner id, released when the thread exits.
+         */
+        struct ThreadTable
+        {
+            ~ThreadTable()
+            {
+                for (auto& [id, entry] : Entries)
+                {
+                    if (std::shared_ptr<State> owner = entry.Owner.lock())
+                    {
+                        owner->Release(entry.Context);
+                    }
+                }
+            }
+
+            void Add(uint64_t id, ThreadEntry entry)
+            {
+                if (Entries.size() >= SweepSize)
+                {
+                    for (auto iterator = Entries.begin(); iterator != Entries.end();)
+                    {
+                        iterator = iterator->second.Owner.expired() ? Entries.erase(iterator) : std::next(iterator);
+                    }
+
+                    SweepSize = std::max(MinSweepSize, 2 * Entries.size());
+                }
+
+                Entries.emplace(id, std::move(entry));
+            }
+
+            std::unordered_map<uint64_t, ThreadEntry> Entries;
+
+            std::size_t SweepSize = MinSweepSize;
+        };
+
+        // #region Private Methods
+
+        static uint64_t NextId()
+        {
+            static std::atomic<uint64_t> nextId{1};
+            return nextId.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static ThreadTable& GetThreadTable()
+        {
+            static thread_local ThreadTable threadTable;
+            return threadTable;
+        }
+
+        // #endregion
+
+        // #region Private Members
+
+        const uint64_t _id;
+
+        const std::shared_ptr<State> _state;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_PERTHREAD_HPP
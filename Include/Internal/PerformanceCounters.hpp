@@ -0,0 +1,198 @@
+/*************************************************************************************************
+ * @file PerformanceCounters.hpp
+ *
+ * @brief Declarations for the concrete class @ref PerformanceCounters.
+ *
+ * It counts the calls, bytes, errors and latencies of the operations of an object.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_PERFORMANCECOUNTERS_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_PERFORMANCECOUNTERS_HPP
+
+#include "CommonConfig.hpp"
+
+#include <atomic>
+#include <chrono>
+
+#include "Internal/PerThread.hpp"
+#include "Internal/SerializableDataModels.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @brief Categories the failed calls are counted by.
+     */
+    enum class ErrorCategory : std::size_t
+    {
+        Serialization,
+        InvalidFormat,
+        InvalidArgument,
+        OutOfMemory,
+        Other,
+        Count
+    };
+
+    /**
+     * @class PerformanceCounters
+     *
+     * @brief Per-thread counters of a fixed set of operations, aggregated when they are read.
+     *
+     * Every thread writes its own cache line aligned counters without any atomic read-modify-write, so that the
+     * counters can be left on permanently. The counters of the exited threads are merged into a retired set.
+     * The latencies are kept in an HDR style histogram: power of two buckets, each split into
+     * @ref SubBucketCount linear sub-buckets, for a relative error below 25%.
+     */
+    class PerformanceCounters
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Most operations a single instance counts.
+         */
+        static constexpr std::size_t MaxOperationCount = 4;
+
+        static constexpr std::size_t SubBucketBits = 2;
+
+        static constexpr std::size_t SubBucketCount = std::size_t{1} << SubBucketBits;
+
+        /**
+         * @brief Latencies are tracked up to 2^48 ns (about 78 hours), longer ones land in the last bucket.
+         */
+        static constexpr std::size_t MaxTrackedBits = 48;
+
+        static constexpr std::size_t BucketCount = SubBucketCount + (MaxTrackedBits - SubBucketBits) * SubBucketCount;
+
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new set of counters.
+         *
+         * @param[in] operationNames Names of the counted operations, the operations are referred to by index.
+         *
+         * @throw XInvalidArgument If there is no operation or more than @ref MaxOperationCount.
+         */
+        explicit PerformanceCounters(std::vector<std::string> operationNames);
+
+        ~PerformanceCounters();
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Count a successful call.
+         *
+         * @param[in] operation Index of the operation.
+         * @param[in] start When the call started.
+         * @param[in] bytesIn Size of the input of the call.
+         * @param[in] bytesOut Size of the output of the call.
+         */
+        void RecordSuccess(std::size_t operation, Clock::time_point start, uint64_t bytesIn, uint64_t bytesOut);
+
+        /**
+         * @brief Count a failed call.
+         *
+         * @param[in] operation Index of the operation.
+         * @param[in] start When the call started.
+         * @param[in] bytesIn Size of the input of the call.
+         * @param[in] ex The failure, it selects the error category.
+         */
+        void RecordFailure(std::size_t operation, Clock::time_point start, uint64_t bytesIn, const std::exception& ex);
+
+        /**
+         * @brief Aggregate the counters of all the threads.
+         */
+        PerformanceSnapshot GetSnapshot() const;
+
+        /**
+         * @brief Dump a snapshot as compact JSON.
+         */
+        static std::string ToJson(const PerformanceSnapshot& snapshot);
+
+        /**
+         * @brief Get the error category of a failure.
+         */
+        static ErrorCategory Categorize(const std::exception& ex);
+
+        /**
+         * @brief Get the name of an error category, as it appears in the snapshot.
+         */
+        static const char* GetCategoryName(ErrorCategory category);
+
+        /**
+         * @brief Get the index of the histogram bucket counting a latency.
+         */
+        static std::size_t GetBucketIndex(uint64_t nanoseconds);
+
+        /**
+         * @brief Get the exclusive upper bound of the latencies counted by a histogram bucket.
+         */
+        static uint64_t GetBucketUpperBound(std::size_t bucketIndex);
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(PerformanceCounters)
+
+        /**
+         * @brief Size of a cache line, the counters of different threads never share one.
+         */
+        static constexpr std::size_t CacheLineSize = 64;
+
+        /**
+         * @struct OperationCounters
+         *
+         * @brief Counters of one operation on one thread, only written by that thread.
+         */
+        struct alignas(CacheLineSize) OperationCounters
+        {
+            std::atomic<uint64_t> Calls{0};
+            std::atomic<uint64_t> Errors{0};
+            std::atomic<uint64_t> BytesIn{0};
+            std::atomic<uint64_t> BytesOut{0};
+            std::atomic<uint64_t> TotalNanoseconds{0};
+            std::atomic<uint64_t> MaxNanoseconds{0};
+
+            std::array<std::atomic<uint64_t>, static_cast<std::size_t>(ErrorCategory::Count)> ErrorsByCategory{};
+
+            std::array<std::atomic<uint64_t>, BucketCount> LatencyHistogram{};
+        };
+
+        /**
+         * @struct ThreadCounters
+         *
+         * @brief Counters of all the operations on one thread.
+         */
+        struct ThreadCounters
+        {
+            std::array<OperationCounters, MaxOperationCount> Operations;
+        };
+
+        // #region Private Methods
+
+        /**
+         * @brief Count a call, successful or not, and get the counters of its operation.
+         */
+        OperationCounters& Record(std::size_t operation, Clock::time_point start, uint64_t bytesIn);
+
+        /**
+         * @brief Add the counters of an exiting thread to the retired ones, so the snapshots keep them.
+         */
+        static void MergeExited(ThreadCounters& exited, ThreadCounters& retired);
+
+        // #endregion
+
+        // #region Private Members
+
+        const std::vector<std::string> _operationNames;
+
+        PerThread<ThreadCounters> _threadCounters;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_PERFORMANCECOUNTERS_HPP
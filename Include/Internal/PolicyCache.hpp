@@ -0,0 +1,145 @@
+/*************************************************************************************************
+ * @file PolicyCache.hpp
+ *
+ * @brief Declarations for the concrete class @ref PolicyCache.
+ *
+ * It shares the policies deserialized from identical payloads.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYCACHE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYCACHE_HPP
+
+#include "CommonConfig.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "Interfaces/IJsonDataSerializer.hpp"
+#include "Interfaces/IJsonDataValidator.hpp"
+#include "Interfaces/IPolicyCache.hpp"
+#include "Internal/ContentHash.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class PolicyCache
+     *
+     * @brief Content addressed LRU cache in front of @ref IJsonDataSerializer::Deserialize.
+     *
+     * The entries are keyed by the 128-bit @ref ContentHash digest of the payload bytes and hold immutable
+     * policies, so a hit costs one hash of the payload and no copy. An entry also records the length of its
+     * payload and is only returned for a payload of that length, a colliding payload is deserialized and not
+     * cached. The memory held by the entries is estimated
+     * and kept within a budget by evicting the least recently used ones. Payloads rejected by the validator are
+     * cached as well, so that a bad payload sent over and over is only parsed once.
+     *
+     * All the methods are thread safe. The lock is never held while a payload is validated or deserialized, two
+     * threads missing the same payload at once both deserialize it and the first one fills the entry.
+     */
+    class PolicyCache : public Interfaces::IPolicyCache
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new empty cache.
+         *
+         * @param[in] serializer The serializer deserializing the payloads missing in the cache.
+         * @param[in] validator The validator of the payloads missing in the cache, null to skip the validation.
+         * @param[in] options The memory budget.
+         *
+         * @throw XArgumentNull If the serializer is null.
+         */
+        PolicyCache(std::shared_ptr<Interfaces::IJsonDataSerializer> serializer,
+                    std::shared_ptr<Interfaces::IJsonDataValidator> validator,
+                    const PolicyCacheOptions& options = PolicyCacheOptions{});
+
+        virtual ~PolicyCache() override;
+
+        // #endregion
+
+        // #region IPolicyCache Implementation
+
+        virtual std::shared_ptr<const TestDataTestPolicy> Deserialize(const std::string& payload) override;
+
+        virtual PolicyCacheStatistics GetStatistics() const override;
+
+        virtual void Clear() override;
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Estimate the memory held by a policy, heap allocations included.
+         *
+         * It is the footprint reported by @ref MemoryFootprintInspector, the policy itself and its heap bytes.
+         *
+         * @param[in] policy The policy.
+         *
+         * @return Estimated size in bytes.
+         */
+        static std::size_t EstimateSize(const TestDataTestPolicy& policy);
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(PolicyCache)
+
+        /**
+         * @struct Entry
+         *
+         * @brief Outcome of the deserialization of a payload, either a policy or a validation error.
+         */
+        struct Entry
+        {
+            ContentDigest Digest;
+
+            /**
+             * @brief Length of the payload, a payload of another length with the same digest is a collision.
+             */
+            std::size_t PayloadLength = 0;
+
+            std::shared_ptr<const TestDataTestPolicy> Policy;
+
+            std::string ValidationError;
+
+            std::size_t Bytes = 0;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        // #region Private Methods
+
+        /**
+         * @brief Add an entry as the most recently used one and evict the entries exceeding the budget.
+         */
+        void Insert(Entry&& entry);
+
+        // #endregion
+
+        // #region Private Members
+
+        const std::shared_ptr<Interfaces::IJsonDataSerializer> _serializer;
+
+        const std::shared_ptr<Interfaces::IJsonDataValidator> _validator;
+
+        mutable std::mutex _mutex;
+
+        /**
+         * @brief Entries from the most to the least recently used.
+         */
+        EntryList _entries;
+
+        std::unordered_map<ContentDigest, EntryList::iterator, ContentHash::DigestHasher> _index;
+
+        PolicyCacheStatistics _statistics;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYCACHE_HPP
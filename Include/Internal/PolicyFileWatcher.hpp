@@ -0,0 +1,134 @@
+/*************************************************************************************************
+ * @file PolicyFileWatcher.hpp
+ *
+ * @brief Declarations for the concrete class @ref PolicyFileWatcher.
+ *
+ * It reloads a policy file into a @ref PolicySnapshotHolder whenever the file changes, on Linux.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYFILEWATCHER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYFILEWATCHER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Interfaces/IPolicyFileWatcher.hpp"
+#include "Interfaces/IPolicySnapshotHolder.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class PolicyFileWatcher
+     *
+     * @brief Watches a policy file through inotify and publishes it once the writes to it settle.
+     *
+     * The directory of the file is watched rather than the file itself, so that the editors and deployment
+     * tools replacing the file by a rename are noticed too. Each change restarts the debounce period, the file
+     * is reloaded on the watcher thread once it elapsed. The publication goes through
+     * @ref IPolicySnapshotHolder::Publish, so only a fully valid policy replaces the current one; a file that
+     * cannot be read or is rejected leaves the previous policy in place and is reported to the error callback.
+     */
+    class PolicyFileWatcher : public Interfaces::IPolicyFileWatcher
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Callback receiving the failures of the reloads, it is called on the watcher thread and must not
+         * throw.
+         */
+        using ErrorCallback = std::function<void(const std::exception& error)>;
+
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new watcher and start its thread.
+         *
+         * @param[in] path Path of the policy file, its directory must exist.
+         * @param[in] holder The holder the policies are published to.
+         * @param[in] onError Callback receiving the failures of the reloads, may be empty.
+         * @param[in] options Debounce period and initial load.
+         *
+         * @throw XArgumentNull If the holder is null.
+         * @throw XInvalidArgument If the directory of the file cannot be watched.
+         */
+        PolicyFileWatcher(const std::string& path,
+                          std::shared_ptr<Interfaces::IPolicySnapshotHolder> holder,
+                          ErrorCallback onError,
+                          const PolicyFileWatcherOptions& options = PolicyFileWatcherOptions{});
+
+        /**
+         * @brief Stop the thread, a pending reload is abandoned.
+         */
+        virtual ~PolicyFileWatcher() override;
+
+        // #endregion
+
+        // #region IPolicyFileWatcher Implementation
+
+        virtual PolicyFileWatcherStatistics GetStatistics() const override;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(PolicyFileWatcher)
+
+        // #region Private Methods
+
+        /**
+         * @brief Thread loop, it runs until the watcher is destroyed.
+         */
+        void WatchLoop();
+
+        /**
+         * @brief Read all the pending notifications.
+         *
+         * @return Whether any of them is about the policy file.
+         */
+        bool DrainEvents();
+
+        /**
+         * @brief Read the file and publish it.
+         *
+         * @param[in] changedAt When the first change of the burst was noticed.
+         */
+        void Reload(Clock::time_point changedAt);
+
+        // #endregion
+
+        // #region Private Members
+
+        const std::string _path;
+
+        const std::string _fileName;
+
+        const std::shared_ptr<Interfaces::IPolicySnapshotHolder> _holder;
+
+        const ErrorCallback _onError;
+
+        const PolicyFileWatcherOptions _options;
+
+        int _inotifyFd;
+
+        /**
+         * @brief Event counter signaled to stop the thread.
+         */
+        int _stopFd;
+
+        mutable std::mutex _statisticsMutex;
+
+        PolicyFileWatcherStatistics _statistics;
+
+        std::thread _thread;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYFILEWATCHER_HPP
@@ -0,0 +1,91 @@
+/*************************************************************************************************
+ * @file PolicySnapshotHolder.hpp
+ *
+ * @brief Declarations for the concrete class @ref PolicySnapshotHolder.
+ *
+ * It publishes immutable policy snapshots to any number of reader threads.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYSNAPSHOTHOLDER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYSNAPSHOTHOLDER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <atomic>
+#include <memory>
+
+#include "Interfaces/IJsonDataSerializer.hpp"
+#include "Interfaces/IJsonDataValidator.hpp"
+#include "Interfaces/IPolicySnapshotHolder.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class PolicySnapshotHolder
+     *
+     * @brief Read-copy-update holder of the current policy.
+     *
+     * The current snapshot is read with std::atomic_load and replaced with std::atomic_store, so a read never
+     * waits for a publication and returns its own reference to the snapshot. A replaced snapshot is destroyed
+     * once the last reader holding it releases it.
+     *
+     * The policies are built and validated by the publishing thread before the swap, so the readers never wait
+     * for a deserialization.
+     */
+    class PolicySnapshotHolder : public Interfaces::IPolicySnapshotHolder
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new holder.
+         *
+         * @param[in] serializer The serializer of the published payloads.
+         * @param[in] validator The validator of the published payloads, null to skip the validation.
+         * @param[in] initialPolicy The policy until the first publication, an empty policy if null.
+         *
+         * @throw XArgumentNull If the serializer is null.
+         */
+        PolicySnapshotHolder(std::shared_ptr<Interfaces::IJsonDataSerializer> serializer,
+                             std::shared_ptr<Interfaces::IJsonDataValidator> validator,
+                             std::shared_ptr<const TestDataTestPolicy> initialPolicy = nullptr);
+
+        virtual ~PolicySnapshotHolder() override;
+
+        // #endregion
+
+        // #region IPolicySnapshotHolder Implementation
+
+        virtual std::shared_ptr<const TestDataTestPolicy> Get() const override;
+
+        virtual uint64_t GetVersion() const override;
+
+        virtual uint64_t Publish(std::shared_ptr<const TestDataTestPolicy> policy) override;
+
+        virtual uint64_t Publish(const std::string& payload) override;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(PolicySnapshotHolder)
+
+        // #region Private Members
+
+        const std::shared_ptr<Interfaces::IJsonDataSerializer> _serializer;
+
+        const std::shared_ptr<Interfaces::IJsonDataValidator> _validator;
+
+        /**
+         * @brief The current snapshot, only accessed through std::atomic_load and std::atomic_store.
+         */
+        std::shared_ptr<const TestDataTestPolicy> _current;
+
+        std::atomic<uint64_t> _version;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_POLICYSNAPSHOTHOLDER_HPP
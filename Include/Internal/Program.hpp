@@ -40,10 +40,30 @@ namespace Internal
 
         virtual int32_t Run() override;
 
+        /**
+         * Supported commands:
+         * + footprint <payload file>, report the memory a saved @ref TestDataTestResults payload occupies once
+         *   loaded, level by level, and its serialized size.
+         *
+         * Any other command prints the usage and returns 1, a command that fails returns -1.
+         */
+        virtual int32_t Run(const std::vector<std::string>& arguments) override;
+
         // #endregion
 
     private:
         DECLARE_NON_COPYABLE_CLASS(Program)
+
+        // #region Private Methods
+
+        /**
+         * @brief Load a saved test results payload and print its memory footprint.
+         *
+         * @throw XInvalidArgument If the file cannot be read.
+         */
+        void RunFootprint(const std::string& path);
+
+        // #endregion
     };
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,128 @@
+/*************************************************************************************************
+ * @file QuantileSketch.hpp
+ *
+ * @brief Declarations for the concrete class @ref QuantileSketch.
+ *
+ * It estimates the quantiles of a stream of values in bounded memory.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_QUANTILESKETCH_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_QUANTILESKETCH_HPP
+
+#include "CommonConfig.hpp"
+
+#include <cstdint>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class QuantileSketch
+     *
+     * @brief Mergeable quantile sketch made of a hierarchy of compactors.
+     *
+     * The values are kept in levels, a value of level h standing for 2^h values of the stream. Once a level holds
+     * @ref GetCapacity values it is sorted and every other value is promoted to the next level, the offset of the
+     * promoted values alternating from one compaction to the next so that the rank errors tend to cancel out.
+     * The memory is bounded by the capacity times the logarithm of the stream length, and the sketch is exact
+     * until the first compaction.
+     *
+     * Sketches of the same capacity can be merged, e.g. the sketches of the steps into the one of a monitor, and
+     * the result is as accurate as a sketch fed with both streams.
+     */
+    class QuantileSketch
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new empty sketch.
+         *
+         * @param[in] capacity Values retained by each level before it is compacted.
+         *
+         * @throw XInvalidArgument If the capacity is lower than 2.
+         */
+        explicit QuantileSketch(std::size_t capacity = 256);
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Add a value of the stream.
+         *
+         * @param[in] value The value, it must not be NaN.
+         */
+        void Add(double value);
+
+        /**
+         * @brief Add the values of another sketch.
+         *
+         * @param[in] other A sketch of the same capacity.
+         *
+         * @throw XInvalidArgument If the capacities differ.
+         */
+        void Merge(const QuantileSketch& other);
+
+        /**
+         * @brief Estimate a quantile of the stream.
+         *
+         * @param[in] rank The normalized rank within 0 and 1, e.g. 0.95 for the 95th percentile.
+         *
+         * @return The smallest retained value whose cumulated weight reaches the rank, NaN if the sketch is empty.
+         *
+         * @throw XInvalidArgument If the rank is out of range.
+         */
+        double GetQuantile(double rank) const;
+
+        /**
+         * @brief Get the number of values added to the sketch, merged ones included.
+         */
+        std::uint64_t GetCount() const;
+
+        /**
+         * @brief Get the number of values held by the sketch.
+         */
+        std::size_t GetRetainedCount() const;
+
+        /**
+         * @brief Get the number of values a level holds before it is compacted.
+         */
+        std::size_t GetCapacity() const;
+
+        /**
+         * @brief Remove all the values, the levels keep their memory.
+         */
+        void Clear();
+
+        // #endregion
+
+    private:
+        // #region Private Methods
+
+        /**
+         * @brief Compact every level holding at least @ref _capacity values, from the lowest one up.
+         */
+        void CompactFull(std::size_t fromLevel);
+
+        // #endregion
+
+        // #region Private Members
+
+        std::size_t _capacity;
+
+        std::uint64_t _count = 0;
+
+        std::vector<std::vector<double>> _levels;
+
+        /**
+         * @brief Number of compactions made so far, its parity selects the offset of the promoted values.
+         */
+        std::uint64_t _compactions = 0;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_QUANTILESKETCH_HPP
@@ -9,6 +9,9 @@
 
 #include "CommonConfig.hpp"
 
+#include <memory_resource>
+#include <string_view>
+
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
 {
@@ -32,11 +35,28 @@ namespace Internal
         DeserializationVariant data;
     };
 
+    /**
+     * @brief Name of an enumerator, it is serialized as a json string.
+     *
+     * The name refers to the static string table of a described enum, see @ref DescribedEnum, so holding an
+     * enum value in a @ref SerializationValue never allocates.
+     */
+    struct EnumName
+    {
+        std::string_view Name;
+
+        bool operator==(const EnumName& other) const
+        {
+            return Name == other.Name;
+        }
+    };
+
     /**
      * @brief Variant type to hold the test result data values of all possible data type.
      */
     using SerializationVariant =
-        boost::variant2::variant<std::string, bool, float, int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t>;
+        boost::variant2::variant<std::string, bool, float, int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t,
+                                 EnumName>;
 
     /**
      * @brief A simple container for holding test result boost::variant type.
@@ -115,6 +135,960 @@ namespace Internal
     };
 
     // #endregion
+
+    // #region Polymorphic Allocator Data Objects
+
+    /**
+     * @brief Allocator of the data objects below, they pass it on to their containers and strings.
+     */
+    using PmrAllocator = std::pmr::polymorphic_allocator<char>;
+
+    /**
+     * @brief Get a copy of a variant, a string alternative being allocated with the given allocator.
+     */
+    template <typename TVariant>
+    TVariant CopyPmrVariant(const TVariant& data, const PmrAllocator& allocator)
+    {
+        if (const std::pmr::string* text = boost::variant2::get_if<std::pmr::string>(&data))
+        {
+            return TVariant(boost::variant2::in_place_type_t<std::pmr::string>(), *text, allocator);
+        }
+
+        return data;
+    }
+
+    /**
+     * @brief Move a variant, a string alternative being moved into the given allocator, or copied if it differs.
+     */
+    template <typename TVariant>
+    TVariant MovePmrVariant(TVariant&& data, const PmrAllocator& allocator)
+    {
+        if (std::pmr::string* text = boost::variant2::get_if<std::pmr::string>(&data))
+        {
+            return TVariant(boost::variant2::in_place_type_t<std::pmr::string>(), std::move(*text), allocator);
+        }
+
+        return std::move(data);
+    }
+
+    /**
+     * @brief The @ref DeserializationVariant alternatives, the string allocated from a memory resource.
+     */
+    using PmrDeserializationVariant = boost::variant2::variant<std::pmr::string, int64_t, uint64_t, double, bool>;
+
+    /**
+     * @brief A container for holding a test policy value allocated from a memory resource.
+     *
+     * Constructed by an allocator-aware container, e.g. a std::pmr::map, it holds an empty string allocated from
+     * the container's memory resource and a copied or moved string is allocated from it too.
+     */
+    struct PmrDeserializationValue
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrDeserializationValue() = default;
+
+        PmrDeserializationValue(PmrDeserializationVariant value)
+            : data(std::move(value))
+        {
+        }
+
+        PmrDeserializationValue(PmrDeserializationVariant value, const allocator_type& allocator)
+            : data(MovePmrVariant(std::move(value), allocator))
+        {
+        }
+
+        explicit PmrDeserializationValue(const allocator_type& allocator)
+            : data(boost::variant2::in_place_type_t<std::pmr::string>(), allocator)
+        {
+        }
+
+        PmrDeserializationValue(const PmrDeserializationValue& other, const allocator_type& allocator)
+            : data(CopyPmrVariant(other.data, allocator))
+        {
+        }
+
+        PmrDeserializationValue(PmrDeserializationValue&& other, const allocator_type& allocator)
+            : data(MovePmrVariant(std::move(other.data), allocator))
+        {
+        }
+
+        PmrDeserializationVariant data;
+    };
+
+    /**
+     * @brief The @ref SerializationVariant alternatives, the string allocated from a memory resource.
+     */
+    using PmrSerializationVariant =
+        boost::variant2::variant<std::pmr::string, bool, float, int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t,
+                                 uint32_t, uint64_t, EnumName>;
+
+    /**
+     * @brief A container for holding a test result value allocated from a memory resource, like
+     * @ref PmrDeserializationValue.
+     */
+    struct PmrSerializationValue
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrSerializationValue() = default;
+
+        PmrSerializationValue(PmrSerializationVariant value)
+            : data(std::move(value))
+        {
+        }
+
+        PmrSerializationValue(PmrSerializationVariant value, const allocator_type& allocator)
+            : data(MovePmrVariant(std::move(value), allocator))
+        {
+        }
+
+        explicit PmrSerializationValue(const allocator_type& allocator)
+            : data(boost::variant2::in_place_type_t<std::pmr::string>(), allocator)
+        {
+        }
+
+        PmrSerializationValue(const PmrSerializationValue& other, const allocator_type& allocator)
+            : data(CopyPmrVariant(other.data, allocator))
+        {
+        }
+
+        PmrSerializationValue(PmrSerializationValue&& other, const allocator_type& allocator)
+            : data(MovePmrVariant(std::move(other.data), allocator))
+        {
+        }
+
+        PmrSerializationVariant data;
+    };
+
+    /**
+     * @struct PmrTestDataTestPolicy
+     *
+     * @brief @ref TestDataTestPolicy whose maps and keys are allocated from a memory resource.
+     */
+    struct PmrTestDataTestPolicy
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrTestDataTestPolicy() = default;
+
+        explicit PmrTestDataTestPolicy(const allocator_type& allocator)
+            : Capabilities(allocator),
+              Settings(allocator)
+        {
+        }
+
+        PmrTestDataTestPolicy(const PmrTestDataTestPolicy& other, const allocator_type& allocator)
+            : Capabilities(other.Capabilities, allocator),
+              Settings(other.Settings, allocator)
+        {
+        }
+
+        PmrTestDataTestPolicy(PmrTestDataTestPolicy&& other, const allocator_type& allocator)
+            : Capabilities(std::move(other.Capabilities), allocator),
+              Settings(std::move(other.Settings), allocator)
+        {
+        }
+
+        std::pmr::map<std::pmr::string, PmrDeserializationValue> Capabilities;
+        std::pmr::map<std::pmr::string, PmrDeserializationValue> Settings;
+    };
+
+    /**
+     * @struct PmrTestDataMetrics
+     *
+     * @brief @ref TestDataMetrics allocated from a memory resource.
+     */
+    struct PmrTestDataMetrics
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrTestDataMetrics() = default;
+
+        explicit PmrTestDataMetrics(const allocator_type& allocator)
+            : MetricData(allocator)
+        {
+        }
+
+        PmrTestDataMetrics(const PmrTestDataMetrics& other, const allocator_type& allocator)
+            : MetricData(other.MetricData, allocator)
+        {
+        }
+
+        PmrTestDataMetrics(PmrTestDataMetrics&& other, const allocator_type& allocator)
+            : MetricData(std::move(other.MetricData), allocator)
+        {
+        }
+
+        std::pmr::map<std::pmr::string, PmrSerializationValue> MetricData;
+    };
+
+    /**
+     * @struct PmrTestDataStepResults
+     *
+     * @brief @ref TestDataStepResults allocated from a memory resource.
+     */
+    struct PmrTestDataStepResults
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrTestDataStepResults() = default;
+
+        explicit PmrTestDataStepResults(const allocator_type& allocator)
+            : Metrics(allocator),
+              OtherData(allocator),
+              PageResults(allocator)
+        {
+        }
+
+        PmrTestDataStepResults(const PmrTestDataStepResults& other, const allocator_type& allocator)
+            : Metrics(other.Metrics, allocator),
+              OtherData(other.OtherData, allocator),
+              PageResults(other.PageResults, allocator)
+        {
+        }
+
+        PmrTestDataStepResults(PmrTestDataStepResults&& other, const allocator_type& allocator)
+            : Metrics(std::move(other.Metrics), allocator),
+              OtherData(std::move(other.OtherData), allocator),
+              PageResults(std::move(other.PageResults), allocator)
+        {
+        }
+
+        std::pmr::vector<PmrTestDataMetrics> Metrics;
+        std::pmr::map<std::pmr::string, PmrSerializationValue> OtherData;
+        std::pmr::map<std::pmr::string, PmrSerializationValue> PageResults;
+    };
+
+    /**
+     * @struct PmrTestDataMonitorResults
+     *
+     * @brief @ref TestDataMonitorResults allocated from a memory resource.
+     */
+    struct PmrTestDataMonitorResults
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrTestDataMonitorResults() = default;
+
+        explicit PmrTestDataMonitorResults(const allocator_type& allocator)
+            : StepResults(allocator),
+              OtherData(allocator)
+        {
+        }
+
+        PmrTestDataMonitorResults(const PmrTestDataMonitorResults& other, const allocator_type& allocator)
+            : StepResults(other.StepResults, allocator),
+              OtherData(other.OtherData, allocator)
+        {
+        }
+
+        PmrTestDataMonitorResults(PmrTestDataMonitorResults&& other, const allocator_type& allocator)
+            : StepResults(std::move(other.StepResults), allocator),
+              OtherData(std::move(other.OtherData), allocator)
+        {
+        }
+
+        std::pmr::vector<PmrTestDataStepResults> StepResults;
+        std::pmr::map<std::pmr::string, PmrSerializationValue> OtherData;
+    };
+
+    /**
+     * @struct PmrTestDataTestResults
+     *
+     * @brief @ref TestDataTestResults allocated from a memory resource.
+     *
+     * Constructed with the allocator of a std::pmr::monotonic_buffer_resource, the whole tree is allocated from it
+     * and released at once with it: the nested objects, the keys and the values get the allocator of their
+     * container when the containers construct them, e.g. with emplace.
+     */
+    struct PmrTestDataTestResults
+    {
+        using allocator_type = PmrAllocator;
+
+        PmrTestDataTestResults() = default;
+
+        explicit PmrTestDataTestResults(const allocator_type& allocator)
+            : MonitorResults(allocator),
+              OtherData(allocator)
+        {
+        }
+
+        PmrTestDataTestResults(const PmrTestDataTestResults& other, const allocator_type& allocator)
+            : MonitorResults(other.MonitorResults, allocator),
+              OtherData(other.OtherData, allocator)
+        {
+        }
+
+        PmrTestDataTestResults(PmrTestDataTestResults&& other, const allocator_type& allocator)
+            : MonitorResults(std::move(other.MonitorResults), allocator),
+              OtherData(std::move(other.OtherData), allocator)
+        {
+        }
+
+        std::pmr::vector<PmrTestDataMonitorResults> MonitorResults;
+        std::pmr::map<std::pmr::string, PmrSerializationValue> OtherData;
+    };
+
+    // #endregion
+
+    // #region Bulk Ingest Data Objects
+
+    /**
+     * @brief Framing of a stream holding multiple JSON documents.
+     */
+    enum class JsonStreamFraming
+    {
+        /**
+         * @brief One document per line (NDJSON), a malformed line never affects its neighbours.
+         */
+        NewlineDelimited,
+
+        /**
+         * @brief Documents simply follow each other, optionally separated by whitespace.
+         */
+        Concatenated
+    };
+
+    /**
+     * @struct TestDataPolicyRecord
+     *
+     * @brief Outcome of de-serializing one document of a bulk stream.
+     */
+    struct TestDataPolicyRecord
+    {
+        /**
+         * @brief 1-based line number of the stream at which the document starts.
+         */
+        std::size_t LineNumber = 0;
+
+        /**
+         * @brief @b true if the document was de-serialized successfully into @ref Policy.
+         */
+        bool IsValid = false;
+
+        TestDataTestPolicy Policy;
+
+        /**
+         * @brief Failure reason if the document is not valid, empty otherwise.
+         */
+        std::string ErrorMessage;
+    };
+
+    // #endregion
+
+    // #region Serialization Pipeline Data Objects
+
+    /**
+     * @brief What a producer experiences when the pipeline queue is full.
+     */
+    enum class BackpressurePolicy
+    {
+        /**
+         * @brief The producer waits until the pipeline made room for the results.
+         */
+        Block,
+
+        /**
+         * @brief The oldest queued results are dropped to make room, the producer never waits.
+         */
+        DropOldest,
+
+        /**
+         * @brief The results are rejected and left to the producer, the producer never waits.
+         */
+        FailFast
+    };
+
+    /**
+     * @struct SerializationPipelineOptions
+     *
+     * @brief Configuration of a serialization pipeline.
+     */
+    struct SerializationPipelineOptions
+    {
+        /**
+         * @brief Minimal number of results the queue holds, it is rounded up to a power of two.
+         */
+        std::size_t QueueCapacity = 1024;
+
+        BackpressurePolicy Backpressure = BackpressurePolicy::Block;
+    };
+
+    /**
+     * @struct SerializationPipelineStatistics
+     *
+     * @brief Snapshot of the counters of a serialization pipeline.
+     */
+    struct SerializationPipelineStatistics
+    {
+        std::size_t QueueCapacity = 0;
+
+        /**
+         * @brief Results waiting in the queue when the snapshot was taken.
+         */
+        std::size_t QueueDepth = 0;
+
+        /**
+         * @brief Highest queue depth seen since the pipeline started.
+         */
+        std::size_t MaxQueueDepth = 0;
+
+        uint64_t Submitted = 0;
+
+        uint64_t Written = 0;
+
+        /**
+         * @brief Results evicted by the @ref BackpressurePolicy::DropOldest policy.
+         */
+        uint64_t Dropped = 0;
+
+        /**
+         * @brief Results refused by the @ref BackpressurePolicy::FailFast policy.
+         */
+        uint64_t Rejected = 0;
+
+        /**
+         * @brief Results whose serialization or write failed.
+         */
+        uint64_t Failed = 0;
+
+        /**
+         * @brief Times a producer had to wait with the @ref BackpressurePolicy::Block policy.
+         */
+        uint64_t ProducerWaits = 0;
+    };
+
+    // #endregion
+
+    // #region Performance Counters Data Objects
+
+    /**
+     * @struct LatencyBucket
+     *
+     * @brief A non-empty bucket of a latency histogram.
+     */
+    struct LatencyBucket
+    {
+        /**
+         * @brief Exclusive upper bound of the latencies counted in the bucket.
+         */
+        uint64_t UpperBoundNanoseconds = 0;
+
+        uint64_t Count = 0;
+    };
+
+    /**
+     * @struct OperationStatistics
+     *
+     * @brief Counters of one operation, aggregated over all the threads.
+     */
+    struct OperationStatistics
+    {
+        std::string Operation;
+
+        uint64_t Calls = 0;
+
+        uint64_t Errors = 0;
+
+        /**
+         * @brief Failed calls per error category, only the categories that occurred are present.
+         */
+        std::map<std::string, uint64_t> ErrorsByCategory;
+
+        uint64_t BytesIn = 0;
+
+        uint64_t BytesOut = 0;
+
+        uint64_t TotalNanoseconds = 0;
+
+        uint64_t MaxNanoseconds = 0;
+
+        /**
+         * @brief Upper bounds of the buckets holding the median and the 99th percentile latencies.
+         */
+        uint64_t P50Nanoseconds = 0;
+
+        uint64_t P99Nanoseconds = 0;
+
+        /**
+         * @brief Latency histogram with logarithmic buckets, in increasing latency order.
+         */
+        std::vector<LatencyBucket> LatencyHistogram;
+    };
+
+    /**
+     * @struct PerformanceSnapshot
+     *
+     * @brief Snapshot of the performance counters of an object.
+     */
+    struct PerformanceSnapshot
+    {
+        std::vector<OperationStatistics> Operations;
+    };
+
+    // #endregion
+
+    // #region Allocation Accounting Data Objects
+
+    /**
+     * @brief Whether the allocations of the intermediate json values are counted.
+     */
+    enum class AllocationTracking
+    {
+        /**
+         * @brief Nothing is counted, the statistics stay zero.
+         */
+        Disabled,
+
+        /**
+         * @brief Every allocation and deallocation is counted, at the cost of an indirection per allocation.
+         */
+        Enabled
+    };
+
+    /**
+     * @struct AllocationStatistics
+     *
+     * @brief Allocations requested from a memory resource, since it was created or last reset.
+     */
+    struct AllocationStatistics
+    {
+        uint64_t Allocations = 0;
+
+        uint64_t Deallocations = 0;
+
+        /**
+         * @brief Sum of the sizes of all the allocations.
+         */
+        uint64_t AllocatedBytes = 0;
+
+        /**
+         * @brief Highest number of bytes allocated and not yet deallocated at any time.
+         */
+        uint64_t PeakBytes = 0;
+    };
+
+    // #endregion
+
+    // #region Policy Cache Data Objects
+
+    /**
+     * @struct PolicyCacheOptions
+     *
+     * @brief Settings of a @ref PolicyCache.
+     */
+    struct PolicyCacheOptions
+    {
+        /**
+         * @brief Budget of the estimated memory held by the cached entries, the least recently used ones are
+         * evicted to stay within it.
+         */
+        std::size_t MaxBytes = 64 * 1024 * 1024;
+    };
+
+    /**
+     * @struct PolicyCacheStatistics
+     *
+     * @brief Counters of a @ref PolicyCache since its construction.
+     */
+    struct PolicyCacheStatistics
+    {
+        uint64_t Hits = 0;
+
+        uint64_t Misses = 0;
+
+        uint64_t Evictions = 0;
+
+        /**
+         * @brief Lookups answered by a cached validation failure, they are also counted as hits.
+         */
+        uint64_t ValidationFailureHits = 0;
+
+        std::size_t EntryCount = 0;
+
+        std::size_t UsedBytes = 0;
+
+        std::size_t MaxBytes = 0;
+    };
+
+    // #endregion
+
+    // #region Policy Reload Data Objects
+
+    /**
+     * @struct PolicyFileWatcherOptions
+     *
+     * @brief Settings of a @ref PolicyFileWatcher.
+     */
+    struct PolicyFileWatcherOptions
+    {
+        /**
+         * @brief Quiet period after the last change of the file before it is reloaded, a burst of writes
+         * results in a single reload.
+         */
+        uint64_t DebounceMilliseconds = 100;
+
+        /**
+         * @brief Whether the file is loaded once when the watcher starts.
+         */
+        bool LoadOnStart = true;
+    };
+
+    /**
+     * @struct PolicyFileWatcherStatistics
+     *
+     * @brief Counters of a @ref PolicyFileWatcher since its construction.
+     */
+    struct PolicyFileWatcherStatistics
+    {
+        /**
+         * @brief Reloads that published a new policy.
+         */
+        uint64_t Reloads = 0;
+
+        /**
+         * @brief Reloads that left the previous policy in place.
+         */
+        uint64_t FailedReloads = 0;
+
+        /**
+         * @brief Change notifications merged into a pending reload by the debounce.
+         */
+        uint64_t CoalescedEvents = 0;
+
+        /**
+         * @brief Time spent reading, validating, deserializing and publishing the file by the last reload.
+         */
+        uint64_t LastReloadNanoseconds = 0;
+
+        /**
+         * @brief Time from the first change of the last burst to the publication of the new policy, the
+         * debounce included.
+         */
+        uint64_t LastSwapLatencyNanoseconds = 0;
+
+        uint64_t MaxSwapLatencyNanoseconds = 0;
+    };
+
+    // #endregion
+
+    // #region Member Matching Data Objects
+
+    /**
+     * @brief How the members of a described struct that do not match a json object are handled.
+     */
+    enum class MemberKeyPolicy
+    {
+        /**
+         * @brief The member is skipped silently, a missing field keeps its current value.
+         */
+        Ignore,
+
+        /**
+         * @brief The deserialization fails with an XSerialization.
+         */
+        Error,
+
+        /**
+         * @brief The member is skipped and its name is recorded in a @ref MemberMatchingReport.
+         */
+        Collect
+    };
+
+    /**
+     * @struct MemberMatchingOptions
+     *
+     * @brief Settings of the matching of the json members against the fields of the described structs.
+     */
+    struct MemberMatchingOptions
+    {
+        /**
+         * @brief Handling of the json members no field is declared for.
+         */
+        MemberKeyPolicy UnknownKeys = MemberKeyPolicy::Ignore;
+
+        /**
+         * @brief Handling of the fields the json object has no member for.
+         */
+        MemberKeyPolicy MissingKeys = MemberKeyPolicy::Error;
+    };
+
+    /**
+     * @struct MemberMatchingReport
+     *
+     * @brief Names collected by the @ref MemberKeyPolicy::Collect policies while reading a document.
+     */
+    struct MemberMatchingReport
+    {
+        std::vector<std::string> UnknownKeys;
+
+        std::vector<std::string> MissingKeys;
+    };
+
+    // #endregion
+
+    // #region Parse Configuration Data Objects
+
+    /**
+     * @brief How the numbers of the json documents are converted.
+     */
+    enum class NumberPrecision
+    {
+        /**
+         * @brief Fast conversion, the doubles may be off by one unit in the last place.
+         */
+        Imprecise,
+
+        /**
+         * @brief Correctly rounded conversion of the doubles, it needs Boost 1.83 or later.
+         */
+        Precise,
+
+        /**
+         * @brief The numbers are only validated, not converted, it needs Boost 1.83 or later.
+         */
+        None
+    };
+
+    /**
+     * @struct JsonParseConfiguration
+     *
+     * @brief Parse options and resource limits of the json documents read by the serializer and the validator.
+     *
+     * The limits are enforced while the document is parsed, a document exceeding one of them is rejected as soon
+     * as the offending byte is reached. A limit of zero means unlimited.
+     */
+    struct JsonParseConfiguration
+    {
+        NumberPrecision Numbers = NumberPrecision::Imprecise;
+
+        /**
+         * @brief Maximal nesting depth of the objects and arrays, at least 1.
+         */
+        std::size_t MaxDepth = 32;
+
+        bool AllowComments = false;
+
+        bool AllowTrailingCommas = false;
+
+        bool AllowInvalidUtf8 = false;
+
+        std::size_t MaxPayloadBytes = 0;
+
+        /**
+         * @brief Maximal length in bytes of a string or of a key, once unescaped.
+         */
+        std::size_t MaxStringLength = 0;
+
+        /**
+         * @brief Maximal number of members of an object or of elements of an array.
+         */
+        std::size_t MaxObjectSize = 0;
+    };
+
+    // #endregion
+
+    // #region Compression Data Objects
+
+    /**
+     * @brief Format of the compressed output.
+     */
+    enum class CompressionFormat
+    {
+        Gzip,
+
+        /**
+         * @brief Only available when built with BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD.
+         */
+        Zstd
+    };
+
+    /**
+     * @struct CompressionOptions
+     *
+     * @brief Configuration of a compressing sink.
+     */
+    struct CompressionOptions
+    {
+        CompressionFormat Format = CompressionFormat::Gzip;
+
+        /**
+         * @brief Compression level of the format, -1 selects the default level of the format.
+         */
+        int Level = -1;
+
+        /**
+         * @brief Size of the independently compressed blocks, 0 compresses the output as a single stream.
+         *
+         * The blocks are complete gzip members or zstd frames, so their concatenation is a valid stream of the
+         * format. They can be compressed in parallel at the cost of a slightly lower compression ratio.
+         */
+        std::size_t BlockSize = 0;
+
+        /**
+         * @brief Maximal number of blocks being compressed at once on the executor, it bounds the memory held.
+         */
+        std::size_t MaxBlocksInFlight = 4;
+    };
+
+    // #endregion
+
+    // #region Metric Summary Data Objects
+
+    /**
+     * @struct MetricSummary
+     *
+     * @brief Summary statistics of the numeric values of one metric key.
+     */
+    struct MetricSummary
+    {
+        std::uint64_t Count = 0;
+        double Min = 0;
+        double Max = 0;
+        double Mean = 0;
+
+        /**
+         * @brief Estimated quantiles, they are exact as long as the values fit into a single level of the sketch.
+         */
+        double P50 = 0;
+        double P95 = 0;
+        double P99 = 0;
+    };
+
+    /**
+     * @struct MetricSummaryOptions
+     *
+     * @brief Configuration of the metric summaries.
+     */
+    struct MetricSummaryOptions
+    {
+        /**
+         * @brief Values retained by each level of the quantile sketches, the larger the more accurate.
+         */
+        std::size_t SketchCapacity = 256;
+
+        /**
+         * @brief Prefix of the keys under which the summaries are embedded into the OtherData maps.
+         */
+        std::string KeyPrefix = "Summary.";
+
+        /**
+         * @brief Whether the Metrics of the steps are kept once their summaries are embedded.
+         */
+        bool KeepRawSeries = true;
+    };
+
+    // #endregion
+
+    // #region Columnar Metrics Data Objects
+
+    /**
+     * @brief Values of a metric column: one vector per alternative of @ref SerializationVariant, in the same
+     * order, and a last one holding the values of the keys whose values are of several types.
+     */
+    using MetricColumnValues =
+        boost::mp11::mp_push_back<boost::mp11::mp_transform<std::vector, SerializationVariant>,
+                                  std::vector<SerializationValue>>;
+
+    /**
+     * @struct MetricColumn
+     *
+     * @brief The values of one metric key across all the rows.
+     */
+    struct MetricColumn
+    {
+        /**
+         * @brief Whether each row holds the key, empty when all of them do.
+         */
+        std::vector<bool> Present;
+
+        /**
+         * @brief The values of the rows holding the key, in row order.
+         */
+        MetricColumnValues Values;
+    };
+
+    /**
+     * @struct ColumnarMetrics
+     *
+     * @brief Struct-of-arrays form of @ref TestDataStepResults::Metrics, each key is stored once.
+     */
+    struct ColumnarMetrics
+    {
+        std::size_t RowCount = 0;
+
+        /**
+         * @brief The distinct keys of the rows, in the order of the columns.
+         */
+        std::vector<std::string> Keys;
+
+        std::vector<MetricColumn> Columns;
+    };
+
+    // #endregion
+    // #region Memory Footprint Data Objects
+
+    /**
+     * @struct MemoryFootprintLevel
+     *
+     * @brief Heap memory held by the containers or the strings found at one path of a data model.
+     */
+    struct MemoryFootprintLevel
+    {
+        /**
+         * @brief Number of containers or strings at the path.
+         */
+        uint64_t Instances = 0;
+
+        /**
+         * @brief Number of elements they hold, the characters for the strings.
+         */
+        uint64_t Elements = 0;
+
+        /**
+         * @brief Bytes they requested from the allocator, their slack included but not their elements' own heap.
+         */
+        uint64_t HeapBytes = 0;
+
+        /**
+         * @brief Part of the heap bytes reserved by the capacity of the containers and not in use.
+         */
+        uint64_t SlackBytes = 0;
+    };
+
+    /**
+     * @struct MemoryFootprintReport
+     *
+     * @brief Memory occupied by a data model tree, per level, and the size of its serialized form.
+     */
+    struct MemoryFootprintReport
+    {
+        /**
+         * @brief Size of the root object itself.
+         */
+        uint64_t InlineBytes = 0;
+
+        /**
+         * @brief Sum of the heap bytes of all the levels.
+         */
+        uint64_t HeapBytes = 0;
+
+        uint64_t SlackBytes = 0;
+
+        /**
+         * @brief Exact length of the compact JSON of the tree.
+         */
+        uint64_t SerializedSize = 0;
+
+        /**
+         * @brief The levels by path, e.g. "MonitorResults[].StepResults" for the step vectors of all the monitors,
+         * "OtherData{}" for the values of a map and "OtherData{key}" for its keys.
+         */
+        std::map<std::string, MemoryFootprintLevel> Levels;
+    };
+
+    // #endregion
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
 
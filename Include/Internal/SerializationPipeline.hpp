@@ -0,0 +1,156 @@
+/*************************************************************************************************
+ * @file SerializationPipeline.hpp
+ *
+ * @brief Declarations for the concrete class @ref SerializationPipeline.
+ *
+ * It serializes the results handed over by the producers on a dedicated thread.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_SERIALIZATIONPIPELINE_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_SERIALIZATIONPIPELINE_HPP
+
+#include "CommonConfig.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Interfaces/IJsonDataSerializer.hpp"
+#include "Interfaces/ISerializationPipeline.hpp"
+#include "Interfaces/ISerializedResultSink.hpp"
+#include "Internal/BoundedMpscQueue.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class SerializationPipeline
+     *
+     * @brief Background serialization stage fed through a bounded lock-free queue.
+     *
+     * Producers only move their results into the queue, a dedicated thread serializes every result as a single
+     * monitor @ref TestDataTestResults document and writes it to the sink, in submission order. Locks are only
+     * taken to put an idle thread to sleep or to wake it up.
+     */
+    class SerializationPipeline : public Interfaces::ISerializationPipeline
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new pipeline and start its thread.
+         *
+         * @param[in] serializer The serializer of the results.
+         * @param[in] sink The destination of the serialized documents.
+         * @param[in] options Queue capacity and backpressure policy.
+         *
+         * @throw XArgumentNull If any of the input params is null.
+         * @throw XInvalidArgument If the queue capacity is 0.
+         */
+        SerializationPipeline(std::shared_ptr<Interfaces::IJsonDataSerializer> serializer,
+                              std::shared_ptr<Interfaces::ISerializedResultSink> sink,
+                              const SerializationPipelineOptions& options = SerializationPipelineOptions{});
+
+        /**
+         * @brief Write all the queued results and stop the thread.
+         */
+        virtual ~SerializationPipeline() override;
+
+        // #endregion
+
+        // #region ISerializationPipeline Implementation
+
+        virtual bool Submit(TestDataMonitorResults&& results) override;
+
+        virtual void Flush() override;
+
+        virtual SerializationPipelineStatistics GetStatistics() const override;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(SerializationPipeline)
+
+        // #region Private Methods
+
+        /**
+         * @brief Thread loop, it runs until the pipeline is stopped and the queue is drained.
+         */
+        void ConsumerLoop();
+
+        /**
+         * @brief Serialize the results and write them to the sink, a failure is only counted.
+         */
+        void Process(TestDataMonitorResults&& results);
+
+        /**
+         * @brief Account for an accepted result which left the queue, whichever way it left.
+         */
+        void Complete();
+
+        /**
+         * @brief Wake up the threads sleeping on the condition if the counter says there are any.
+         */
+        void Notify(std::atomic<std::size_t>& waiterCount, std::condition_variable& condition, bool notifyAll);
+
+        void UpdateMaxQueueDepth();
+
+        // #endregion
+
+        // #region Private Members
+
+        std::shared_ptr<Interfaces::IJsonDataSerializer> _serializer;
+
+        std::shared_ptr<Interfaces::ISerializedResultSink> _sink;
+
+        const BackpressurePolicy _backpressure;
+
+        BoundedMpscQueue<TestDataMonitorResults> _queue;
+
+        std::atomic<uint64_t> _submitted{0};
+
+        std::atomic<uint64_t> _written{0};
+
+        std::atomic<uint64_t> _dropped{0};
+
+        std::atomic<uint64_t> _rejected{0};
+
+        std::atomic<uint64_t> _failed{0};
+
+        std::atomic<uint64_t> _producerWaits{0};
+
+        std::atomic<uint64_t> _completed{0};
+
+        std::atomic<std::size_t> _maxQueueDepth{0};
+
+        /**
+         * @brief Guards the sleeps and wake-ups and @ref _stopping, never the queue itself.
+         */
+        std::mutex _mutex;
+
+        std::condition_variable _consumerCondition;
+
+        std::condition_variable _producerCondition;
+
+        std::condition_variable _flushCondition;
+
+        std::atomic<std::size_t> _consumerWaiting{0};
+
+        std::atomic<std::size_t> _producersWaiting{0};
+
+        std::atomic<std::size_t> _flushersWaiting{0};
+
+        bool _stopping = false;
+
+        /**
+         * @brief The serialization thread, started last so that it only sees constructed members.
+         */
+        std::thread _consumer;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_SERIALIZATIONPIPELINE_HPP
@@ -0,0 +1,245 @@
+/*************************************************************************************************
+ * @file SerializedSizeCalculator.hpp
+ *
+ * @brief Declarations for the concrete class @ref SerializedSizeCalculator.
+ *
+ * It computes the length of the serialized form of a data model without serializing it.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_SERIALIZEDSIZECALCULATOR_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_SERIALIZEDSIZECALCULATOR_HPP
+
+#include "CommonConfig.hpp"
+
+#include <array>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/JsonStringEscaper.hpp"
+#include "Internal/JsonValueWriter.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class SerializedSizeCalculator
+     *
+     * @brief Sizing pass driven by the describe metadata and the @ref SerializationVariant types.
+     *
+     * The computed size is exact for the compact output of @ref JsonValueWriter, it walks the same members and
+     * formats the numbers and escapes the strings the same way, only without storing them.
+     */
+    class SerializedSizeCalculator
+    {
+    public:
+        /**
+         * @brief Get the exact length of the serialized form of a described data model.
+         *
+         * @tparam TElement A described struct of serializable members.
+         *
+         * @param[in] element The data model.
+         *
+         * @return Length in bytes of the serialized JSON.
+         */
+        template <typename TElement,
+                  typename TPublic = bd::describe_members<TElement, bd::mod_public | bd::mod_protected>>
+        static std::size_t Calculate(const TElement& element)
+        {
+            constexpr std::size_t memberCount = boost::mp11::mp_size<TPublic>::value;
+
+            // The braces and the separators between the members.
+            std::size_t size = (0 == memberCount) ? 2 : 1 + memberCount;
+
+            boost::mp11::mp_for_each<TPublic>([&](auto D)
+                                              { size += JsonStringEscaper::GetQuotedSize(D.name) + 1 +
+                                                        Calculate(element.*D.pointer); });
+
+            return size;
+        }
+
+        template <typename TElement, typename TAllocator>
+        static std::size_t Calculate(const std::vector<TElement, TAllocator>& elements)
+        {
+            std::size_t size = elements.empty() ? 2 : 1 + elements.size();
+
+            for (const TElement& element : elements)
+            {
+                size += Calculate(element);
+            }
+
+            return size;
+        }
+
+        template <typename TElement, std::size_t Count>
+        static std::size_t Calculate(const std::array<TElement, Count>& elements)
+        {
+            std::size_t size = elements.empty() ? 2 : 1 + elements.size();
+
+            for (const TElement& element : elements)
+            {
+                size += Calculate(element);
+            }
+
+            return size;
+        }
+
+        template <typename TKey, typename TElement, typename TCompare, typename TAllocator>
+        static std::size_t Calculate(const std::map<TKey, TElement, TCompare, TAllocator>& elements)
+        {
+            return CalculateObject(elements);
+        }
+
+        /**
+         * @brief The members are not sorted, but the size of an object does not depend on their order.
+         */
+        template <typename TElement>
+        static std::size_t Calculate(const std::unordered_map<std::string, TElement>& elements)
+        {
+            return CalculateObject(elements);
+        }
+
+        /**
+         * @brief An empty optional is written as null.
+         */
+        template <typename TElement>
+        static std::size_t Calculate(const std::optional<TElement>& element)
+        {
+            return element.has_value() ? Calculate(*element) : 4;
+        }
+
+        static std::size_t Calculate(const std::string& text)
+        {
+            return CalculateScalar(text);
+        }
+
+        static std::size_t Calculate(const std::pmr::string& text)
+        {
+            return CalculateScalar(text);
+        }
+
+        template <typename TNumber, typename TEnableIf = std::enable_if_t<std::is_arithmetic_v<TNumber>>>
+        static std::size_t Calculate(TNumber number)
+        {
+            return CalculateScalar(number);
+        }
+
+        template <typename TEnum,
+                  typename TEnableIf = std::enable_if_t<bd::has_describe_enumerators<TEnum>::value>>
+        static std::size_t Calculate(TEnum value)
+        {
+            return JsonStringEscaper::GetQuotedSize(DescribedEnum<TEnum>::ToString(value));
+        }
+
+        static std::size_t Calculate(const SerializationValue& value)
+        {
+            return CalculateVariant(value.data);
+        }
+
+        static std::size_t Calculate(const PmrSerializationValue& value)
+        {
+            return CalculateVariant(value.data);
+        }
+
+        /**
+         * @brief A policy value is sized the way it is written back, the numbers in their widened type.
+         */
+        static std::size_t Calculate(const DeserializationValue& value)
+        {
+            return CalculateVariant(value.data);
+        }
+
+        static std::size_t Calculate(const PmrDeserializationValue& value)
+        {
+            return CalculateVariant(value.data);
+        }
+
+        static std::size_t Calculate(const CompactValue& value)
+        {
+            return value.Visit([](auto scalar)
+                               {
+                                   if constexpr (std::is_same_v<decltype(scalar), std::string_view>)
+                                   {
+                                       return JsonStringEscaper::GetQuotedSize(scalar);
+                                   }
+                                   else
+                                   {
+                                       return CalculateScalar(scalar);
+                                   }
+                               });
+        }
+
+    private:
+        template <typename TMap>
+        static std::size_t CalculateObject(const TMap& elements)
+        {
+            std::size_t size = elements.empty() ? 2 : 1 + elements.size();
+
+            for (const auto& [key, element] : elements)
+            {
+                size += JsonStringEscaper::GetQuotedSize(key) + 1 + Calculate(element);
+            }
+
+            return size;
+        }
+
+        template <typename TVariant>
+        static std::size_t CalculateVariant(const TVariant& variant)
+        {
+            return bv2::visit([](const auto& data)
+                              { return CalculateScalar(data); },
+                              variant);
+        }
+
+        static std::size_t CalculateScalar(const std::string& text)
+        {
+            return JsonStringEscaper::GetQuotedSize(text);
+        }
+
+        static std::size_t CalculateScalar(const std::pmr::string& text)
+        {
+            return JsonStringEscaper::GetQuotedSize(text);
+        }
+
+        static std::size_t CalculateScalar(const EnumName& name)
+        {
+            return JsonStringEscaper::GetQuotedSize(name.Name);
+        }
+
+        static std::size_t CalculateScalar(bool flag)
+        {
+            return flag ? 4 : 5;
+        }
+
+        /**
+         * @brief Numbers are sized the way they are widened into a boost::json::value, then formatted.
+         */
+        template <typename TNumber>
+        static std::size_t CalculateScalar(TNumber number)
+        {
+            char buffer[JsonValueWriter::MaxNumberLength];
+
+            if constexpr (std::is_floating_point_v<TNumber>)
+            {
+                return JsonValueWriter::FormatNumber(static_cast<double>(number), buffer);
+            }
+            else if constexpr (std::is_signed_v<TNumber>)
+            {
+                return JsonValueWriter::FormatNumber(static_cast<int64_t>(number), buffer);
+            }
+            else
+            {
+                return JsonValueWriter::FormatNumber(static_cast<uint64_t>(number), buffer);
+            }
+        }
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_SERIALIZEDSIZECALCULATOR_HPP
@@ -0,0 +1,109 @@
+/*************************************************************************************************
+ * @file ThreadPool.hpp
+ *
+ * @brief Declarations for the concrete class @ref ThreadPool.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_THREADPOOL_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_THREADPOOL_HPP
+
+#include "CommonConfig.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Interfaces/IExecutor.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class ThreadPool
+     *
+     * @brief A fixed size pool of worker threads executing posted tasks in FIFO order.
+     *
+     * The workers are started by the first posted task, so a pool that is never used costs no thread.
+     *
+     * Tasks must not throw; an escaping exception terminates the process like it would on any other thread.
+     */
+    class ThreadPool : public Interfaces::IExecutor
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new thread pool, its workers are started on the first @ref Post.
+         *
+         * @param[in] threadCount Number of worker threads, 0 selects the hardware concurrency.
+         */
+        explicit ThreadPool(std::size_t threadCount = 0);
+
+        /**
+         * @brief Run all the pending tasks to completion and join the workers.
+         */
+        virtual ~ThreadPool() override;
+
+        // #endregion
+
+        // #region IExecutor Implementation
+
+        /**
+         * @brief Queue a task for execution on one of the workers.
+         *
+         * @param[in] task The task to be executed.
+         *
+         * @throw XArgumentNull If the task is empty.
+         */
+        virtual void Post(std::function<void()> task) override;
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Get the number of worker threads.
+         *
+         * @return Count of worker threads the pool runs its tasks on, started or not yet.
+         */
+        std::size_t GetThreadCount() const;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(ThreadPool)
+
+        // #region Private Methods
+
+        /**
+         * @brief Worker loop, it runs until the pool is stopped and the queue is drained.
+         */
+        void WorkerLoop();
+
+        // #endregion
+
+        // #region Private Members
+
+        std::mutex _mutex;
+
+        std::condition_variable _condition;
+
+        std::deque<std::function<void()>> _tasks;
+
+        bool _stopping;
+
+        const std::size_t _threadCount;
+
+        /**
+         * @brief Started by the first posted task, under the lock.
+         */
+        std::vector<std::thread> _workers;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_THREADPOOL_HPP
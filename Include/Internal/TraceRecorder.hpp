@@ -0,0 +1,210 @@
+/*************************************************************************************************
+ * @file TraceRecorder.hpp
+ *
+ * @brief Declarations for the concrete classes @ref TraceRecorder and @ref TraceScope.
+ *
+ * They record the phases of the calls and dump them in the Chrome trace event format, which Perfetto and
+ * chrome://tracing open.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_TRACERECORDER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_TRACERECORDER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <atomic>
+#include <chrono>
+
+#include "Internal/PerThread.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class TraceRecorder
+     *
+     * @brief Records complete events into per-thread rings and flushes them as a Chrome trace event document.
+     *
+     * Each thread only writes its own ring, the handoff to the flushing thread is a single release store so
+     * recording never takes a lock. When a ring is full the new events are dropped and counted, nothing blocks.
+     * The events of the exited threads that were not flushed yet are kept in a retired ring, under its own thread
+     * id.
+     */
+    class TraceRecorder
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Events a thread can hold between two flushes.
+         */
+        static constexpr std::size_t RingCapacity = 4096;
+
+        // #region Construction/Destruction
+
+        /**
+         * @brief Construct a new recorder, the timestamps are relative to its construction.
+         */
+        TraceRecorder();
+
+        ~TraceRecorder();
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Record a complete event on the calling thread.
+         *
+         * @param[in] category Category of the event, it must be a string literal.
+         * @param[in] name Name of the event, it must be a string literal.
+         * @param[in] start When the event started.
+         * @param[in] end When the event ended.
+         * @param[in] bytes Bytes processed by the event.
+         */
+        void Record(const char* category, const char* name, Clock::time_point start, Clock::time_point end,
+                    uint64_t bytes);
+
+        /**
+         * @brief Take all the recorded events out of the rings.
+         *
+         * @return The events as a Chrome trace event JSON document.
+         */
+        std::string Flush();
+
+        /**
+         * @brief Take all the recorded events out of the rings and write them to a file.
+         *
+         * @param[in] path Path of the trace file, it is overwritten.
+         *
+         * @throw XInvalidArgument If the file cannot be written.
+         */
+        void FlushToFile(const std::string& path);
+
+        /**
+         * @brief Get the number of events dropped because a ring was full.
+         */
+        uint64_t GetDroppedEventCount() const;
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(TraceRecorder)
+
+        /**
+         * @struct TraceEvent
+         *
+         * @brief A complete event, the names are not owned.
+         */
+        struct TraceEvent
+        {
+            const char* Category;
+            const char* Name;
+            uint64_t StartNanoseconds;
+            uint64_t DurationNanoseconds;
+            uint64_t Bytes;
+        };
+
+        /**
+         * @struct ThreadRing
+         *
+         * @brief Single producer single consumer ring of the events of one thread.
+         */
+        struct ThreadRing
+        {
+            ThreadRing();
+
+            const uint64_t ThreadId;
+
+            std::atomic<std::size_t> Head;
+
+            std::atomic<std::size_t> Tail;
+
+            std::array<TraceEvent, RingCapacity> Events;
+        };
+
+        // #region Private Methods
+
+        /**
+         * @brief Move the events of an exiting thread into the retired ring, the events that do not fit are
+         * dropped.
+         */
+        void MergeExited(ThreadRing& exited, ThreadRing& retired);
+
+        // #endregion
+
+        // #region Private Members
+
+        const Clock::time_point _origin;
+
+        /**
+         * @brief Declared before the rings, the exiting threads count into it while the rings are destroyed.
+         */
+        std::atomic<uint64_t> _droppedEvents;
+
+        PerThread<ThreadRing> _rings;
+
+        /**
+         * @brief Keeps a single consumer per ring.
+         */
+        std::mutex _flushMutex;
+
+        // #endregion
+    };
+
+    /**
+     * @class TraceScope
+     *
+     * @brief Records the lifetime of a scope as an event, it does nothing without a recorder.
+     */
+    class TraceScope
+    {
+    public:
+        // #region Construction/Destruction
+
+        /**
+         * @brief Start an event.
+         *
+         * @param[in] recorder The recorder, null to disable the tracing.
+         * @param[in] category Category of the event, it must be a string literal.
+         * @param[in] name Name of the event, it must be a string literal.
+         */
+        TraceScope(TraceRecorder* recorder, const char* category, const char* name);
+
+        /**
+         * @brief End the event and record it.
+         */
+        ~TraceScope();
+
+        // #endregion
+
+        // #region Public Methods
+
+        /**
+         * @brief Set the bytes processed by the event.
+         */
+        void SetBytes(uint64_t bytes);
+
+        // #endregion
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(TraceScope)
+
+        // #region Private Members
+
+        TraceRecorder* const _recorder;
+
+        const char* const _category;
+
+        const char* const _name;
+
+        TraceRecorder::Clock::time_point _start;
+
+        uint64_t _bytes;
+
+        // #endregion
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_TRACERECORDER_HPP
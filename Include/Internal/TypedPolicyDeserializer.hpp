@@ -0,0 +1,306 @@
+/*************************************************************************************************
+ * @file TypedPolicyDeserializer.hpp
+ *
+ * @brief Declarations for the concrete class @ref TypedPolicyDeserializer.
+ *
+ * It fills plain described structs of typed fields straight from a json policy payload.
+ *
+ *************************************************************************************************/
+#ifndef _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_TYPEDPOLICYDESERIALIZER_HPP
+#define _BOOST_AUTO_JSON_SERIALIZER_INTERNAL_TYPEDPOLICYDESERIALIZER_HPP
+
+#include "CommonConfig.hpp"
+
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/JsonCodec.hpp"
+#include "Internal/LimitedJsonParser.hpp"
+
+#include "Exceptions/XSerialization.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    /**
+     * @class TypedPolicyDeserializer
+     *
+     * @brief Deserializer of policies into structs declared with BOOST_DESCRIBE_STRUCT.
+     *
+     * Every described member is read from the member of the same name, so the hot loops read plain fields
+     * instead of looking up a @ref DeserializationValue map and visiting its variant. The supported fields are
+     * bool, the integral and floating point types, std::string, described enums, nested described structs and
+     * std::optional of any of them. The numbers are range checked once, here: a value that does not fit the field
+     * exactly is an error. A missing member is an error unless its field is optional, then the field is reset, as
+     * it is by a null member. Unknown members are ignored.
+     *
+     * All the missing and mistyped fields of a payload are reported together, by their path, in a single
+     * @ref Exceptions::XSerialization.
+     */
+    class TypedPolicyDeserializer
+    {
+    public:
+        /**
+         * @brief Deserialize the stringified JSON payload into a described struct.
+         *
+         * @tparam TPolicy A described struct.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in] configuration Options and limits of the parser.
+         *
+         * @return The filled struct.
+         *
+         * @throw XInvalidArgument If the configuration is not supported.
+         * @throw XSerialization If the payload is not json, exceeds a limit or any field is missing or mistyped.
+         */
+        template <typename TPolicy>
+        static TPolicy Deserialize(std::string_view payload, const JsonParseConfiguration& configuration = {})
+        {
+            TPolicy policy{};
+            Deserialize(payload, policy, configuration);
+
+            return policy;
+        }
+
+        /**
+         * @brief Deserialize the stringified JSON payload into an existing described struct.
+         *
+         * The fields are assigned in place, so the strings keep their capacity from one call to the next.
+         *
+         * @tparam TPolicy A described struct.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in,out] policy The struct to fill, it is partially filled if an exception is thrown.
+         * @param[in] configuration Options and limits of the parser.
+         *
+         * @throw XInvalidArgument If the configuration is not supported.
+         * @throw XSerialization If the payload is not json, exceeds a limit or any field is missing or mistyped.
+         */
+        template <typename TPolicy>
+        static void Deserialize(std::string_view payload, TPolicy& policy,
+                                const JsonParseConfiguration& configuration = {})
+        {
+            LimitedJsonParser parser(configuration);
+            Deserialize(payload, policy, parser);
+        }
+
+        /**
+         * @brief Deserialize the stringified JSON payload into an existing described struct with a parser reused
+         * from one call to the next.
+         *
+         * @tparam TPolicy A described struct.
+         *
+         * @param[in] payload String formatted json payload.
+         * @param[in,out] policy The struct to fill, it is partially filled if an exception is thrown.
+         * @param[in,out] parser The parser, along with its options and limits.
+         *
+         * @throw XSerialization If the payload is not json, exceeds a limit or any field is missing or mistyped.
+         */
+        template <typename TPolicy>
+        static void Deserialize(std::string_view payload, TPolicy& policy, LimitedJsonParser& parser)
+        {
+            // Most policies fit in the stack buffer, the parsed document only lives for the duration of the call.
+            unsigned char buffer[4096];
+            bj::monotonic_resource resource(buffer, sizeof(buffer));
+
+            const bj::value value = JsonCodec::Parse(payload, parser, bj::storage_ptr(&resource));
+
+            Deserialize(value, policy);
+        }
+
+        /**
+         * @brief Fill an existing described struct from a parsed json value.
+         *
+         * @tparam TPolicy A described struct.
+         *
+         * @param[in] value The parsed payload, an object.
+         * @param[in,out] policy The struct to fill, it is partially filled if an exception is thrown.
+         *
+         * @throw XSerialization If any field is missing or mistyped.
+         */
+        template <typename TPolicy>
+        static void Deserialize(const bj::value& value, TPolicy& policy)
+        {
+            static_assert(bd::has_describe_members<TPolicy>::value, "The policy must be a described struct.");
+
+            std::string errors;
+            Read(value, policy, std::string(), std::string_view(), errors);
+
+            if (!errors.empty())
+            {
+                throw Exceptions::XSerialization("Deserialization -> " + errors);
+            }
+        }
+
+    private:
+        template <typename TField>
+        struct IsOptional : std::false_type
+        {
+        };
+
+        template <typename TField>
+        struct IsOptional<std::optional<TField>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Join the path of an object and the name of one of its members.
+         */
+        static std::string GetPath(const std::string& parentPath, std::string_view name)
+        {
+            std::string path = parentPath;
+
+            if (!path.empty() && !name.empty())
+            {
+                path.push_back('.');
+            }
+
+            return path.append(name);
+        }
+
+        /**
+         * @brief Record a field error, the errors are separated by semicolons.
+         */
+        static void AddError(std::string& errors, const std::string& parentPath, std::string_view name,
+                             const char* reason)
+        {
+            const std::string path = GetPath(parentPath, name);
+
+            if (!errors.empty())
+            {
+                errors.append("; ");
+            }
+
+            errors.append(path.empty() ? std::string("<root>") : path).append(": ").append(reason);
+        }
+
+        /**
+         * @brief Read a json value into a field of any supported type.
+         *
+         * The path of the field is only built when it is needed, for an error or for the members of an object.
+         *
+         * @param[in] value The json value.
+         * @param[out] field The field, left untouched if the value does not fit it.
+         * @param[in] parentPath Dotted path of the object holding the field.
+         * @param[in] name Name of the field within its object.
+         * @param[in,out] errors The errors found so far.
+         */
+        template <typename TField>
+        static void Read(const bj::value& value, TField& field, const std::string& parentPath, std::string_view name,
+                         std::string& errors)
+        {
+            if constexpr (std::is_same_v<TField, bool>)
+            {
+                if (!value.is_bool())
+                {
+                    AddError(errors, parentPath, name, "expected a boolean");
+                    return;
+                }
+
+                field = value.get_bool();
+            }
+            else if constexpr (std::is_arithmetic_v<TField>)
+            {
+                if (!value.is_number())
+                {
+                    AddError(errors, parentPath, name, "expected a number");
+                    return;
+                }
+
+                bj::error_code errorCode;
+                const TField number = value.to_number<TField>(errorCode);
+
+                if (errorCode)
+                {
+                    AddError(errors, parentPath, name, "number out of range or not exact");
+                    return;
+                }
+
+                field = number;
+            }
+            else if constexpr (std::is_same_v<TField, std::string>)
+            {
+                const bj::string* text = value.if_string();
+
+                if (nullptr == text)
+                {
+                    AddError(errors, parentPath, name, "expected a string");
+                    return;
+                }
+
+                field.assign(text->data(), text->size());
+            }
+            else if constexpr (bd::has_describe_enumerators<TField>::value)
+            {
+                const bj::string* text = value.if_string();
+
+                if (nullptr == text || !DescribedEnum<TField>::TryParse(std::string_view(text->data(), text->size()), field))
+                {
+                    AddError(errors, parentPath, name, "expected an enumerator name");
+                    return;
+                }
+            }
+            else if constexpr (IsOptional<TField>::value)
+            {
+                if (value.is_null())
+                {
+                    field.reset();
+                    return;
+                }
+
+                if (!field.has_value())
+                {
+                    field.emplace();
+                }
+
+                Read(value, *field, parentPath, name, errors);
+            }
+            else
+            {
+                static_assert(bd::has_describe_members<TField>::value,
+                              "The fields must be bool, numbers, std::string, described enums, std::optional or described structs.");
+
+                const bj::object* object = value.if_object();
+
+                if (nullptr == object)
+                {
+                    AddError(errors, parentPath, name, "expected an object");
+                    return;
+                }
+
+                const std::string path = GetPath(parentPath, name);
+
+                boost::mp11::mp_for_each<bd::describe_members<TField, bd::mod_public>>([&](auto D)
+                                                                                       { ReadMember(*object, field.*D.pointer, path, D.name, errors); });
+            }
+        }
+
+        /**
+         * @brief Read a member of a json object into a field.
+         */
+        template <typename TField>
+        static void ReadMember(const bj::object& object, TField& field, const std::string& path, const char* name,
+                               std::string& errors)
+        {
+            const bj::value* member = object.if_contains(name);
+
+            if (nullptr != member)
+            {
+                Read(*member, field, path, name, errors);
+            }
+            else if constexpr (IsOptional<TField>::value)
+            {
+                field.reset();
+            }
+            else
+            {
+                AddError(errors, path, name, "missing");
+            }
+        }
+    };
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
+
+#endif // !_BOOST_AUTO_JSON_SERIALIZER_INTERNAL_TYPEDPOLICYDESERIALIZER_HPP
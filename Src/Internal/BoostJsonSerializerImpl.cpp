@@ -9,8 +9,10 @@
 
 #include "Internal/BoostJsonSerializerImpl.hpp"
 #include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/JsonCodec.hpp"
+#include "Internal/SerializedSizeCalculator.hpp"
+#include "Internal/TraceRecorder.hpp"
 
-#include "Exceptions/XSerialization.hpp"
 #include "Exceptions/XArgumentNull.hpp"
 
 // #region Namespace Symbols
@@ -22,28 +24,27 @@ using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
 namespace
 {
     /**
-     * @brief A common exception handler that handles all exceptions related to serialization errors.
-     *
-     * @param[in] ex base exception which is carrying actual exception object.
-     * @param[in] errorMessage A message to prefixed with exception info.
+     * @brief Ends the call of a context when the call leaves, whichever way it leaves.
      */
-    [[noreturn]] void ThrowSerializationException(const std::exception& ex,
-                                                  const std::string& errorMessage)
+    template <typename TContext>
+    class ScratchReleaser
     {
-        const std::set<const std::type_info*> SerializationException = {
-            /* &typeid(boost::wrapexcept<std::bad_alloc>) */
-            &typeid(boost::wrapexcept<std::invalid_argument>),
-            &typeid(boost::wrapexcept<std::length_error>),
-            &typeid(boost::wrapexcept<std::out_of_range>),
-            &typeid(boost::wrapexcept<boost::system::system_error>)};
-
-        if (SerializationException.count(&typeid(ex)))
+    public:
+        explicit ScratchReleaser(TContext& context)
+            : _context(context)
         {
-            throw XSerialization(errorMessage + std::string(" -> ") + ex.what());
         }
 
-        throw;
-    }
+        ~ScratchReleaser()
+        {
+            _context.EndCall();
+        }
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(ScratchReleaser)
+
+        TContext& _context;
+    };
 }
 
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -53,45 +54,175 @@ namespace Internal
 
     // #region Construction/Destruction
 
-    BoostJsonSerializerImpl::BoostJsonSerializerImpl() = default;
+    BoostJsonSerializerImpl::BoostJsonSerializerImpl(AllocationTracking allocationTracking,
+                                                     std::shared_ptr<TraceRecorder> traceRecorder,
+                                                     const MemberMatchingOptions& memberMatching,
+                                                     const JsonParseConfiguration& parseConfiguration)
+        : _allocationTracking(allocationTracking),
+          _traceRecorder(std::move(traceRecorder)),
+          _memberMatching(memberMatching),
+          _parseConfiguration(parseConfiguration)
+    {
+        // Rejects an unsupported configuration here rather than on the first deserialization.
+        LimitedJsonParser::ToParseOptions(_parseConfiguration);
+    }
 
     BoostJsonSerializerImpl::~BoostJsonSerializerImpl() = default;
 
+    BoostJsonSerializerImpl::ThreadContext::ThreadContext()
+        : Buffer(std::make_unique<unsigned char[]>(ScratchBufferSize)),
+          Resource(Buffer.get(), ScratchBufferSize),
+          Counting(bj::storage_ptr(&Resource)),
+          LastStatistics()
+    {
+    }
+
+    bj::storage_ptr BoostJsonSerializerImpl::ThreadContext::BeginCall(AllocationTracking allocationTracking)
+    {
+        if (AllocationTracking::Disabled == allocationTracking)
+        {
+            return bj::storage_ptr(&Resource);
+        }
+
+        Counting.Reset();
+
+        return bj::storage_ptr(&Counting);
+    }
+
+    void BoostJsonSerializerImpl::ThreadContext::EndCall()
+    {
+        LastStatistics = Counting.GetStatistics();
+        Resource.release();
+    }
+
     // #endregion
 
     // #region Public Methods
 
     TestDataTestPolicy BoostJsonSerializerImpl::Deserialize(const std::string& payload)
     {
-        try
-        {
-            // Parse the stringified JSON to object.
-            bj::value bjValue = bj::parse(payload);
+        TestDataTestPolicy testPolicy;
+        Deserialize(payload, testPolicy);
 
-            // Deserialize to data structure.
-            TestDataTestPolicy testPolicy = bj::value_to<TestDataTestPolicy>(bjValue);
+        return testPolicy;
+    }
 
-            return testPolicy;
-        }
-        catch (const std::exception& ex)
+    void BoostJsonSerializerImpl::Deserialize(const std::string& payload, TestDataTestPolicy& policy)
+    {
+        DeserializeInto(payload, policy);
+    }
+
+    PmrTestDataTestPolicy BoostJsonSerializerImpl::Deserialize(const std::string& payload,
+                                                               std::pmr::memory_resource* resource)
+    {
+        if (nullptr == resource)
         {
-            ThrowSerializationException(ex, "Deserialization");
+            throw XArgumentNull("BoostJsonSerializerImpl::resource");
         }
+
+        PmrTestDataTestPolicy policy{PmrAllocator(resource)};
+        DeserializeInto(payload, policy);
+
+        return policy;
     }
 
     std::string BoostJsonSerializerImpl::Serialize(const TestDataTestResults& entity)
     {
+        TraceScope callScope(_traceRecorder.get(), TraceCategory, "Serialize");
+
+        ThreadContext& context = _contexts.Get();
+
+        // Declared ahead of the json values so that they are destroyed before their memory is released.
+        ScratchReleaser releaser(context);
+
+        std::string resultPayload;
+        JsonCodec::Serialize(entity, resultPayload, context.BeginCall(_allocationTracking), _traceRecorder.get(),
+                             TraceCategory);
+
+        callScope.SetBytes(resultPayload.size());
+
+        return resultPayload;
+    }
+
+    void BoostJsonSerializerImpl::Serialize(const TestDataTestResults& entity, Interfaces::IChunkSink& sink)
+    {
+        TraceScope callScope(_traceRecorder.get(), TraceCategory, "Serialize");
+
+        ThreadContext& context = _contexts.Get();
+
+        // Declared ahead of the json values so that they are destroyed before their memory is released.
+        ScratchReleaser releaser(context);
+
+        // The buffer keeps its capacity from one call to the next.
+        JsonCodec::Serialize(entity, sink, context.ChunkBuffer, ChunkSize, context.BeginCall(_allocationTracking),
+                             _traceRecorder.get(), TraceCategory);
+    }
+
+    std::size_t BoostJsonSerializerImpl::GetSerializedSize(const TestDataTestResults& entity)
+    {
+        return SerializedSizeCalculator::Calculate(entity);
+    }
+
+    std::size_t BoostJsonSerializerImpl::GetContextCount() const
+    {
+        return _contexts.GetContextCount();
+    }
+
+    AllocationStatistics BoostJsonSerializerImpl::GetLastAllocationStatistics()
+    {
+        return _contexts.Get().LastStatistics;
+    }
+
+    MemberMatchingReport BoostJsonSerializerImpl::GetLastMemberMatchingReport()
+    {
+        return _contexts.Get().LastMemberReport;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    template <typename TPolicy>
+    void BoostJsonSerializerImpl::DeserializeInto(const std::string& payload, TPolicy& policy)
+    {
+        TraceScope callScope(_traceRecorder.get(), TraceCategory, "Deserialize");
+        callScope.SetBytes(payload.size());
+
+        ThreadContext& context = _contexts.Get();
+        context.LastMemberReport.UnknownKeys.clear();
+        context.LastMemberReport.MissingKeys.clear();
+
+        // Declared ahead of the json values so that they are destroyed before their memory is released.
+        ScratchReleaser releaser(context);
+
         try
         {
-            bj::value bjValue = bj::value_from(entity);
+            // The value shares the storage of the parsed document, so assigning the document moves it.
+            bj::storage_ptr storage = context.BeginCall(_allocationTracking);
+            bj::value bjValue(storage);
+
+            {
+                TraceScope parseScope(_traceRecorder.get(), TraceCategory, "Parse");
+                parseScope.SetBytes(payload.size());
+
+                if (!context.Parser)
+                {
+                    context.Parser.emplace(_parseConfiguration);
+                }
+
+                // Parse the stringified JSON to object, within the configured limits.
+                bjValue = JsonCodec::Parse(payload, *context.Parser, storage);
+            }
 
-            std::string resultPayload = bj::serialize(bjValue);
+            TraceScope convertScope(_traceRecorder.get(), TraceCategory, "Convert");
 
-            return resultPayload;
+            // Deserialize to data structure, the nodes and strings the policy already owns are reused.
+            InPlaceDeserializer::Deserialize(bjValue, policy, context.Scratch, _memberMatching,
+                                             &context.LastMemberReport);
         }
         catch (const std::exception& ex)
         {
-            ThrowSerializationException(ex, "Serialization");
+            JsonCodec::ThrowSerializationException(ex, "Deserialization");
         }
     }
 
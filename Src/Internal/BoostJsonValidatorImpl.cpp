@@ -8,6 +8,10 @@
  *************************************************************************************************/
 
 #include "Internal/BoostJsonValidatorImpl.hpp"
+#include "Internal/JsonStructuralValidator.hpp"
+#include "Internal/LimitedJsonParser.hpp"
+#include "Internal/TraceRecorder.hpp"
+
 #include "Exceptions/XInvalidFormat.hpp"
 
 // #region Namespace Symbols
@@ -23,7 +27,14 @@ namespace Internal
 
     // #region Construction/Destruction
 
-    BoostJsonValidatorImpl::BoostJsonValidatorImpl() = default;
+    BoostJsonValidatorImpl::BoostJsonValidatorImpl(std::shared_ptr<TraceRecorder> traceRecorder,
+                                                   const JsonParseConfiguration& parseConfiguration)
+        : _traceRecorder(std::move(traceRecorder)),
+          _parseConfiguration(parseConfiguration)
+    {
+        // Rejects an unsupported configuration here rather than on the first validation.
+        LimitedJsonParser::ToParseOptions(_parseConfiguration);
+    }
 
     BoostJsonValidatorImpl::~BoostJsonValidatorImpl() = default;
 
@@ -33,10 +44,38 @@ namespace Internal
 
     void BoostJsonValidatorImpl::Validate(const std::string& payload)
     {
+        TraceScope callScope(_traceRecorder.get(), TraceCategory, "Validate");
+        callScope.SetBytes(payload.size());
+
+        if (0 != _parseConfiguration.MaxPayloadBytes && payload.size() > _parseConfiguration.MaxPayloadBytes)
+        {
+            throw XInvalidFormat("Invalid JSON payload: the payload exceeds " +
+                                 std::to_string(_parseConfiguration.MaxPayloadBytes) + " bytes");
+        }
+
+        // Large payloads are accepted by the vectorized validator without building a DOM. It only proves
+        // acceptance, anything else is decided (and reported) by the parser below. It knows nothing of the string
+        // and object size limits, so it is skipped when they are set.
+        if (payload.size() >= StructuralFastPathThreshold && 0 == _parseConfiguration.MaxStringLength &&
+            0 == _parseConfiguration.MaxObjectSize)
+        {
+            TraceScope scanScope(_traceRecorder.get(), TraceCategory, "StructuralScan");
+            scanScope.SetBytes(payload.size());
+
+            if (JsonStructuralValidator::IsAccepted(payload, _parseConfiguration.MaxDepth))
+            {
+                return;
+            }
+        }
+
+        TraceScope parseScope(_traceRecorder.get(), TraceCategory, "Parse");
+        parseScope.SetBytes(payload.size());
+
         bj::error_code errorCode;
 
-        // It will set the error code if there is any glitch with the provided json payload.
-        bj::parse(payload, errorCode);
+        // It will set the error code if there is any glitch with the provided json payload, no value is built.
+        LimitedJsonParser parser(_parseConfiguration);
+        parser.Check(payload, errorCode);
 
         if (errorCode)
         {
@@ -0,0 +1,332 @@
+/*************************************************************************************************
+ * @file ColumnarMetricsConverter.cpp
+ *
+ * @brief Concrete implementation of @ref ColumnarMetricsConverter class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/ColumnarMetricsConverter.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "Internal/JsonStringEscaper.hpp"
+#include "Internal/JsonValueWriter.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    namespace bv2 = boost::variant2;
+
+    namespace
+    {
+        /**
+         * @brief Number of alternatives of the column values, the last one holds the mixed values.
+         */
+        constexpr std::size_t ColumnTypeCount = boost::mp11::mp_size<MetricColumnValues>::value;
+
+        constexpr std::size_t MixedColumnIndex = ColumnTypeCount - 1;
+
+        /**
+         * @brief Layout of the column of a key, found by the first pass over the rows.
+         */
+        struct ColumnLayout
+        {
+            /**
+             * @brief Alternative of the column values.
+             */
+            std::size_t TypeIndex;
+
+            /**
+             * @brief Number of rows holding the key.
+             */
+            std::size_t Count;
+
+            std::size_t ColumnIndex;
+        };
+
+        std::size_t GetValueCount(const MetricColumnValues& values)
+        {
+            return bv2::visit([](const auto& typedValues)
+                              { return typedValues.size(); },
+                              values);
+        }
+
+        /**
+         * @brief Get the value of a row out of a column.
+         */
+        template <typename TValue>
+        SerializationValue ToSerializationValue(const TValue& value)
+        {
+            if constexpr (std::is_same_v<TValue, SerializationValue>)
+            {
+                return value;
+            }
+            else
+            {
+                return SerializationValue{SerializationVariant(bv2::in_place_type_t<TValue>(), value)};
+            }
+        }
+
+        void AppendScalar(std::string& output, const std::string& text)
+        {
+            JsonStringEscaper::AppendQuoted(output, text);
+        }
+
+        void AppendScalar(std::string& output, const EnumName& name)
+        {
+            JsonStringEscaper::AppendQuoted(output, name.Name);
+        }
+
+        void AppendScalar(std::string& output, bool flag)
+        {
+            output += flag ? "true" : "false";
+        }
+
+        /**
+         * @brief Numbers are widened the way they are into a boost::json::value by the row form, then formatted.
+         */
+        template <typename TNumber>
+        void AppendScalar(std::string& output, TNumber number)
+        {
+            if constexpr (std::is_floating_point_v<TNumber>)
+            {
+                JsonValueWriter::AppendNumber(output, static_cast<double>(number));
+            }
+            else if constexpr (std::is_signed_v<TNumber>)
+            {
+                JsonValueWriter::AppendNumber(output, static_cast<int64_t>(number));
+            }
+            else
+            {
+                JsonValueWriter::AppendNumber(output, static_cast<uint64_t>(number));
+            }
+        }
+
+        void AppendScalar(std::string& output, const SerializationValue& value)
+        {
+            bv2::visit([&](const auto& data)
+                       { AppendScalar(output, data); },
+                       value.data);
+        }
+    }
+
+    // #region Public Methods
+
+    ColumnarMetrics ColumnarMetricsConverter::ToColumns(const std::vector<TestDataMetrics>& rows)
+    {
+        // The first pass finds the keys, how many rows hold them and whether their values share a type.
+        std::map<std::string, ColumnLayout> layouts;
+
+        for (const TestDataMetrics& row : rows)
+        {
+            for (const auto& [key, value] : row.MetricData)
+            {
+                const auto [layout, inserted] = layouts.try_emplace(key, ColumnLayout{value.data.index(), 0, 0});
+
+                if (!inserted && layout->second.TypeIndex != value.data.index())
+                {
+                    layout->second.TypeIndex = MixedColumnIndex;
+                }
+
+                ++layout->second.Count;
+            }
+        }
+
+        ColumnarMetrics columns;
+        columns.RowCount = rows.size();
+        columns.Keys.reserve(layouts.size());
+        columns.Columns.reserve(layouts.size());
+
+        for (auto& [key, layout] : layouts)
+        {
+            layout.ColumnIndex = columns.Keys.size();
+            columns.Keys.push_back(key);
+
+            MetricColumn& column = columns.Columns.emplace_back();
+
+            boost::mp11::mp_with_index<ColumnTypeCount>(
+                layout.TypeIndex, [&](auto typeIndex)
+                { column.Values.template emplace<decltype(typeIndex)::value>(); });
+
+            bv2::visit([&](auto& typedValues)
+                       { typedValues.reserve(layout.Count); },
+                       column.Values);
+
+            if (layout.Count < rows.size())
+            {
+                column.Present.assign(rows.size(), false);
+            }
+        }
+
+        // The second pass fills the columns, the values of a key being appended in row order.
+        for (std::size_t rowIndex = 0; rowIndex < rows.size(); ++rowIndex)
+        {
+            for (const auto& [key, value] : rows[rowIndex].MetricData)
+            {
+                MetricColumn& column = columns.Columns[layouts.find(key)->second.ColumnIndex];
+
+                if (!column.Present.empty())
+                {
+                    column.Present[rowIndex] = true;
+                }
+
+                bv2::visit([&](auto& typedValues)
+                           {
+                               using TValue = typename std::decay_t<decltype(typedValues)>::value_type;
+
+                               if constexpr (std::is_same_v<TValue, SerializationValue>)
+                               {
+                                   typedValues.push_back(value);
+                               }
+                               else
+                               {
+                                   typedValues.push_back(bv2::get<TValue>(value.data));
+                               }
+                           },
+                           column.Values);
+            }
+        }
+
+        return columns;
+    }
+
+    std::vector<TestDataMetrics> ColumnarMetricsConverter::ToRows(const ColumnarMetrics& columns)
+    {
+        Validate(columns);
+
+        std::vector<TestDataMetrics> rows(columns.RowCount);
+
+        for (std::size_t columnIndex = 0; columnIndex < columns.Columns.size(); ++columnIndex)
+        {
+            const std::string& key = columns.Keys[columnIndex];
+            const MetricColumn& column = columns.Columns[columnIndex];
+
+            bv2::visit([&](const auto& typedValues)
+                       {
+                           std::size_t valueIndex = 0;
+
+                           for (std::size_t rowIndex = 0; rowIndex < rows.size(); ++rowIndex)
+                           {
+                               if (column.Present.empty() || column.Present[rowIndex])
+                               {
+                                   // The keys come in order, so every key is inserted at the end of its row.
+                                   std::map<std::string, SerializationValue>& metricData = rows[rowIndex].MetricData;
+                                   metricData.emplace_hint(metricData.end(), key,
+                                                           ToSerializationValue(typedValues[valueIndex++]));
+                               }
+                           }
+                       },
+                       column.Values);
+        }
+
+        return rows;
+    }
+
+    void ColumnarMetricsConverter::Write(const ColumnarMetrics& columns, std::string& output)
+    {
+        Validate(columns);
+
+        output += "{\"keys\":[";
+
+        for (std::size_t columnIndex = 0; columnIndex < columns.Keys.size(); ++columnIndex)
+        {
+            if (0 != columnIndex)
+            {
+                output.push_back(',');
+            }
+
+            JsonStringEscaper::AppendQuoted(output, columns.Keys[columnIndex]);
+        }
+
+        output += "],\"columns\":[";
+
+        for (std::size_t columnIndex = 0; columnIndex < columns.Columns.size(); ++columnIndex)
+        {
+            const MetricColumn& column = columns.Columns[columnIndex];
+
+            output += (0 != columnIndex) ? ",[" : "[";
+
+            bv2::visit([&](const auto& typedValues)
+                       {
+                           std::size_t valueIndex = 0;
+
+                           for (std::size_t rowIndex = 0; rowIndex < columns.RowCount; ++rowIndex)
+                           {
+                               if (0 != rowIndex)
+                               {
+                                   output.push_back(',');
+                               }
+
+                               if (column.Present.empty() || column.Present[rowIndex])
+                               {
+                                   AppendScalar(output, typedValues[valueIndex++]);
+                               }
+                               else
+                               {
+                                   output += "null";
+                               }
+                           }
+                       },
+                       column.Values);
+
+            output.push_back(']');
+        }
+
+        output += "]}";
+    }
+
+    std::string ColumnarMetricsConverter::Write(const ColumnarMetrics& columns)
+    {
+        std::string output;
+        Write(columns, output);
+
+        return output;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void ColumnarMetricsConverter::Validate(const ColumnarMetrics& columns)
+    {
+        if (columns.Keys.size() != columns.Columns.size())
+        {
+            throw XInvalidArgument("The columnar metrics must have one column per key!");
+        }
+
+        for (std::size_t columnIndex = 0; columnIndex < columns.Columns.size(); ++columnIndex)
+        {
+            const MetricColumn& column = columns.Columns[columnIndex];
+
+            if (!column.Present.empty() && column.Present.size() != columns.RowCount)
+            {
+                throw XInvalidArgument("The presence of the metric '" + columns.Keys[columnIndex] +
+                                       "' must be given for every row!");
+            }
+
+            const std::size_t expectedCount =
+                column.Present.empty()
+                    ? columns.RowCount
+                    : static_cast<std::size_t>(std::count(column.Present.begin(), column.Present.end(), true));
+
+            if (GetValueCount(column.Values) != expectedCount)
+            {
+                throw XInvalidArgument("The column of the metric '" + columns.Keys[columnIndex] +
+                                       "' does not hold one value per row holding the key!");
+            }
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
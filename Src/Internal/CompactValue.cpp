@@ -0,0 +1,381 @@
+/*************************************************************************************************
+ * @file CompactValue.cpp
+ *
+ * @brief Concrete implementation of @ref CompactValue class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/CompactValue.hpp"
+
+#include <limits>
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    namespace bv2 = boost::variant2;
+
+    namespace
+    {
+        /**
+         * @brief Offset of the 32 bits size of a text stored out of the value, it follows the pointer.
+         */
+        constexpr std::size_t TextSizeOffset = sizeof(const char*);
+
+        /**
+         * @brief Get the size of a text as stored in a value.
+         *
+         * @throw XInvalidArgument If the text is too long to be stored.
+         */
+        std::uint32_t ToTextSize(std::string_view text)
+        {
+            if (text.size() > std::numeric_limits<std::uint32_t>::max())
+            {
+                throw XInvalidArgument("A compact value cannot hold a string longer than 4 GiB!");
+            }
+
+            return static_cast<std::uint32_t>(text.size());
+        }
+    }
+
+    // #region Construction/Destruction
+
+    CompactValue::CompactValue() noexcept
+        : _payload(),
+          _length(0),
+          _kind(Kind::String)
+    {
+    }
+
+    CompactValue::CompactValue(std::string_view text)
+        : CompactValue()
+    {
+        AssignString(text);
+    }
+
+    CompactValue::CompactValue(const std::string& text)
+        : CompactValue(std::string_view(text))
+    {
+    }
+
+    CompactValue::CompactValue(const char* text)
+        : CompactValue(std::string_view(text))
+    {
+    }
+
+    CompactValue::CompactValue(EnumName name) noexcept
+        : CompactValue()
+    {
+        // The name refers to the static table of its enum, only the view is kept.
+        StoreText(Kind::EnumName, name.Name.data(), static_cast<std::uint32_t>(name.Name.size()));
+    }
+
+    CompactValue::CompactValue(bool value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(float value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(double value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(int8_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(int16_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(int32_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(int64_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(uint8_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(uint16_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(uint32_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(uint64_t value) noexcept
+        : CompactValue()
+    {
+        Store(value);
+    }
+
+    CompactValue::CompactValue(const SerializationValue& value)
+        : CompactValue()
+    {
+        bv2::visit([this](const auto& data)
+                   { *this = CompactValue(data); },
+                   value.data);
+    }
+
+    CompactValue::CompactValue(const DeserializationValue& value)
+        : CompactValue()
+    {
+        bv2::visit([this](const auto& data)
+                   { *this = CompactValue(data); },
+                   value.data);
+    }
+
+    CompactValue::CompactValue(const CompactValue& other)
+        : CompactValue()
+    {
+        if (Kind::String == other._kind && LongStringLength == other._length)
+        {
+            AssignString(other.GetText());
+        }
+        else
+        {
+            std::memcpy(_payload, other._payload, sizeof(_payload));
+            _length = other._length;
+            _kind = other._kind;
+        }
+    }
+
+    CompactValue::CompactValue(CompactValue&& other) noexcept
+        : CompactValue()
+    {
+        MoveFrom(other);
+    }
+
+    CompactValue::~CompactValue()
+    {
+        Release();
+    }
+
+    CompactValue& CompactValue::operator=(const CompactValue& other)
+    {
+        if (this != &other)
+        {
+            CompactValue copy(other);
+            MoveFrom(copy);
+        }
+
+        return *this;
+    }
+
+    CompactValue& CompactValue::operator=(CompactValue&& other) noexcept
+    {
+        if (this != &other)
+        {
+            MoveFrom(other);
+        }
+
+        return *this;
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    std::string_view CompactValue::GetString() const
+    {
+        if (Kind::String != _kind && Kind::EnumName != _kind)
+        {
+            throw XInvalidArgument("The compact value does not hold a string!");
+        }
+
+        return GetText();
+    }
+
+    std::size_t CompactValue::GetOutOfLineBytes() const noexcept
+    {
+        return (Kind::String == _kind && LongStringLength == _length) ? GetText().size() : 0;
+    }
+
+    SerializationValue CompactValue::ToSerializationValue() const
+    {
+        return Visit([](auto value)
+                     {
+                         using TValue = decltype(value);
+
+                         if constexpr (std::is_same_v<TValue, std::string_view>)
+                         {
+                             return SerializationValue{std::string(value)};
+                         }
+                         else if constexpr (std::is_same_v<TValue, double>)
+                         {
+                             return SerializationValue{static_cast<float>(value)};
+                         }
+                         else
+                         {
+                             return SerializationValue{value};
+                         }
+                     });
+    }
+
+    DeserializationValue CompactValue::ToDeserializationValue() const
+    {
+        return Visit([](auto value)
+                     {
+                         using TValue = decltype(value);
+
+                         if constexpr (std::is_same_v<TValue, std::string_view>)
+                         {
+                             return DeserializationValue{std::string(value)};
+                         }
+                         else if constexpr (std::is_same_v<TValue, EnumName>)
+                         {
+                             return DeserializationValue{std::string(value.Name)};
+                         }
+                         else if constexpr (std::is_same_v<TValue, bool>)
+                         {
+                             return DeserializationValue{value};
+                         }
+                         else if constexpr (std::is_floating_point_v<TValue>)
+                         {
+                             return DeserializationValue{static_cast<double>(value)};
+                         }
+                         else if constexpr (std::is_signed_v<TValue>)
+                         {
+                             return DeserializationValue{static_cast<int64_t>(value)};
+                         }
+                         else
+                         {
+                             return DeserializationValue{static_cast<uint64_t>(value)};
+                         }
+                     });
+    }
+
+    bool CompactValue::operator==(const CompactValue& other) const
+    {
+        if (_kind != other._kind)
+        {
+            return false;
+        }
+
+        if (Kind::String == _kind || Kind::EnumName == _kind)
+        {
+            return GetText() == other.GetText();
+        }
+
+        return Visit([&](auto value)
+                     {
+                         if constexpr (std::is_arithmetic_v<decltype(value)>)
+                         {
+                             return value == other.Load<decltype(value)>();
+                         }
+                         else
+                         {
+                             return false;
+                         }
+                     });
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    std::string_view CompactValue::GetText() const noexcept
+    {
+        if (LongStringLength != _length)
+        {
+            return std::string_view(reinterpret_cast<const char*>(_payload), _length);
+        }
+
+        const char* data = nullptr;
+        std::uint32_t size = 0;
+
+        std::memcpy(&data, _payload, sizeof(data));
+        std::memcpy(&size, _payload + TextSizeOffset, sizeof(size));
+
+        return std::string_view(data, size);
+    }
+
+    void CompactValue::StoreText(Kind kind, const char* data, std::uint32_t size) noexcept
+    {
+        _kind = kind;
+        _length = LongStringLength;
+
+        std::memcpy(_payload, &data, sizeof(data));
+        std::memcpy(_payload + TextSizeOffset, &size, sizeof(size));
+    }
+
+    void CompactValue::AssignString(std::string_view text)
+    {
+        const std::uint32_t size = ToTextSize(text);
+
+        Release();
+
+        if (size <= MaxInlineStringLength)
+        {
+            _kind = Kind::String;
+            _length = static_cast<std::uint8_t>(size);
+            std::memcpy(_payload, text.data(), size);
+            return;
+        }
+
+        char* buffer = new char[size];
+        std::memcpy(buffer, text.data(), size);
+
+        StoreText(Kind::String, buffer, size);
+    }
+
+    void CompactValue::MoveFrom(CompactValue& other) noexcept
+    {
+        Release();
+
+        std::memcpy(_payload, other._payload, sizeof(_payload));
+        _length = other._length;
+        _kind = other._kind;
+
+        // The buffer of a long string now belongs to this value.
+        other._kind = Kind::String;
+        other._length = 0;
+    }
+
+    void CompactValue::Release() noexcept
+    {
+        if (Kind::String == _kind && LongStringLength == _length)
+        {
+            delete[] GetText().data();
+        }
+
+        _kind = Kind::String;
+        _length = 0;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
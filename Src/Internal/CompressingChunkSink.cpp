@@ -0,0 +1,399 @@
+/*************************************************************************************************
+ * @file CompressingChunkSink.cpp
+ *
+ * @brief Concrete implementation of @ref CompressingChunkSink class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/CompressingChunkSink.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#define ZLIB_CONST
+#include <zlib.h>
+
+#ifdef BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD
+    #include <zstd.h>
+#endif
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidArgument.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Compressors
+
+    /**
+     * @brief Incremental compressor of a single gzip member or zstd frame.
+     */
+    class StreamCompressor
+    {
+    public:
+        virtual ~StreamCompressor() = default;
+
+        /**
+         * @brief Compress the input and append what the stream releases to the output.
+         *
+         * @param[in] input The next bytes of the stream.
+         * @param[in] finish Whether the stream ends with them.
+         * @param[in,out] output The string to be appended.
+         */
+        virtual void Compress(std::string_view input, bool finish, std::string& output) = 0;
+
+        /**
+         * @brief Create the compression stream of a format.
+         *
+         * @throw XInvalidArgument If the format is not available or the level is out of its range.
+         */
+        static std::unique_ptr<StreamCompressor> Create(CompressionFormat format, int level);
+    };
+
+    namespace
+    {
+        /**
+         * @brief Size by which the compressed output grows while a compressor runs.
+         */
+        constexpr std::size_t OutputStep = 16 * 1024;
+
+        /**
+         * @brief Gzip stream of zlib, its members are a complete gzip file each.
+         */
+        class GzipCompressor : public StreamCompressor
+        {
+        public:
+            explicit GzipCompressor(int level)
+                : _stream()
+            {
+                if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION)
+                {
+                    throw XInvalidArgument("The gzip compression level must be within -1 and 9!");
+                }
+
+                // 16 added to the window bits selects the gzip wrapper.
+                if (Z_OK != deflateInit2(&_stream, level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY))
+                {
+                    throw XSerialization("Cannot initialize the gzip compression!");
+                }
+            }
+
+            virtual ~GzipCompressor() override
+            {
+                deflateEnd(&_stream);
+            }
+
+            virtual void Compress(std::string_view input, bool finish, std::string& output) override
+            {
+                // The sizes of zlib are 32 bits wide, larger inputs go through in several steps.
+                do
+                {
+                    const std::size_t stepSize = std::min<std::size_t>(input.size(), std::numeric_limits<uInt>::max());
+                    const bool lastStep = (stepSize == input.size());
+                    const int flush = (finish && lastStep) ? Z_FINISH : Z_NO_FLUSH;
+
+                    _stream.next_in = reinterpret_cast<const Bytef*>(input.data());
+                    _stream.avail_in = static_cast<uInt>(stepSize);
+
+                    int result = Z_OK;
+
+                    do
+                    {
+                        const std::size_t offset = output.size();
+                        output.resize(offset + OutputStep);
+
+                        _stream.next_out = reinterpret_cast<Bytef*>(&output[offset]);
+                        _stream.avail_out = static_cast<uInt>(OutputStep);
+
+                        result = deflate(&_stream, flush);
+                        output.resize(offset + OutputStep - _stream.avail_out);
+
+                        if (Z_STREAM_ERROR == result)
+                        {
+                            throw XSerialization("The gzip compression failed!");
+                        }
+                    } while (0 == _stream.avail_out || (Z_FINISH == flush && Z_STREAM_END != result));
+
+                    input.remove_prefix(stepSize);
+                } while (!input.empty());
+            }
+
+        private:
+            DECLARE_NON_COPYABLE_CLASS(GzipCompressor)
+
+            z_stream _stream;
+        };
+
+#ifdef BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD
+        /**
+         * @brief Zstd stream, its frames are a complete zstd file each.
+         */
+        class ZstdCompressor : public StreamCompressor
+        {
+        public:
+            explicit ZstdCompressor(int level)
+                : _context(ZSTD_createCCtx())
+            {
+                if (nullptr == _context)
+                {
+                    throw XSerialization("Cannot initialize the zstd compression!");
+                }
+
+                if (-1 == level)
+                {
+                    level = ZSTD_CLEVEL_DEFAULT;
+                }
+
+                if (level < ZSTD_minCLevel() || level > ZSTD_maxCLevel() ||
+                    ZSTD_isError(ZSTD_CCtx_setParameter(_context, ZSTD_c_compressionLevel, level)))
+                {
+                    ZSTD_freeCCtx(_context);
+                    throw XInvalidArgument("The zstd compression level must be within " +
+                                           std::to_string(ZSTD_minCLevel()) + " and " +
+                                           std::to_string(ZSTD_maxCLevel()) + "!");
+                }
+            }
+
+            virtual ~ZstdCompressor() override
+            {
+                ZSTD_freeCCtx(_context);
+            }
+
+            virtual void Compress(std::string_view input, bool finish, std::string& output) override
+            {
+                ZSTD_inBuffer inBuffer = {input.data(), input.size(), 0};
+                const ZSTD_EndDirective directive = finish ? ZSTD_e_end : ZSTD_e_continue;
+                std::size_t remaining = 0;
+
+                do
+                {
+                    const std::size_t offset = output.size();
+                    output.resize(offset + OutputStep);
+
+                    ZSTD_outBuffer outBuffer = {&output[offset], OutputStep, 0};
+                    remaining = ZSTD_compressStream2(_context, &outBuffer, &inBuffer, directive);
+                    output.resize(offset + outBuffer.pos);
+
+                    if (ZSTD_isError(remaining))
+                    {
+                        throw XSerialization(std::string("The zstd compression failed: ") +
+                                             ZSTD_getErrorName(remaining));
+                    }
+                } while (inBuffer.pos < inBuffer.size || (finish && 0 != remaining));
+            }
+
+        private:
+            DECLARE_NON_COPYABLE_CLASS(ZstdCompressor)
+
+            ZSTD_CCtx* _context;
+        };
+#endif
+    }
+
+    std::unique_ptr<StreamCompressor> StreamCompressor::Create(CompressionFormat format, int level)
+    {
+        switch (format)
+        {
+        case CompressionFormat::Gzip:
+            return std::make_unique<GzipCompressor>(level);
+#ifdef BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD
+        case CompressionFormat::Zstd:
+            return std::make_unique<ZstdCompressor>(level);
+#else
+        case CompressionFormat::Zstd:
+            throw XInvalidArgument("The zstd compression is not available, it needs "
+                                   "BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD!");
+#endif
+        default:
+            throw XInvalidArgument("Unknown compression format!");
+        }
+    }
+
+    // #endregion
+
+    // #region Construction/Destruction
+
+    CompressingChunkSink::CompressingChunkSink(std::shared_ptr<IChunkSink> output,
+                                               const CompressionOptions& options,
+                                               std::shared_ptr<IExecutor> executor)
+        : _output(std::move(output)),
+          _options(options),
+          _executor(std::move(executor))
+    {
+        if (nullptr == _output)
+        {
+            throw XArgumentNull("CompressingChunkSink::output");
+        }
+
+        if (0 == _options.MaxBlocksInFlight)
+        {
+            throw XInvalidArgument("At least one block must be in flight!");
+        }
+
+        // Also validates the format and the level in block mode, before any block is compressed.
+        _compressor = StreamCompressor::Create(_options.Format, _options.Level);
+
+        if (0 != _options.BlockSize)
+        {
+            _compressor.reset();
+            _block.reserve(_options.BlockSize);
+        }
+    }
+
+    CompressingChunkSink::~CompressingChunkSink() = default;
+
+    // #endregion
+
+    // #region Public Methods
+
+    void CompressingChunkSink::Write(std::string_view chunk)
+    {
+        if (_finished)
+        {
+            throw XInvalidArgument("The compressing sink is already finished!");
+        }
+
+        if (nullptr != _compressor)
+        {
+            _compressed.clear();
+            _compressor->Compress(chunk, false, _compressed);
+
+            if (!_compressed.empty())
+            {
+                _output->Write(_compressed);
+            }
+
+            return;
+        }
+
+        while (!chunk.empty())
+        {
+            const std::size_t size = std::min(chunk.size(), _options.BlockSize - _block.size());
+            _block.append(chunk.data(), size);
+            chunk.remove_prefix(size);
+
+            if (_block.size() == _options.BlockSize)
+            {
+                SubmitBlock();
+            }
+        }
+    }
+
+    void CompressingChunkSink::Finish()
+    {
+        if (_finished)
+        {
+            return;
+        }
+
+        _finished = true;
+
+        if (nullptr != _compressor)
+        {
+            _compressed.clear();
+            _compressor->Compress(std::string_view(), true, _compressed);
+            _output->Write(_compressed);
+        }
+        else
+        {
+            // An empty output still needs one block to be a valid stream.
+            if (!_block.empty() || 0 == _blockCount)
+            {
+                SubmitBlock();
+            }
+
+            DrainBlocks(false);
+        }
+
+        _output->Finish();
+    }
+
+    bool CompressingChunkSink::IsAvailable(CompressionFormat format)
+    {
+        switch (format)
+        {
+        case CompressionFormat::Gzip:
+            return true;
+        case CompressionFormat::Zstd:
+#ifdef BOOST_AUTO_JSON_SERIALIZER_WITH_ZSTD
+            return true;
+#else
+            return false;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    std::string CompressingChunkSink::Compress(CompressionFormat format, int level, std::string_view input)
+    {
+        std::string output;
+        StreamCompressor::Create(format, level)->Compress(input, true, output);
+
+        return output;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void CompressingChunkSink::SubmitBlock()
+    {
+        ++_blockCount;
+
+        if (nullptr == _executor)
+        {
+            _output->Write(Compress(_options.Format, _options.Level, _block));
+            _block.clear();
+            return;
+        }
+
+        if (_pendingBlocks.size() >= _options.MaxBlocksInFlight)
+        {
+            // Bounds the memory held by the blocks, the oldest one is the next to be forwarded anyway.
+            _output->Write(_pendingBlocks.front().get());
+            _pendingBlocks.pop_front();
+        }
+
+        auto task = std::make_shared<std::packaged_task<std::string()>>(
+            [format = _options.Format, level = _options.Level, block = std::move(_block)]()
+            { return Compress(format, level, block); });
+
+        _pendingBlocks.push_back(task->get_future());
+        _executor->Post([task]()
+                        { (*task)(); });
+
+        _block = std::string();
+        _block.reserve(_options.BlockSize);
+
+        DrainBlocks(true);
+    }
+
+    void CompressingChunkSink::DrainBlocks(bool readyOnly)
+    {
+        while (!_pendingBlocks.empty())
+        {
+            std::future<std::string>& block = _pendingBlocks.front();
+
+            if (readyOnly && std::future_status::ready != block.wait_for(std::chrono::seconds(0)))
+            {
+                return;
+            }
+
+            _output->Write(block.get());
+            _pendingBlocks.pop_front();
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,90 @@
+/*************************************************************************************************
+ * @file ContentHash.cpp
+ *
+ * @brief Concrete implementation of @ref ContentHash class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/ContentHash.hpp"
+
+#include <cstring>
+
+namespace
+{
+    constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t Prime3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+
+    inline uint64_t RotateLeft(uint64_t value, unsigned bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    /**
+     * @brief Read 8 bytes, the byte order of the machine is fine since the digests never leave the process.
+     */
+    inline uint64_t ReadWord(const char* data)
+    {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        return word;
+    }
+
+    /**
+     * @brief Spread every bit of a lane over the whole word.
+     */
+    inline uint64_t Avalanche(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    inline uint64_t Round(uint64_t lane, uint64_t word, uint64_t multiplier, unsigned rotation)
+    {
+        return RotateLeft(lane ^ (word * multiplier), rotation) * Prime1;
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Public Methods
+
+    ContentDigest ContentHash::Compute(std::string_view data)
+    {
+        const uint64_t size = data.size();
+        const char* position = data.data();
+        const char* const end = position + data.size();
+
+        uint64_t low = Prime3 ^ size;
+        uint64_t high = Prime4 ^ (size * Prime2);
+
+        for (; end - position >= 16; position += 16)
+        {
+            low = Round(low, ReadWord(position), Prime2, 31);
+            high = Round(high, ReadWord(position + 8), Prime4, 29);
+        }
+
+        // The tail is zero padded, the size folded into the lanes tells the paddings apart.
+        char tail[16] = {};
+        std::memcpy(tail, position, static_cast<std::size_t>(end - position));
+
+        low = Round(low, ReadWord(tail), Prime2, 31);
+        high = Round(high, ReadWord(tail + 8), Prime4, 29);
+
+        // Cross the lanes so that every byte affects both halves of the digest.
+        low = Avalanche(low + RotateLeft(high, 17));
+        high = Avalanche(high ^ low);
+
+        return ContentDigest{low, high};
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
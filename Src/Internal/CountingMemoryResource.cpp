@@ -0,0 +1,74 @@
+/*************************************************************************************************
+ * @file CountingMemoryResource.cpp
+ *
+ * @brief Concrete implementation of @ref CountingMemoryResource class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/CountingMemoryResource.hpp"
+
+#include <algorithm>
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    CountingMemoryResource::CountingMemoryResource(boost::json::storage_ptr upstream)
+        : _upstream(std::move(upstream)),
+          _statistics(),
+          _liveBytes(0)
+    {
+    }
+
+    CountingMemoryResource::~CountingMemoryResource() = default;
+
+    // #endregion
+
+    // #region Public Methods
+
+    AllocationStatistics CountingMemoryResource::GetStatistics() const
+    {
+        return _statistics;
+    }
+
+    void CountingMemoryResource::Reset()
+    {
+        _statistics = AllocationStatistics();
+        _statistics.PeakBytes = _liveBytes;
+    }
+
+    // #endregion
+
+    // #region memory_resource Implementation
+
+    void* CountingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        void* pointer = _upstream->allocate(bytes, alignment);
+
+        // Counted once the upstream succeeded, a failed request allocates nothing.
+        ++_statistics.Allocations;
+        _statistics.AllocatedBytes += bytes;
+        _liveBytes += bytes;
+        _statistics.PeakBytes = std::max(_statistics.PeakBytes, _liveBytes);
+
+        return pointer;
+    }
+
+    void CountingMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+    {
+        _upstream->deallocate(pointer, bytes, alignment);
+
+        ++_statistics.Deallocations;
+        _liveBytes -= std::min<uint64_t>(_liveBytes, bytes);
+    }
+
+    bool CountingMemoryResource::do_is_equal(const boost::json::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
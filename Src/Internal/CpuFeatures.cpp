@@ -0,0 +1,59 @@
+/*************************************************************************************************
+ * @file CpuFeatures.cpp
+ *
+ * @brief Concrete implementation of @ref CpuFeatures class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/CpuFeatures.hpp"
+
+namespace
+{
+    /**
+     * @brief Query the CPU for the best supported instruction set level.
+     *
+     * @return The detected level.
+     */
+    BOOST_AUTO_JSON_SERIALIZER_NS::Internal::SimdLevel DetectBestSimdLevel()
+    {
+        using BOOST_AUTO_JSON_SERIALIZER_NS::Internal::SimdLevel;
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SimdLevel::Avx2;
+        }
+
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return SimdLevel::Sse2;
+        }
+#endif
+
+        return SimdLevel::Scalar;
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Public Methods
+
+    SimdLevel CpuFeatures::GetBestSimdLevel()
+    {
+        static const SimdLevel BestSimdLevel = DetectBestSimdLevel();
+
+        return BestSimdLevel;
+    }
+
+    bool CpuFeatures::IsSupported(SimdLevel level)
+    {
+        return static_cast<int>(level) <= static_cast<int>(GetBestSimdLevel());
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
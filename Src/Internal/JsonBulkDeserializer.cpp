@@ -0,0 +1,188 @@
+/*************************************************************************************************
+ * @file JsonBulkDeserializer.cpp
+ *
+ * @brief Concrete implementation of @ref JsonBulkDeserializer class.
+ *
+ * To de-serialize the documents of a multi-document stream in parallel while keeping their order.
+ *
+ *************************************************************************************************/
+
+#include "Internal/JsonBulkDeserializer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "Internal/JsonDocumentSplitter.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief State of one bulk call shared by the calling thread and the pool workers.
+     *
+     * The workers claim documents through @ref NextIndex. Once every document is claimed the referenced inputs
+     * are never touched again, so late workers are harmless even after the call returned.
+     */
+    struct BulkBatch
+    {
+        std::atomic<std::size_t> NextIndex{0};
+        std::size_t Count = 0;
+
+        const std::string* Stream = nullptr;
+        const std::vector<JsonDocumentSpan>* Spans = nullptr;
+        std::vector<TestDataPolicyRecord>* Records = nullptr;
+        IJsonDataSerializer* Serializer = nullptr;
+
+        std::mutex Mutex;
+        std::condition_variable Finished;
+        std::size_t ActiveWorkers = 0;
+
+        /**
+         * @brief First unexpected failure, it is re-thrown on the calling thread.
+         */
+        std::exception_ptr Failure;
+    };
+
+    /**
+     * @brief Claim and de-serialize documents until none is left.
+     *
+     * @param[in,out] batch The shared batch state.
+     */
+    void DrainBatch(BulkBatch& batch)
+    {
+        const std::size_t count = batch.Count;
+
+        for (std::size_t index = batch.NextIndex.fetch_add(1); index < count; index = batch.NextIndex.fetch_add(1))
+        {
+            const JsonDocumentSpan& span = (*batch.Spans)[index];
+            TestDataPolicyRecord& record = (*batch.Records)[index];
+
+            record.LineNumber = span.LineNumber;
+
+            try
+            {
+                record.Policy = batch.Serializer->Deserialize(batch.Stream->substr(span.Offset, span.Length));
+                record.IsValid = true;
+            }
+            catch (const XSerialization& ex)
+            {
+                record.ErrorMessage = ex.what();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(batch.Mutex);
+
+                if (nullptr == batch.Failure)
+                {
+                    batch.Failure = std::current_exception();
+                }
+
+                // Nothing else will be reported, stop handing out documents.
+                batch.NextIndex.store(count);
+            }
+        }
+    }
+
+    /**
+     * @brief Entry point of a pool worker taking part in a batch.
+     *
+     * @param[in] batch The shared batch state.
+     */
+    void RunBatchWorker(const std::shared_ptr<BulkBatch>& batch)
+    {
+        {
+            std::lock_guard<std::mutex> lock(batch->Mutex);
+            ++batch->ActiveWorkers;
+        }
+
+        DrainBatch(*batch);
+
+        {
+            std::lock_guard<std::mutex> lock(batch->Mutex);
+            --batch->ActiveWorkers;
+        }
+
+        batch->Finished.notify_all();
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    JsonBulkDeserializer::JsonBulkDeserializer(std::shared_ptr<IJsonDataSerializer> serializer,
+                                               std::shared_ptr<ThreadPool> threadPool)
+        : _serializer(serializer),
+          _threadPool(threadPool)
+    {
+        if (nullptr == _serializer)
+        {
+            throw XArgumentNull("JsonBulkDeserializer::serializer");
+        }
+
+        if (nullptr == _threadPool)
+        {
+            throw XArgumentNull("JsonBulkDeserializer::threadPool");
+        }
+    }
+
+    JsonBulkDeserializer::~JsonBulkDeserializer() = default;
+
+    // #endregion
+
+    // #region Public Methods
+
+    std::vector<TestDataPolicyRecord> JsonBulkDeserializer::DeserializeAll(const std::string& stream,
+                                                                           JsonStreamFraming framing)
+    {
+        const std::vector<JsonDocumentSpan> spans = JsonDocumentSplitter::Split(stream, framing);
+
+        std::vector<TestDataPolicyRecord> records(spans.size());
+
+        std::shared_ptr<BulkBatch> batch = std::make_shared<BulkBatch>();
+        batch->Count = spans.size();
+        batch->Stream = &stream;
+        batch->Spans = &spans;
+        batch->Records = &records;
+        batch->Serializer = _serializer.get();
+
+        // The calling thread is a worker too, hence one helper less than documents.
+        const std::size_t helperCount = std::min(_threadPool->GetThreadCount(), spans.size() > 0 ? spans.size() - 1 : 0);
+
+        for (std::size_t index = 0; index < helperCount; ++index)
+        {
+            _threadPool->Post([batch]
+                              { RunBatchWorker(batch); });
+        }
+
+        DrainBatch(*batch);
+
+        std::unique_lock<std::mutex> lock(batch->Mutex);
+        batch->Finished.wait(lock, [&batch]
+                             { return 0 == batch->ActiveWorkers; });
+
+        if (nullptr != batch->Failure)
+        {
+            std::rethrow_exception(batch->Failure);
+        }
+
+        return records;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
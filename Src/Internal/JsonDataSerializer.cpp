@@ -18,13 +18,53 @@ using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
 
 // #endregion
 
+namespace
+{
+    /**
+     * @brief Forwards the chunks to another sink, counting their bytes.
+     */
+    class CountingChunkSink : public IChunkSink
+    {
+    public:
+        explicit CountingChunkSink(IChunkSink& sink)
+            : _sink(sink),
+              _byteCount(0)
+        {
+        }
+
+        virtual void Write(std::string_view chunk) override
+        {
+            _sink.Write(chunk);
+            _byteCount += chunk.size();
+        }
+
+        virtual void Finish() override
+        {
+            _sink.Finish();
+        }
+
+        std::size_t GetByteCount() const
+        {
+            return _byteCount;
+        }
+
+    private:
+        DECLARE_NON_COPYABLE_CLASS(CountingChunkSink)
+
+        IChunkSink& _sink;
+
+        std::size_t _byteCount;
+    };
+}
+
 BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
 namespace Internal
 {
     // #region Construction/Destruction
 
     JsonDataSerializer::JsonDataSerializer(std::shared_ptr<IJsonDataSerializerImpl> impl)
-        : _impl(impl)
+        : _impl(impl),
+          _counters(std::make_shared<PerformanceCounters>(std::vector<std::string>{"Deserialize", "Serialize"}))
     {
         if (nullptr == _impl)
         {
@@ -32,6 +72,18 @@ namespace Internal
         }
     }
 
+    JsonDataSerializer::JsonDataSerializer(std::shared_ptr<IJsonDataSerializerImpl> impl,
+                                           std::shared_ptr<IExecutor> executor)
+        : JsonDataSerializer(impl)
+    {
+        if (nullptr == executor)
+        {
+            throw XArgumentNull("JsonDataSerializer::executor");
+        }
+
+        _executor = executor;
+    }
+
     JsonDataSerializer::~JsonDataSerializer() = default;
 
     // #endregion
@@ -40,12 +92,140 @@ namespace Internal
 
     TestDataTestPolicy JsonDataSerializer::Deserialize(const std::string& payload)
     {
-        return _impl->Deserialize(payload);
+        return CountedDeserialize(*_impl, *_counters, payload);
+    }
+
+    void JsonDataSerializer::Deserialize(const std::string& payload, TestDataTestPolicy& policy)
+    {
+        Measured(*_counters, DeserializeOperation, payload.size(),
+                 [&](uint64_t&)
+                 { _impl->Deserialize(payload, policy); });
+    }
+
+    PmrTestDataTestPolicy JsonDataSerializer::Deserialize(const std::string& payload,
+                                                          std::pmr::memory_resource* resource)
+    {
+        return Measured(*_counters, DeserializeOperation, payload.size(),
+                        [&](uint64_t&)
+                        { return _impl->Deserialize(payload, resource); });
     }
 
     std::string JsonDataSerializer::Serialize(const TestDataTestResults& entity)
     {
-        return _impl->Serialize(entity);
+        return CountedSerialize(*_impl, *_counters, entity);
+    }
+
+    void JsonDataSerializer::Serialize(const TestDataTestResults& entity, IChunkSink& sink)
+    {
+        Measured(*_counters, SerializeOperation, 0,
+                 [&](uint64_t& bytesOut)
+                 {
+                     CountingChunkSink countingSink(sink);
+                     _impl->Serialize(entity, countingSink);
+
+                     bytesOut = countingSink.GetByteCount();
+                 });
+    }
+
+    std::size_t JsonDataSerializer::GetSerializedSize(const TestDataTestResults& entity)
+    {
+        return _impl->GetSerializedSize(entity);
+    }
+
+    std::future<TestDataTestPolicy> JsonDataSerializer::DeserializeAsync(std::string&& payload)
+    {
+        return RunOnExecutor<TestDataTestPolicy>([impl = _impl, counters = _counters, payload = std::move(payload)]()
+                                                 { return CountedDeserialize(*impl, *counters, payload); });
+    }
+
+    std::future<std::string> JsonDataSerializer::SerializeAsync(TestDataTestResults&& entity)
+    {
+        return RunOnExecutor<std::string>([impl = _impl, counters = _counters, entity = std::move(entity)]()
+                                          { return CountedSerialize(*impl, *counters, entity); });
+    }
+
+    PerformanceSnapshot JsonDataSerializer::GetPerformanceSnapshot() const
+    {
+        return _counters->GetSnapshot();
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    TestDataTestPolicy JsonDataSerializer::CountedDeserialize(IJsonDataSerializerImpl& impl,
+                                                              PerformanceCounters& counters,
+                                                              const std::string& payload)
+    {
+        return Measured(counters, DeserializeOperation, payload.size(),
+                        [&](uint64_t&)
+                        { return impl.Deserialize(payload); });
+    }
+
+    std::string JsonDataSerializer::CountedSerialize(IJsonDataSerializerImpl& impl,
+                                                     PerformanceCounters& counters,
+                                                     const TestDataTestResults& entity)
+    {
+        return Measured(counters, SerializeOperation, 0,
+                        [&](uint64_t& bytesOut)
+                        {
+                            std::string resultPayload = impl.Serialize(entity);
+                            bytesOut = resultPayload.size();
+
+                            return resultPayload;
+                        });
+    }
+
+    template <typename TCall>
+    auto JsonDataSerializer::Measured(PerformanceCounters& counters, CountedOperation operation, uint64_t bytesIn,
+                                      TCall&& call) -> std::invoke_result_t<TCall&, uint64_t&>
+    {
+        const PerformanceCounters::Clock::time_point start = PerformanceCounters::Clock::now();
+        uint64_t bytesOut = 0;
+
+        try
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<TCall&, uint64_t&>>)
+            {
+                call(bytesOut);
+
+                counters.RecordSuccess(operation, start, bytesIn, bytesOut);
+            }
+            else
+            {
+                auto result = call(bytesOut);
+
+                counters.RecordSuccess(operation, start, bytesIn, bytesOut);
+
+                return result;
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            counters.RecordFailure(operation, start, bytesIn, ex);
+            throw;
+        }
+    }
+
+    template <typename TResult, typename TOperation>
+    std::future<TResult> JsonDataSerializer::RunOnExecutor(TOperation&& operation)
+    {
+        // Shared so that the task fits in a copyable std::function, the operation itself is only moved.
+        auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<TOperation>(operation));
+
+        std::future<TResult> result = task->get_future();
+
+        if (nullptr == _executor)
+        {
+            (*task)();
+        }
+        else
+        {
+            _executor->Post([task]()
+                            { (*task)(); });
+        }
+
+        return result;
     }
 
     // #endregion
@@ -24,7 +24,8 @@ namespace Internal
     // #region Construction/Destruction
 
     JsonDataValidator::JsonDataValidator(std::shared_ptr<IJsonDataValidatorImpl> impl)
-        : _impl(impl)
+        : _impl(impl),
+          _counters({"Validate"})
     {
         if (nullptr == _impl)
         {
@@ -40,7 +41,24 @@ namespace Internal
 
     void JsonDataValidator::Validate(const std::string& payload)
     {
-        _impl->Validate(payload);
+        const PerformanceCounters::Clock::time_point start = PerformanceCounters::Clock::now();
+
+        try
+        {
+            _impl->Validate(payload);
+        }
+        catch (const std::exception& ex)
+        {
+            _counters.RecordFailure(0, start, payload.size(), ex);
+            throw;
+        }
+
+        _counters.RecordSuccess(0, start, payload.size(), 0);
+    }
+
+    PerformanceSnapshot JsonDataValidator::GetPerformanceSnapshot() const
+    {
+        return _counters.GetSnapshot();
     }
 
     // #endregion
@@ -0,0 +1,224 @@
+/*************************************************************************************************
+ * @file JsonDocumentSplitter.cpp
+ *
+ * @brief Concrete implementation of @ref JsonDocumentSplitter class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/JsonDocumentSplitter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    /**
+     * @brief Classes of the bytes the scanner has to react on.
+     */
+    enum ByteClass : uint8_t
+    {
+        Other = 0,
+        Blank,
+        NewLine,
+        Open,
+        Close,
+        Quote,
+        Backslash
+    };
+
+    /**
+     * @brief Build the byte classification table at compile time.
+     *
+     * @return Class of every possible byte value.
+     */
+    constexpr std::array<uint8_t, 256> MakeByteClassTable()
+    {
+        std::array<uint8_t, 256> table{};
+
+        table[static_cast<unsigned char>(' ')] = Blank;
+        table[static_cast<unsigned char>('\t')] = Blank;
+        table[static_cast<unsigned char>('\r')] = Blank;
+        table[static_cast<unsigned char>('\n')] = NewLine;
+        table[static_cast<unsigned char>('{')] = Open;
+        table[static_cast<unsigned char>('[')] = Open;
+        table[static_cast<unsigned char>('}')] = Close;
+        table[static_cast<unsigned char>(']')] = Close;
+        table[static_cast<unsigned char>('"')] = Quote;
+        table[static_cast<unsigned char>('\\')] = Backslash;
+
+        return table;
+    }
+
+    constexpr std::array<uint8_t, 256> ByteClassTable = MakeByteClassTable();
+
+    /**
+     * @brief Get the class of a byte.
+     */
+    inline uint8_t Classify(char byte)
+    {
+        return ByteClassTable[static_cast<unsigned char>(byte)];
+    }
+
+    /**
+     * @brief Skip the body of a string.
+     *
+     * @param[in] stream The whole stream.
+     * @param[in] position Position right after the opening quote.
+     * @param[in,out] lineNumber Line counter, updated with the new lines found within the string.
+     *
+     * @return Position right after the closing quote, or the stream size if the string is not terminated.
+     */
+    std::size_t SkipString(std::string_view stream, std::size_t position, std::size_t& lineNumber)
+    {
+        const std::size_t size = stream.size();
+
+        while (position < size)
+        {
+            switch (Classify(stream[position]))
+            {
+            case Quote:
+                return position + 1;
+            case Backslash:
+                // The escaped byte can never terminate the string.
+                position += 2;
+                continue;
+            case NewLine:
+                ++lineNumber;
+                break;
+            default:
+                break;
+            }
+
+            ++position;
+        }
+
+        return size;
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Public Methods
+
+    std::vector<JsonDocumentSpan> JsonDocumentSplitter::Split(std::string_view stream, JsonStreamFraming framing)
+    {
+        return (JsonStreamFraming::NewlineDelimited == framing) ? SplitLines(stream) : SplitConcatenated(stream);
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    std::vector<JsonDocumentSpan> JsonDocumentSplitter::SplitLines(std::string_view stream)
+    {
+        std::vector<JsonDocumentSpan> spans;
+
+        std::size_t lineNumber = 1;
+        std::size_t lineStart = 0;
+
+        while (lineStart < stream.size())
+        {
+            const void* newLine = std::memchr(stream.data() + lineStart, '\n', stream.size() - lineStart);
+            const std::size_t lineEnd = (nullptr == newLine)
+                                            ? stream.size()
+                                            : static_cast<std::size_t>(static_cast<const char*>(newLine) - stream.data());
+
+            // Blank lines are separators, not documents.
+            for (std::size_t position = lineStart; position < lineEnd; ++position)
+            {
+                if (Blank != Classify(stream[position]))
+                {
+                    spans.push_back(JsonDocumentSpan{lineStart, lineEnd - lineStart, lineNumber});
+                    break;
+                }
+            }
+
+            lineStart = lineEnd + 1;
+            ++lineNumber;
+        }
+
+        return spans;
+    }
+
+    std::vector<JsonDocumentSpan> JsonDocumentSplitter::SplitConcatenated(std::string_view stream)
+    {
+        std::vector<JsonDocumentSpan> spans;
+
+        const std::size_t size = stream.size();
+        std::size_t lineNumber = 1;
+        std::size_t position = 0;
+
+        while (position < size)
+        {
+            const uint8_t byteClass = Classify(stream[position]);
+
+            if (Blank == byteClass)
+            {
+                ++position;
+                continue;
+            }
+
+            if (NewLine == byteClass)
+            {
+                ++lineNumber;
+                ++position;
+                continue;
+            }
+
+            JsonDocumentSpan span{position, 0, lineNumber};
+
+            if (Open == byteClass)
+            {
+                std::size_t depth = 1;
+                ++position;
+
+                while (position < size && depth > 0)
+                {
+                    switch (Classify(stream[position]))
+                    {
+                    case Quote:
+                        position = SkipString(stream, position + 1, lineNumber);
+                        continue;
+                    case Open:
+                        ++depth;
+                        break;
+                    case Close:
+                        --depth;
+                        break;
+                    case NewLine:
+                        ++lineNumber;
+                        break;
+                    default:
+                        break;
+                    }
+
+                    ++position;
+                }
+            }
+            else if (Quote == byteClass)
+            {
+                position = SkipString(stream, position + 1, lineNumber);
+            }
+            else
+            {
+                // A scalar document (or a stray byte), it ends at the next blank or structural byte.
+                ++position;
+
+                while (position < size && Other == Classify(stream[position]))
+                {
+                    ++position;
+                }
+            }
+
+            span.Length = std::min(position, size) - span.Offset;
+            spans.push_back(span);
+        }
+
+        return spans;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
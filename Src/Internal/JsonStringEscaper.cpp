@@ -0,0 +1,282 @@
+/*************************************************************************************************
+ * @file JsonStringEscaper.cpp
+ *
+ * @brief Concrete implementation of @ref JsonStringEscaper class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/JsonStringEscaper.hpp"
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Signature of the instruction set specific search functions.
+     */
+    using FindEscapableFunction = std::size_t (*)(const char* data, std::size_t size);
+
+    /**
+     * @brief Build the table of bytes that have to be escaped at compile time.
+     *
+     * @return @b true for every byte to be escaped.
+     */
+    constexpr std::array<bool, 256> MakeEscapableTable()
+    {
+        std::array<bool, 256> table{};
+
+        for (std::size_t byte = 0; byte < 0x20; ++byte)
+        {
+            table[byte] = true;
+        }
+
+        table[static_cast<unsigned char>('"')] = true;
+        table[static_cast<unsigned char>('\\')] = true;
+
+        return table;
+    }
+
+    constexpr std::array<bool, 256> EscapableTable = MakeEscapableTable();
+
+    std::size_t FindEscapableScalar(const char* data, std::size_t size)
+    {
+        for (std::size_t position = 0; position < size; ++position)
+        {
+            if (EscapableTable[static_cast<unsigned char>(data[position])])
+            {
+                return position;
+            }
+        }
+
+        return size;
+    }
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+
+    __attribute__((target("sse2"))) std::size_t FindEscapableSse2(const char* data, std::size_t size)
+    {
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i lastControl = _mm_set1_epi8(0x1F);
+
+        std::size_t position = 0;
+
+        for (; position + 16 <= size; position += 16)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+
+            // Unsigned "chunk <= 0x1F" is "min(chunk, 0x1F) == chunk".
+            const __m128i escapable = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                                                _mm_cmpeq_epi8(chunk, backslash)),
+                                                   _mm_cmpeq_epi8(_mm_min_epu8(chunk, lastControl), chunk));
+
+            const unsigned int bits = static_cast<unsigned int>(_mm_movemask_epi8(escapable));
+
+            if (0 != bits)
+            {
+                return position + static_cast<std::size_t>(__builtin_ctz(bits));
+            }
+        }
+
+        return position + FindEscapableScalar(data + position, size - position);
+    }
+
+    __attribute__((target("avx2"))) std::size_t FindEscapableAvx2(const char* data, std::size_t size)
+    {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i lastControl = _mm256_set1_epi8(0x1F);
+
+        std::size_t position = 0;
+
+        for (; position + 32 <= size; position += 32)
+        {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+
+            const __m256i escapable = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                                                                      _mm256_cmpeq_epi8(chunk, backslash)),
+                                                      _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, lastControl), chunk));
+
+            const unsigned int bits = static_cast<unsigned int>(_mm256_movemask_epi8(escapable));
+
+            if (0 != bits)
+            {
+                return position + static_cast<std::size_t>(__builtin_ctz(bits));
+            }
+        }
+
+        // The remaining tail is shorter than a 32 byte run, finish it with the 16 byte variant.
+        return position + FindEscapableSse2(data + position, size - position);
+    }
+
+#endif
+
+    /**
+     * @brief Get the search function of an instruction set level.
+     *
+     * @param[in] level The instruction set level.
+     *
+     * @return The search function.
+     */
+    FindEscapableFunction GetFindEscapableFunction(SimdLevel level)
+    {
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+        switch (level)
+        {
+        case SimdLevel::Avx2:
+            return FindEscapableAvx2;
+        case SimdLevel::Sse2:
+            return FindEscapableSse2;
+        default:
+            break;
+        }
+#else
+        static_cast<void>(level);
+#endif
+
+        return FindEscapableScalar;
+    }
+
+    /**
+     * @brief Escape the text using the given search function.
+     */
+    void AppendQuotedWith(FindEscapableFunction findEscapable, std::string& output, std::string_view text)
+    {
+        output.push_back('"');
+
+        while (!text.empty())
+        {
+            const std::size_t cleanLength = findEscapable(text.data(), text.size());
+
+            output.append(text.data(), cleanLength);
+
+            if (cleanLength == text.size())
+            {
+                break;
+            }
+
+            char escapeSequence[JsonStringEscaper::MaxEscapeSequenceLength];
+            output.append(escapeSequence, JsonStringEscaper::EscapeByte(text[cleanLength], escapeSequence));
+
+            text.remove_prefix(cleanLength + 1);
+        }
+
+        output.push_back('"');
+    }
+
+    /**
+     * @brief Get the search function of the best instruction set of the executing CPU.
+     */
+    FindEscapableFunction GetBestFindEscapableFunction()
+    {
+        static const FindEscapableFunction BestFindEscapable = GetFindEscapableFunction(CpuFeatures::GetBestSimdLevel());
+
+        return BestFindEscapable;
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Public Methods
+
+    std::size_t JsonStringEscaper::FindEscapable(const char* data, std::size_t size)
+    {
+        return GetBestFindEscapableFunction()(data, size);
+    }
+
+    std::size_t JsonStringEscaper::FindEscapable(const char* data, std::size_t size, SimdLevel level)
+    {
+        return GetFindEscapableFunction(level)(data, size);
+    }
+
+    std::size_t JsonStringEscaper::EscapeByte(char byte, char* buffer)
+    {
+        static constexpr char HexDigits[] = "0123456789abcdef";
+
+        buffer[0] = '\\';
+
+        switch (byte)
+        {
+        case '"':
+            buffer[1] = '"';
+            return 2;
+        case '\\':
+            buffer[1] = '\\';
+            return 2;
+        case '\b':
+            buffer[1] = 'b';
+            return 2;
+        case '\f':
+            buffer[1] = 'f';
+            return 2;
+        case '\n':
+            buffer[1] = 'n';
+            return 2;
+        case '\r':
+            buffer[1] = 'r';
+            return 2;
+        case '\t':
+            buffer[1] = 't';
+            return 2;
+        default:
+            break;
+        }
+
+        const unsigned char value = static_cast<unsigned char>(byte);
+
+        buffer[1] = 'u';
+        buffer[2] = '0';
+        buffer[3] = '0';
+        buffer[4] = HexDigits[value >> 4];
+        buffer[5] = HexDigits[value & 0x0F];
+
+        return 6;
+    }
+
+    std::size_t JsonStringEscaper::GetQuotedSize(std::string_view text)
+    {
+        const FindEscapableFunction findEscapable = GetBestFindEscapableFunction();
+
+        std::size_t size = text.size() + 2;
+
+        while (!text.empty())
+        {
+            const std::size_t cleanLength = findEscapable(text.data(), text.size());
+
+            if (cleanLength == text.size())
+            {
+                break;
+            }
+
+            char escapeSequence[MaxEscapeSequenceLength];
+            size += EscapeByte(text[cleanLength], escapeSequence) - 1;
+
+            text.remove_prefix(cleanLength + 1);
+        }
+
+        return size;
+    }
+
+    void JsonStringEscaper::AppendQuoted(std::string& output, std::string_view text)
+    {
+        AppendQuotedWith(GetBestFindEscapableFunction(), output, text);
+    }
+
+    void JsonStringEscaper::AppendQuoted(std::string& output, std::string_view text, SimdLevel level)
+    {
+        AppendQuotedWith(GetFindEscapableFunction(level), output, text);
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,904 @@
+/*************************************************************************************************
+ * @file JsonStructuralValidator.cpp
+ *
+ * @brief Concrete implementation of @ref JsonStructuralValidator class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/JsonStructuralValidator.hpp"
+
+#include <cstring>
+#include <limits>
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    // #region Stage 1, Classification
+
+    /**
+     * @brief Size of the blocks stage one works on, one bit per byte.
+     */
+    constexpr std::size_t BlockSize = 64;
+
+    /**
+     * @brief Classification bits of the bytes of one block.
+     */
+    struct BlockMasks
+    {
+        uint64_t Quote = 0;
+        uint64_t Backslash = 0;
+        uint64_t Structural = 0;
+        uint64_t Whitespace = 0;
+        uint64_t Control = 0;
+    };
+
+    /**
+     * @brief Signature of the instruction set specific block classifiers.
+     */
+    using ClassifyBlockFunction = void (*)(const char* block, BlockMasks& masks);
+
+    /**
+     * @brief Signature of the instruction set specific ASCII run length functions.
+     */
+    using AsciiPrefixLengthFunction = std::size_t (*)(const char* data, std::size_t size);
+
+    enum ByteFlag : uint8_t
+    {
+        QuoteFlag = 1,
+        BackslashFlag = 2,
+        StructuralFlag = 4,
+        WhitespaceFlag = 8,
+        ControlFlag = 16
+    };
+
+    /**
+     * @brief Build the classification table of the scalar path at compile time.
+     */
+    constexpr std::array<uint8_t, 256> MakeByteFlagTable()
+    {
+        std::array<uint8_t, 256> table{};
+
+        for (std::size_t byte = 0; byte < 0x20; ++byte)
+        {
+            table[byte] = ControlFlag;
+        }
+
+        table[static_cast<unsigned char>('"')] = QuoteFlag;
+        table[static_cast<unsigned char>('\\')] = BackslashFlag;
+
+        for (char structural : {'{', '}', '[', ']', ':', ','})
+        {
+            table[static_cast<unsigned char>(structural)] = StructuralFlag;
+        }
+
+        for (char whitespace : {' ', '\t', '\n', '\r'})
+        {
+            table[static_cast<unsigned char>(whitespace)] |= WhitespaceFlag;
+        }
+
+        return table;
+    }
+
+    constexpr std::array<uint8_t, 256> ByteFlagTable = MakeByteFlagTable();
+
+    void ClassifyBlockScalar(const char* block, BlockMasks& masks)
+    {
+        masks = BlockMasks{};
+
+        for (std::size_t position = 0; position < BlockSize; ++position)
+        {
+            const uint8_t flags = ByteFlagTable[static_cast<unsigned char>(block[position])];
+            const uint64_t bit = uint64_t{1} << position;
+
+            masks.Quote |= (0 != (flags & QuoteFlag)) ? bit : 0;
+            masks.Backslash |= (0 != (flags & BackslashFlag)) ? bit : 0;
+            masks.Structural |= (0 != (flags & StructuralFlag)) ? bit : 0;
+            masks.Whitespace |= (0 != (flags & WhitespaceFlag)) ? bit : 0;
+            masks.Control |= (0 != (flags & ControlFlag)) ? bit : 0;
+        }
+    }
+
+    std::size_t AsciiPrefixLengthScalar(const char* data, std::size_t size)
+    {
+        for (std::size_t position = 0; position < size; ++position)
+        {
+            if (static_cast<unsigned char>(data[position]) >= 0x80)
+            {
+                return position;
+            }
+        }
+
+        return size;
+    }
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+
+    /**
+     * @brief Widen the result of a byte movemask.
+     */
+    inline uint64_t ToMask(int movemask)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(movemask));
+    }
+
+    __attribute__((target("sse2"))) void ClassifyBlockSse2(const char* block, BlockMasks& masks)
+    {
+        masks = BlockMasks{};
+
+        const __m128i lastControl = _mm_set1_epi8(0x1F);
+
+        for (std::size_t part = 0; part < BlockSize / 16; ++part)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * part));
+            const std::size_t shift = 16 * part;
+
+            const __m128i structural =
+                _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('{')),
+                                                       _mm_cmpeq_epi8(chunk, _mm_set1_epi8('}'))),
+                                          _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('[')),
+                                                       _mm_cmpeq_epi8(chunk, _mm_set1_epi8(']')))),
+                             _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')),
+                                          _mm_cmpeq_epi8(chunk, _mm_set1_epi8(','))));
+
+            const __m128i whitespace =
+                _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                                          _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+                             _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')),
+                                          _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+
+            masks.Quote |= ToMask(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')))) << shift;
+            masks.Backslash |= ToMask(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')))) << shift;
+            masks.Structural |= ToMask(_mm_movemask_epi8(structural)) << shift;
+            masks.Whitespace |= ToMask(_mm_movemask_epi8(whitespace)) << shift;
+            masks.Control |= ToMask(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(chunk, lastControl), chunk))) << shift;
+        }
+    }
+
+    __attribute__((target("avx2"))) void ClassifyBlockAvx2(const char* block, BlockMasks& masks)
+    {
+        masks = BlockMasks{};
+
+        const __m256i lastControl = _mm256_set1_epi8(0x1F);
+
+        for (std::size_t part = 0; part < BlockSize / 32; ++part)
+        {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * part));
+            const std::size_t shift = 32 * part;
+
+            const __m256i structural =
+                _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('{')),
+                                                                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('}'))),
+                                                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('[')),
+                                                                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(']')))),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(':')),
+                                                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(','))));
+
+            const __m256i whitespace =
+                _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')),
+                                                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'))),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')),
+                                                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r'))));
+
+            masks.Quote |= ToMask(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"')))) << shift;
+            masks.Backslash |= ToMask(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')))) << shift;
+            masks.Structural |= ToMask(_mm256_movemask_epi8(structural)) << shift;
+            masks.Whitespace |= ToMask(_mm256_movemask_epi8(whitespace)) << shift;
+            masks.Control |= ToMask(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, lastControl), chunk))) << shift;
+        }
+    }
+
+    __attribute__((target("sse2"))) std::size_t AsciiPrefixLengthSse2(const char* data, std::size_t size)
+    {
+        std::size_t position = 0;
+
+        for (; position + 16 <= size; position += 16)
+        {
+            const unsigned int bits = static_cast<unsigned int>(
+                _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position))));
+
+            if (0 != bits)
+            {
+                return position + static_cast<std::size_t>(__builtin_ctz(bits));
+            }
+        }
+
+        return position + AsciiPrefixLengthScalar(data + position, size - position);
+    }
+
+    __attribute__((target("avx2"))) std::size_t AsciiPrefixLengthAvx2(const char* data, std::size_t size)
+    {
+        std::size_t position = 0;
+
+        for (; position + 32 <= size; position += 32)
+        {
+            const unsigned int bits = static_cast<unsigned int>(
+                _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position))));
+
+            if (0 != bits)
+            {
+                return position + static_cast<std::size_t>(__builtin_ctz(bits));
+            }
+        }
+
+        return position + AsciiPrefixLengthSse2(data + position, size - position);
+    }
+
+#endif
+
+    ClassifyBlockFunction GetClassifyBlockFunction(SimdLevel level)
+    {
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+        switch (level)
+        {
+        case SimdLevel::Avx2:
+            return ClassifyBlockAvx2;
+        case SimdLevel::Sse2:
+            return ClassifyBlockSse2;
+        default:
+            break;
+        }
+#else
+        static_cast<void>(level);
+#endif
+
+        return ClassifyBlockScalar;
+    }
+
+    AsciiPrefixLengthFunction GetAsciiPrefixLengthFunction(SimdLevel level)
+    {
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+        switch (level)
+        {
+        case SimdLevel::Avx2:
+            return AsciiPrefixLengthAvx2;
+        case SimdLevel::Sse2:
+            return AsciiPrefixLengthSse2;
+        default:
+            break;
+        }
+#else
+        static_cast<void>(level);
+#endif
+
+        return AsciiPrefixLengthScalar;
+    }
+
+    /**
+     * @brief Get the bits of the escaped bytes of a block.
+     *
+     * Backslashes are rare in practice, so they are resolved one by one instead of with carry-less arithmetic.
+     *
+     * @param[in] backslash Backslash bits of the block.
+     * @param[in,out] isFirstEscaped Whether the first byte of the block is escaped by the previous block, it is
+     * updated for the next block.
+     *
+     * @return Bits of the bytes preceded by an escaping backslash.
+     */
+    uint64_t FindEscaped(uint64_t backslash, bool& isFirstEscaped)
+    {
+        uint64_t escaped = 0;
+
+        if (isFirstEscaped)
+        {
+            escaped = 1;
+            backslash &= ~uint64_t{1};
+        }
+
+        isFirstEscaped = false;
+
+        while (0 != backslash)
+        {
+            const unsigned int position = static_cast<unsigned int>(__builtin_ctzll(backslash));
+
+            if (BlockSize - 1 == position)
+            {
+                isFirstEscaped = true;
+                break;
+            }
+
+            const uint64_t escapedBit = uint64_t{1} << (position + 1);
+
+            escaped |= escapedBit;
+
+            // An escaped backslash does not escape anything.
+            backslash &= ~escapedBit;
+            backslash &= backslash - 1;
+        }
+
+        return escaped;
+    }
+
+    /**
+     * @brief Get the inclusive prefix xor of the bits, it turns the quote bits into the in-string bits.
+     */
+    inline uint64_t PrefixXor(uint64_t bits)
+    {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+
+        return bits;
+    }
+
+    /**
+     * @brief Stage one, build the structural index.
+     *
+     * @param[in] payload The JSON text.
+     * @param[in] classifyBlock The block classifier.
+     * @param[out] index Positions of the structural characters, of all the unescaped quotes and of the first
+     * byte of every scalar.
+     *
+     * @return bool @b false if the text is malformed already at this stage.
+     */
+    bool BuildStructuralIndex(std::string_view payload, ClassifyBlockFunction classifyBlock, std::vector<uint32_t>& index)
+    {
+        bool isFirstEscaped = false;
+        uint64_t previousInString = 0;
+        uint64_t previousScalar = 0;
+
+        char paddedBlock[BlockSize];
+
+        for (std::size_t blockStart = 0; blockStart < payload.size(); blockStart += BlockSize)
+        {
+            const char* block = payload.data() + blockStart;
+
+            // The tail is padded with whitespace, which never changes the outcome.
+            if (payload.size() - blockStart < BlockSize)
+            {
+                std::memset(paddedBlock, ' ', BlockSize);
+                std::memcpy(paddedBlock, block, payload.size() - blockStart);
+                block = paddedBlock;
+            }
+
+            BlockMasks masks;
+            classifyBlock(block, masks);
+
+            const uint64_t quotes = masks.Quote & ~FindEscaped(masks.Backslash, isFirstEscaped);
+            const uint64_t inString = PrefixXor(quotes) ^ previousInString;
+
+            previousInString = (0 != (inString >> 63)) ? std::numeric_limits<uint64_t>::max() : 0;
+
+            // Control characters are never allowed within strings and only whitespace ones outside.
+            if (0 != (masks.Control & (inString | ~masks.Whitespace)))
+            {
+                return false;
+            }
+
+            const uint64_t scalar = ~(masks.Structural | masks.Whitespace | masks.Quote) & ~inString;
+            const uint64_t scalarStart = scalar & ~((scalar << 1) | previousScalar);
+
+            previousScalar = scalar >> 63;
+
+            uint64_t bits = (masks.Structural & ~inString) | quotes | scalarStart;
+
+            while (0 != bits)
+            {
+                index.push_back(static_cast<uint32_t>(blockStart + static_cast<std::size_t>(__builtin_ctzll(bits))));
+                bits &= bits - 1;
+            }
+        }
+
+        // An unterminated string.
+        return 0 == previousInString;
+    }
+
+    /**
+     * @brief Check that the text is valid UTF-8.
+     */
+    bool IsValidUtf8With(AsciiPrefixLengthFunction asciiPrefixLength, std::string_view text)
+    {
+        const unsigned char* data = reinterpret_cast<const unsigned char*>(text.data());
+        const std::size_t size = text.size();
+
+        std::size_t position = 0;
+
+        while (true)
+        {
+            position += asciiPrefixLength(text.data() + position, size - position);
+
+            if (position >= size)
+            {
+                return true;
+            }
+
+            const unsigned char lead = data[position];
+
+            std::size_t continuationCount = 0;
+            unsigned char secondMin = 0x80;
+            unsigned char secondMax = 0xBF;
+
+            if (lead >= 0xC2 && lead <= 0xDF)
+            {
+                continuationCount = 1;
+            }
+            else if (lead >= 0xE0 && lead <= 0xEF)
+            {
+                continuationCount = 2;
+
+                // No overlong forms and no surrogates.
+                secondMin = (0xE0 == lead) ? 0xA0 : 0x80;
+                secondMax = (0xED == lead) ? 0x9F : 0xBF;
+            }
+            else if (lead >= 0xF0 && lead <= 0xF4)
+            {
+                continuationCount = 3;
+
+                // No overlong forms and nothing above U+10FFFF.
+                secondMin = (0xF0 == lead) ? 0x90 : 0x80;
+                secondMax = (0xF4 == lead) ? 0x8F : 0xBF;
+            }
+            else
+            {
+                return false;
+            }
+
+            if (size - position <= continuationCount)
+            {
+                return false;
+            }
+
+            if (data[position + 1] < secondMin || data[position + 1] > secondMax)
+            {
+                return false;
+            }
+
+            for (std::size_t offset = 2; offset <= continuationCount; ++offset)
+            {
+                if (0x80 != (data[position + offset] & 0xC0))
+                {
+                    return false;
+                }
+            }
+
+            position += continuationCount + 1;
+        }
+    }
+
+    // #endregion
+
+    // #region Stage 2, Grammar
+
+    /**
+     * @brief Exponents beyond this magnitude are left to the reference parser.
+     */
+    constexpr long MaxFastExponent = 250;
+
+    /**
+     * @brief Numbers longer than this are left to the reference parser.
+     */
+    constexpr std::size_t MaxFastNumberLength = 32;
+
+    inline bool IsDigit(char byte)
+    {
+        return byte >= '0' && byte <= '9';
+    }
+
+    /**
+     * @brief Read the 4 hex digits of a unicode escape.
+     */
+    bool ReadHex4(const char* begin, const char* end, unsigned int& codeUnit)
+    {
+        if (end - begin < 4)
+        {
+            return false;
+        }
+
+        codeUnit = 0;
+
+        for (int offset = 0; offset < 4; ++offset)
+        {
+            const char digit = begin[offset];
+
+            codeUnit <<= 4;
+
+            if (IsDigit(digit))
+            {
+                codeUnit |= static_cast<unsigned int>(digit - '0');
+            }
+            else if (digit >= 'a' && digit <= 'f')
+            {
+                codeUnit |= static_cast<unsigned int>(digit - 'a' + 10);
+            }
+            else if (digit >= 'A' && digit <= 'F')
+            {
+                codeUnit |= static_cast<unsigned int>(digit - 'A' + 10);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Check the escape sequences of a string body, surrogates must form pairs.
+     */
+    bool AreValidEscapes(const char* begin, const char* end)
+    {
+        const char* position = begin;
+
+        while (position < end)
+        {
+            const void* found = std::memchr(position, '\\', static_cast<std::size_t>(end - position));
+
+            if (nullptr == found)
+            {
+                return true;
+            }
+
+            position = static_cast<const char*>(found);
+
+            if (end - position < 2)
+            {
+                return false;
+            }
+
+            switch (position[1])
+            {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                position += 2;
+                continue;
+            case 'u':
+                break;
+            default:
+                return false;
+            }
+
+            unsigned int codeUnit = 0;
+
+            if (!ReadHex4(position + 2, end, codeUnit))
+            {
+                return false;
+            }
+
+            position += 6;
+
+            if (codeUnit >= 0xDC00 && codeUnit <= 0xDFFF)
+            {
+                return false;
+            }
+
+            if (codeUnit >= 0xD800 && codeUnit <= 0xDBFF)
+            {
+                unsigned int trailingCodeUnit = 0;
+
+                if (end - position < 6 || '\\' != position[0] || 'u' != position[1] ||
+                    !ReadHex4(position + 2, end, trailingCodeUnit) ||
+                    trailingCodeUnit < 0xDC00 || trailingCodeUnit > 0xDFFF)
+                {
+                    return false;
+                }
+
+                position += 6;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Check a number against the JSON grammar and the fast path limits.
+     */
+    bool IsAcceptedNumber(const char* begin, const char* end)
+    {
+        if (static_cast<std::size_t>(end - begin) > MaxFastNumberLength)
+        {
+            return false;
+        }
+
+        const char* position = begin;
+
+        if (position < end && '-' == *position)
+        {
+            ++position;
+        }
+
+        if (position == end)
+        {
+            return false;
+        }
+
+        if ('0' == *position)
+        {
+            ++position;
+        }
+        else if (IsDigit(*position))
+        {
+            while (position < end && IsDigit(*position))
+            {
+                ++position;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        if (position < end && '.' == *position)
+        {
+            ++position;
+
+            const char* fractionBegin = position;
+
+            while (position < end && IsDigit(*position))
+            {
+                ++position;
+            }
+
+            if (fractionBegin == position)
+            {
+                return false;
+            }
+        }
+
+        if (position < end && ('e' == *position || 'E' == *position))
+        {
+            ++position;
+
+            if (position < end && ('+' == *position || '-' == *position))
+            {
+                ++position;
+            }
+
+            const char* exponentBegin = position;
+            long exponent = 0;
+
+            while (position < end && IsDigit(*position))
+            {
+                exponent = exponent * 10 + (*position - '0');
+                ++position;
+
+                if (exponent > MaxFastExponent)
+                {
+                    return false;
+                }
+            }
+
+            if (exponentBegin == position)
+            {
+                return false;
+            }
+        }
+
+        return position == end;
+    }
+
+    /**
+     * @brief Check a scalar (literal or number) starting at the given position.
+     */
+    bool IsAcceptedScalar(std::string_view payload, std::size_t start)
+    {
+        std::size_t stop = start;
+
+        while (stop < payload.size() &&
+               0 == (ByteFlagTable[static_cast<unsigned char>(payload[stop])] & (StructuralFlag | WhitespaceFlag | QuoteFlag)))
+        {
+            ++stop;
+        }
+
+        const std::string_view scalar = payload.substr(start, stop - start);
+
+        if ("true" == scalar || "false" == scalar || "null" == scalar)
+        {
+            return true;
+        }
+
+        return IsAcceptedNumber(scalar.data(), scalar.data() + scalar.size());
+    }
+
+    /**
+     * @brief Grammar states of stage two.
+     */
+    enum class GrammarState
+    {
+        Value,
+        ArrayFirstValue,
+        ObjectFirstKey,
+        ObjectKey,
+        AfterValue
+    };
+
+    /**
+     * @brief Stage two, check the grammar over the structural index.
+     *
+     * @param[in] payload The JSON text.
+     * @param[in] index The structural index built by stage one.
+     * @param[in] maxDepth Nesting depth limit of the reference parser.
+     *
+     * @return bool @b true if the text is accepted.
+     */
+    bool CheckGrammar(std::string_view payload, const std::vector<uint32_t>& index, std::size_t maxDepth)
+    {
+        std::vector<char> containers;
+        containers.reserve(maxDepth);
+
+        const std::size_t count = index.size();
+        std::size_t next = 0;
+        GrammarState state = GrammarState::Value;
+
+        // Consume the closing quote of the string opened at the given position and check its body.
+        auto consumeString = [&](std::size_t openingQuote)
+        {
+            if (next == count)
+            {
+                return false;
+            }
+
+            const std::size_t closingQuote = index[next++];
+
+            return '"' == payload[closingQuote] &&
+                   AreValidEscapes(payload.data() + openingQuote + 1, payload.data() + closingQuote);
+        };
+
+        while (true)
+        {
+            if (GrammarState::AfterValue == state)
+            {
+                if (containers.empty())
+                {
+                    // Anything after the root value is extra data.
+                    return next == count;
+                }
+
+                if (next == count)
+                {
+                    return false;
+                }
+
+                const char byte = payload[index[next++]];
+                const bool isObject = '{' == containers.back();
+
+                if (',' == byte)
+                {
+                    state = isObject ? GrammarState::ObjectKey : GrammarState::Value;
+                }
+                else if ((isObject ? '}' : ']') == byte)
+                {
+                    containers.pop_back();
+                }
+                else
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            if (next == count)
+            {
+                return false;
+            }
+
+            const std::size_t position = index[next++];
+            const char byte = payload[position];
+
+            switch (state)
+            {
+            case GrammarState::ObjectFirstKey:
+                if ('}' == byte)
+                {
+                    containers.pop_back();
+                    state = GrammarState::AfterValue;
+                    continue;
+                }
+                [[fallthrough]];
+            case GrammarState::ObjectKey:
+                if ('"' != byte || !consumeString(position) || next == count || ':' != payload[index[next++]])
+                {
+                    return false;
+                }
+
+                state = GrammarState::Value;
+                continue;
+            case GrammarState::ArrayFirstValue:
+                if (']' == byte)
+                {
+                    containers.pop_back();
+                    state = GrammarState::AfterValue;
+                    continue;
+                }
+                [[fallthrough]];
+            default:
+                break;
+            }
+
+            // A value is expected.
+            if ('{' == byte || '[' == byte)
+            {
+                // The depth limit itself is left to the reference parser.
+                if (containers.size() + 1 >= maxDepth)
+                {
+                    return false;
+                }
+
+                containers.push_back(byte);
+                state = ('{' == byte) ? GrammarState::ObjectFirstKey : GrammarState::ArrayFirstValue;
+            }
+            else if ('"' == byte)
+            {
+                if (!consumeString(position))
+                {
+                    return false;
+                }
+
+                state = GrammarState::AfterValue;
+            }
+            else if (0 == (ByteFlagTable[static_cast<unsigned char>(byte)] & StructuralFlag) &&
+                     IsAcceptedScalar(payload, position))
+            {
+                state = GrammarState::AfterValue;
+            }
+            else
+            {
+                return false;
+            }
+        }
+    }
+
+    // #endregion
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Public Methods
+
+    bool JsonStructuralValidator::IsAccepted(std::string_view payload, std::size_t maxDepth)
+    {
+        return IsAccepted(payload, maxDepth, CpuFeatures::GetBestSimdLevel());
+    }
+
+    bool JsonStructuralValidator::IsAccepted(std::string_view payload, std::size_t maxDepth, SimdLevel level)
+    {
+        // Positions are indexed on 32 bits.
+        if (payload.empty() || payload.size() > std::numeric_limits<uint32_t>::max())
+        {
+            return false;
+        }
+
+        if (!IsValidUtf8(payload, level))
+        {
+            return false;
+        }
+
+        std::vector<uint32_t> index;
+        index.reserve(payload.size() / 8 + 16);
+
+        if (!BuildStructuralIndex(payload, GetClassifyBlockFunction(level), index))
+        {
+            return false;
+        }
+
+        return CheckGrammar(payload, index, maxDepth);
+    }
+
+    bool JsonStructuralValidator::IsValidUtf8(std::string_view text, SimdLevel level)
+    {
+        return IsValidUtf8With(GetAsciiPrefixLengthFunction(level), text);
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,264 @@
+/*************************************************************************************************
+ * @file JsonValueWriter.cpp
+ *
+ * @brief Concrete implementation of @ref JsonValueWriter class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/JsonValueWriter.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+
+#include "Internal/JsonStringEscaper.hpp"
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    namespace bj = boost::json;
+
+    // #region Public Methods
+
+    void JsonValueWriter::Write(const bj::value& value, std::string& output)
+    {
+        switch (value.kind())
+        {
+        case bj::kind::object:
+        {
+            const bj::object& object = value.get_object();
+
+            output.push_back('{');
+
+            bool isFirst = true;
+
+            for (const bj::key_value_pair& member : object)
+            {
+                if (!isFirst)
+                {
+                    output.push_back(',');
+                }
+
+                isFirst = false;
+
+                JsonStringEscaper::AppendQuoted(output, std::string_view(member.key().data(), member.key().size()));
+                output.push_back(':');
+                Write(member.value(), output);
+            }
+
+            output.push_back('}');
+            break;
+        }
+        case bj::kind::array:
+        {
+            const bj::array& array = value.get_array();
+
+            output.push_back('[');
+
+            for (std::size_t index = 0; index < array.size(); ++index)
+            {
+                if (0 != index)
+                {
+                    output.push_back(',');
+                }
+
+                Write(array[index], output);
+            }
+
+            output.push_back(']');
+            break;
+        }
+        case bj::kind::string:
+        {
+            const bj::string& text = value.get_string();
+            JsonStringEscaper::AppendQuoted(output, std::string_view(text.data(), text.size()));
+            break;
+        }
+        case bj::kind::int64:
+            AppendNumber(output, value.get_int64());
+            break;
+        case bj::kind::uint64:
+            AppendNumber(output, value.get_uint64());
+            break;
+        case bj::kind::double_:
+            AppendNumber(output, value.get_double());
+            break;
+        case bj::kind::bool_:
+            output.append(value.get_bool() ? "true" : "false");
+            break;
+        case bj::kind::null:
+        default:
+            output.append("null");
+            break;
+        }
+    }
+
+    void JsonValueWriter::Write(const bj::value& value,
+                                std::string& buffer,
+                                Interfaces::IChunkSink& sink,
+                                std::size_t chunkSize)
+    {
+        buffer.clear();
+        WriteChunked(value, buffer, sink, chunkSize);
+
+        if (!buffer.empty())
+        {
+            sink.Write(buffer);
+            buffer.clear();
+        }
+    }
+
+    std::string JsonValueWriter::Write(const bj::value& value)
+    {
+        std::string output;
+        Write(value, output);
+
+        return output;
+    }
+
+    std::size_t JsonValueWriter::FormatNumber(int64_t number, char* buffer)
+    {
+        return static_cast<std::size_t>(std::to_chars(buffer, buffer + MaxNumberLength, number).ptr - buffer);
+    }
+
+    std::size_t JsonValueWriter::FormatNumber(uint64_t number, char* buffer)
+    {
+        return static_cast<std::size_t>(std::to_chars(buffer, buffer + MaxNumberLength, number).ptr - buffer);
+    }
+
+    std::size_t JsonValueWriter::FormatNumber(double number, char* buffer)
+    {
+        if (std::isnan(number))
+        {
+            std::memcpy(buffer, "null", 4);
+            return 4;
+        }
+
+        if (std::isinf(number))
+        {
+            const std::string_view text = (number < 0) ? "-1e99999" : "1e99999";
+            std::memcpy(buffer, text.data(), text.size());
+            return text.size();
+        }
+
+        // The shortest round-trip digits in scientific form, "1.2345e+02", rewritten the way ryu writes them for
+        // boost::json::serialize, "1.2345E2".
+        const char* end = std::to_chars(buffer, buffer + MaxNumberLength, number, std::chars_format::scientific).ptr;
+        const char* exponent = static_cast<const char*>(std::memchr(buffer, 'e', static_cast<std::size_t>(end - buffer)));
+
+        std::size_t length = static_cast<std::size_t>(exponent - buffer);
+        buffer[length++] = 'E';
+
+        const char* digits = exponent + 1;
+
+        if ('-' == *digits)
+        {
+            buffer[length++] = '-';
+        }
+
+        ++digits;
+
+        while (digits + 1 < end && '0' == *digits)
+        {
+            ++digits;
+        }
+
+        std::memmove(buffer + length, digits, static_cast<std::size_t>(end - digits));
+
+        return length + static_cast<std::size_t>(end - digits);
+    }
+
+    void JsonValueWriter::AppendNumber(std::string& output, int64_t number)
+    {
+        char buffer[MaxNumberLength];
+        output.append(buffer, FormatNumber(number, buffer));
+    }
+
+    void JsonValueWriter::AppendNumber(std::string& output, uint64_t number)
+    {
+        char buffer[MaxNumberLength];
+        output.append(buffer, FormatNumber(number, buffer));
+    }
+
+    void JsonValueWriter::AppendNumber(std::string& output, double number)
+    {
+        char buffer[MaxNumberLength];
+        output.append(buffer, FormatNumber(number, buffer));
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void JsonValueWriter::WriteChunked(const bj::value& value,
+                                       std::string& buffer,
+                                       Interfaces::IChunkSink& sink,
+                                       std::size_t chunkSize)
+    {
+        // Same text as Write, only the containers are walked here so that the chunks are cut between elements.
+        const auto flushFullChunk = [&]()
+        {
+            if (buffer.size() >= chunkSize)
+            {
+                sink.Write(buffer);
+                buffer.clear();
+            }
+        };
+
+        switch (value.kind())
+        {
+        case bj::kind::object:
+        {
+            buffer.push_back('{');
+
+            bool isFirst = true;
+
+            for (const bj::key_value_pair& member : value.get_object())
+            {
+                if (!isFirst)
+                {
+                    buffer.push_back(',');
+                }
+
+                isFirst = false;
+
+                JsonStringEscaper::AppendQuoted(buffer, std::string_view(member.key().data(), member.key().size()));
+                buffer.push_back(':');
+                WriteChunked(member.value(), buffer, sink, chunkSize);
+                flushFullChunk();
+            }
+
+            buffer.push_back('}');
+            break;
+        }
+        case bj::kind::array:
+        {
+            const bj::array& array = value.get_array();
+
+            buffer.push_back('[');
+
+            for (std::size_t index = 0; index < array.size(); ++index)
+            {
+                if (0 != index)
+                {
+                    buffer.push_back(',');
+                }
+
+                WriteChunked(array[index], buffer, sink, chunkSize);
+                flushFullChunk();
+            }
+
+            buffer.push_back(']');
+            break;
+        }
+        default:
+            Write(value, buffer);
+            break;
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,394 @@
+/*************************************************************************************************
+ * @file LimitedJsonParser.cpp
+ *
+ * @brief Concrete implementation of @ref LimitedJsonParser class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/LimitedJsonParser.hpp"
+
+#include "Common/Boost/BoostIncludeGuardStart.hpp"
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/version.hpp>
+#include "Common/Boost/BoostIncludeGuardEnd.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    namespace bj = boost::json;
+
+    // #region Construction/Destruction
+
+    LimitedJsonParser::LimitedJsonParser(const JsonParseConfiguration& configuration)
+        : _maxPayloadBytes(configuration.MaxPayloadBytes),
+          _parser(ToParseOptions(configuration), configuration)
+    {
+    }
+
+    LimitedJsonParser::~LimitedJsonParser() = default;
+
+    LimitedJsonParser::Handler::Handler(const JsonParseConfiguration& configuration)
+        : MaxStringLength(configuration.MaxStringLength),
+          MaxObjectSize(configuration.MaxObjectSize),
+          Building(false)
+    {
+        if (0 != MaxObjectSize)
+        {
+            // The depth is bounded by the parser, so the containers never reallocate.
+            Containers.reserve(configuration.MaxDepth);
+        }
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    bj::value LimitedJsonParser::Parse(std::string_view payload, bj::storage_ptr storage, bj::error_code& errorCode)
+    {
+        Handler& handler = _parser.handler();
+        handler.Stack.reset(std::move(storage));
+
+        Run(payload, true, errorCode);
+
+        if (errorCode)
+        {
+            // Destroy the partial values while their storage is still alive.
+            handler.Stack.reset();
+            return bj::value();
+        }
+
+        return handler.Stack.release();
+    }
+
+    void LimitedJsonParser::Check(std::string_view payload, bj::error_code& errorCode)
+    {
+        Run(payload, false, errorCode);
+    }
+
+    bj::parse_options LimitedJsonParser::ToParseOptions(const JsonParseConfiguration& configuration)
+    {
+        if (0 == configuration.MaxDepth)
+        {
+            throw XInvalidArgument("The maximal depth of the json documents must be at least 1!");
+        }
+
+        bj::parse_options options;
+        options.max_depth = configuration.MaxDepth;
+        options.allow_comments = configuration.AllowComments;
+        options.allow_trailing_commas = configuration.AllowTrailingCommas;
+        options.allow_invalid_utf8 = configuration.AllowInvalidUtf8;
+
+#if BOOST_VERSION >= 108300
+        switch (configuration.Numbers)
+        {
+        case NumberPrecision::Imprecise:
+            options.numbers = bj::number_precision::imprecise;
+            break;
+        case NumberPrecision::Precise:
+            options.numbers = bj::number_precision::precise;
+            break;
+        case NumberPrecision::None:
+            options.numbers = bj::number_precision::none;
+            break;
+        default:
+            throw XInvalidArgument("Unknown number precision!");
+        }
+#else
+        if (NumberPrecision::Imprecise != configuration.Numbers)
+        {
+            throw XInvalidArgument("The number precision modes need Boost 1.83 or later!");
+        }
+#endif
+
+        return options;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void LimitedJsonParser::Run(std::string_view payload, bool building, bj::error_code& errorCode)
+    {
+        errorCode = {};
+
+        if (0 != _maxPayloadBytes && payload.size() > _maxPayloadBytes)
+        {
+            errorCode = boost::system::errc::make_error_code(boost::system::errc::message_size);
+            return;
+        }
+
+        Handler& handler = _parser.handler();
+        handler.Building = building;
+        handler.Containers.clear();
+
+        _parser.reset();
+
+        const std::size_t consumed = _parser.write_some(false, payload.data(), payload.size(), errorCode);
+
+        if (!errorCode && consumed < payload.size())
+        {
+            errorCode = bj::error::extra_data;
+        }
+    }
+
+    // #endregion
+
+    // #region Handler
+
+    bool LimitedJsonParser::Handler::on_document_begin(bj::error_code&)
+    {
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_document_end(bj::error_code&)
+    {
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_object_begin(bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (0 != MaxObjectSize)
+        {
+            Containers.push_back(Container{0, bj::error::object_too_large});
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_object_end(std::size_t size, bj::error_code&)
+    {
+        if (0 != MaxObjectSize)
+        {
+            Containers.pop_back();
+        }
+
+        if (Building)
+        {
+            Stack.push_object(size);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_array_begin(bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (0 != MaxObjectSize)
+        {
+            Containers.push_back(Container{0, bj::error::array_too_large});
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_array_end(std::size_t size, bj::error_code&)
+    {
+        if (0 != MaxObjectSize)
+        {
+            Containers.pop_back();
+        }
+
+        if (Building)
+        {
+            Stack.push_array(size);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_key_part(bj::string_view part, std::size_t size, bj::error_code& errorCode)
+    {
+        if (!CheckLength(size, bj::error::key_too_large, errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_chars(part);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_key(bj::string_view part, std::size_t size, bj::error_code& errorCode)
+    {
+        if (!CheckLength(size, bj::error::key_too_large, errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_key(part);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_string_part(bj::string_view part, std::size_t size,
+                                                    bj::error_code& errorCode)
+    {
+        if (!CheckLength(size, bj::error::string_too_large, errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_chars(part);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_string(bj::string_view part, std::size_t size, bj::error_code& errorCode)
+    {
+        if (!CheckLength(size, bj::error::string_too_large, errorCode) || !AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_string(part);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_number_part(bj::string_view, bj::error_code&)
+    {
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_int64(std::int64_t value, bj::string_view, bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_int64(value);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_uint64(std::uint64_t value, bj::string_view, bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_uint64(value);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_double(double value, bj::string_view, bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_double(value);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_bool(bool value, bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_bool(value);
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_null(bj::error_code& errorCode)
+    {
+        if (!AddElement(errorCode))
+        {
+            return false;
+        }
+
+        if (Building)
+        {
+            Stack.push_null();
+        }
+
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_comment_part(bj::string_view, bj::error_code&)
+    {
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::on_comment(bj::string_view, bj::error_code&)
+    {
+        return true;
+    }
+
+    bool LimitedJsonParser::Handler::AddElement(bj::error_code& errorCode)
+    {
+        // The members of an object are counted through their values.
+        if (Containers.empty() || ++Containers.back().Count <= MaxObjectSize)
+        {
+            return true;
+        }
+
+        errorCode = Containers.back().TooLarge;
+        return false;
+    }
+
+    bool LimitedJsonParser::Handler::CheckLength(std::size_t size, bj::error tooLarge,
+                                                 bj::error_code& errorCode) const
+    {
+        if (0 == MaxStringLength || size <= MaxStringLength)
+        {
+            return true;
+        }
+
+        errorCode = tooLarge;
+        return false;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
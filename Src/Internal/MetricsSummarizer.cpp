@@ -0,0 +1,389 @@
+/*************************************************************************************************
+ * @file MetricsSummarizer.cpp
+ *
+ * @brief Concrete implementation of @ref MetricsSummarizer class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/MetricsSummarizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Internal;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Signature of the instruction set specific reduction functions.
+     */
+    using ReduceFunction = MetricsSummarizer::SeriesReduction (*)(const double* values, std::size_t count);
+
+    constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+    MetricsSummarizer::SeriesReduction ReduceScalar(const double* values, std::size_t count)
+    {
+        MetricsSummarizer::SeriesReduction reduction{Infinity, -Infinity, 0.0};
+
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            reduction.Min = std::min(reduction.Min, values[index]);
+            reduction.Max = std::max(reduction.Max, values[index]);
+            reduction.Sum += values[index];
+        }
+
+        return reduction;
+    }
+
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+
+    __attribute__((target("sse2"))) MetricsSummarizer::SeriesReduction ReduceSse2(const double* values,
+                                                                                    std::size_t count)
+    {
+        __m128d minimum = _mm_set1_pd(Infinity);
+        __m128d maximum = _mm_set1_pd(-Infinity);
+        __m128d sum = _mm_setzero_pd();
+
+        std::size_t index = 0;
+
+        for (; index + 2 <= count; index += 2)
+        {
+            const __m128d chunk = _mm_loadu_pd(values + index);
+
+            minimum = _mm_min_pd(minimum, chunk);
+            maximum = _mm_max_pd(maximum, chunk);
+            sum = _mm_add_pd(sum, chunk);
+        }
+
+        double minimumLanes[2];
+        double maximumLanes[2];
+        double sumLanes[2];
+
+        _mm_storeu_pd(minimumLanes, minimum);
+        _mm_storeu_pd(maximumLanes, maximum);
+        _mm_storeu_pd(sumLanes, sum);
+
+        MetricsSummarizer::SeriesReduction reduction = ReduceScalar(values + index, count - index);
+        reduction.Min = std::min({reduction.Min, minimumLanes[0], minimumLanes[1]});
+        reduction.Max = std::max({reduction.Max, maximumLanes[0], maximumLanes[1]});
+        reduction.Sum += sumLanes[0] + sumLanes[1];
+
+        return reduction;
+    }
+
+    __attribute__((target("avx2"))) MetricsSummarizer::SeriesReduction ReduceAvx2(const double* values,
+                                                                                    std::size_t count)
+    {
+        __m256d minimum = _mm256_set1_pd(Infinity);
+        __m256d maximum = _mm256_set1_pd(-Infinity);
+        __m256d sum = _mm256_setzero_pd();
+
+        std::size_t index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m256d chunk = _mm256_loadu_pd(values + index);
+
+            minimum = _mm256_min_pd(minimum, chunk);
+            maximum = _mm256_max_pd(maximum, chunk);
+            sum = _mm256_add_pd(sum, chunk);
+        }
+
+        double minimumLanes[4];
+        double maximumLanes[4];
+        double sumLanes[4];
+
+        _mm256_storeu_pd(minimumLanes, minimum);
+        _mm256_storeu_pd(maximumLanes, maximum);
+        _mm256_storeu_pd(sumLanes, sum);
+
+        // The remaining tail is shorter than 4 values, finish it with the 2 values variant.
+        MetricsSummarizer::SeriesReduction reduction = ReduceSse2(values + index, count - index);
+        reduction.Min = std::min({reduction.Min, minimumLanes[0], minimumLanes[1], minimumLanes[2], minimumLanes[3]});
+        reduction.Max = std::max({reduction.Max, maximumLanes[0], maximumLanes[1], maximumLanes[2], maximumLanes[3]});
+        reduction.Sum += (sumLanes[0] + sumLanes[1]) + (sumLanes[2] + sumLanes[3]);
+
+        return reduction;
+    }
+
+#endif
+
+    /**
+     * @brief Get the reduction function of an instruction set level.
+     *
+     * @param[in] level The instruction set level.
+     *
+     * @return The reduction function.
+     */
+    ReduceFunction GetReduceFunction(SimdLevel level)
+    {
+#if BOOST_AUTO_JSON_SERIALIZER_HAS_X86_SIMD
+        switch (level)
+        {
+        case SimdLevel::Avx2:
+            return ReduceAvx2;
+        case SimdLevel::Sse2:
+            return ReduceSse2;
+        default:
+            break;
+        }
+#else
+        static_cast<void>(level);
+#endif
+
+        return ReduceScalar;
+    }
+
+    /**
+     * @brief Get the numeric value of a metric.
+     *
+     * @param[in] value The metric value.
+     * @param[out] number The value widened to double.
+     *
+     * @return @b true if the value is a number other than NaN.
+     */
+    bool ToNumber(const SerializationValue& value, double& number)
+    {
+        return boost::variant2::visit([&](const auto& data)
+                                      {
+                                          using TData = std::decay_t<decltype(data)>;
+
+                                          if constexpr (std::is_arithmetic_v<TData> && !std::is_same_v<TData, bool>)
+                                          {
+                                              number = static_cast<double>(data);
+                                              return !std::isnan(number);
+                                          }
+                                          else
+                                          {
+                                              return false;
+                                          }
+                                      },
+                                      value.data);
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    MetricsSummarizer::MetricsSummarizer(const MetricSummaryOptions& options)
+        : _options(options)
+    {
+        if (_options.SketchCapacity < 2)
+        {
+            throw XInvalidArgument("The capacity of the metric sketches must be at least 2!");
+        }
+    }
+
+    MetricsSummarizer::Accumulator::Accumulator(std::size_t sketchCapacity)
+        : Count(0),
+          Min(Infinity),
+          Max(-Infinity),
+          Sum(0.0),
+          Sketch(sketchCapacity)
+    {
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    std::map<std::string, MetricSummary> MetricsSummarizer::Summarize(const TestDataStepResults& step)
+    {
+        Accumulators accumulators;
+        AccumulateStep(step, accumulators);
+
+        return ToSummaries(accumulators);
+    }
+
+    std::map<std::string, MetricSummary> MetricsSummarizer::Summarize(const TestDataMonitorResults& monitor)
+    {
+        Accumulators monitorAccumulators;
+        Accumulators stepAccumulators;
+
+        for (const TestDataStepResults& step : monitor.StepResults)
+        {
+            stepAccumulators.clear();
+            AccumulateStep(step, stepAccumulators);
+            MergeInto(monitorAccumulators, stepAccumulators);
+        }
+
+        return ToSummaries(monitorAccumulators);
+    }
+
+    void MetricsSummarizer::Embed(TestDataTestResults& results)
+    {
+        Accumulators monitorAccumulators;
+        Accumulators stepAccumulators;
+
+        for (TestDataMonitorResults& monitor : results.MonitorResults)
+        {
+            monitorAccumulators.clear();
+
+            for (TestDataStepResults& step : monitor.StepResults)
+            {
+                stepAccumulators.clear();
+                AccumulateStep(step, stepAccumulators);
+
+                EmbedInto(stepAccumulators, step.OtherData);
+                MergeInto(monitorAccumulators, stepAccumulators);
+
+                if (!_options.KeepRawSeries)
+                {
+                    step.Metrics.clear();
+                }
+            }
+
+            EmbedInto(monitorAccumulators, monitor.OtherData);
+        }
+    }
+
+    MetricsSummarizer::SeriesReduction MetricsSummarizer::Reduce(const double* values, std::size_t count)
+    {
+        static const ReduceFunction BestReduce = GetReduceFunction(CpuFeatures::GetBestSimdLevel());
+
+        return BestReduce(values, count);
+    }
+
+    MetricsSummarizer::SeriesReduction MetricsSummarizer::Reduce(const double* values, std::size_t count,
+                                                                 SimdLevel level)
+    {
+        return GetReduceFunction(level)(values, count);
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void MetricsSummarizer::AccumulateStep(const TestDataStepResults& step, Accumulators& accumulators)
+    {
+        for (auto& [key, series] : _series)
+        {
+            series.clear();
+        }
+
+        for (const TestDataMetrics& metrics : step.Metrics)
+        {
+            for (const auto& [key, value] : metrics.MetricData)
+            {
+                double number = 0.0;
+
+                if (!ToNumber(value, number))
+                {
+                    continue;
+                }
+
+                auto series = _series.find(key);
+
+                if (_series.end() == series)
+                {
+                    series = _series.emplace(key, std::vector<double>()).first;
+                }
+
+                series->second.push_back(number);
+            }
+        }
+
+        for (const auto& [key, series] : _series)
+        {
+            if (!series.empty())
+            {
+                accumulators.try_emplace(key, _options.SketchCapacity).first->second.Add(series);
+            }
+        }
+    }
+
+    void MetricsSummarizer::MergeInto(Accumulators& target, const Accumulators& source)
+    {
+        for (const auto& [key, accumulator] : source)
+        {
+            target.try_emplace(key, accumulator.Sketch.GetCapacity()).first->second.Merge(accumulator);
+        }
+    }
+
+    std::map<std::string, MetricSummary> MetricsSummarizer::ToSummaries(const Accumulators& accumulators)
+    {
+        std::map<std::string, MetricSummary> summaries;
+
+        for (const auto& [key, accumulator] : accumulators)
+        {
+            summaries.emplace_hint(summaries.end(), key, accumulator.ToSummary());
+        }
+
+        return summaries;
+    }
+
+    void MetricsSummarizer::EmbedInto(const Accumulators& accumulators,
+                                      std::map<std::string, SerializationValue>& otherData) const
+    {
+        for (const auto& [key, accumulator] : accumulators)
+        {
+            const MetricSummary summary = accumulator.ToSummary();
+            const std::string prefix = _options.KeyPrefix + key + '.';
+
+            otherData[prefix + "Count"] = SerializationValue{summary.Count};
+            otherData[prefix + "Min"] = SerializationValue{static_cast<float>(summary.Min)};
+            otherData[prefix + "Max"] = SerializationValue{static_cast<float>(summary.Max)};
+            otherData[prefix + "Mean"] = SerializationValue{static_cast<float>(summary.Mean)};
+            otherData[prefix + "P50"] = SerializationValue{static_cast<float>(summary.P50)};
+            otherData[prefix + "P95"] = SerializationValue{static_cast<float>(summary.P95)};
+            otherData[prefix + "P99"] = SerializationValue{static_cast<float>(summary.P99)};
+        }
+    }
+
+    void MetricsSummarizer::Accumulator::Add(const std::vector<double>& values)
+    {
+        const SeriesReduction reduction = Reduce(values.data(), values.size());
+
+        Count += values.size();
+        Min = std::min(Min, reduction.Min);
+        Max = std::max(Max, reduction.Max);
+        Sum += reduction.Sum;
+
+        for (double value : values)
+        {
+            Sketch.Add(value);
+        }
+    }
+
+    void MetricsSummarizer::Accumulator::Merge(const Accumulator& other)
+    {
+        Count += other.Count;
+        Min = std::min(Min, other.Min);
+        Max = std::max(Max, other.Max);
+        Sum += other.Sum;
+        Sketch.Merge(other.Sketch);
+    }
+
+    MetricSummary MetricsSummarizer::Accumulator::ToSummary() const
+    {
+        MetricSummary summary;
+        summary.Count = Count;
+        summary.Min = Min;
+        summary.Max = Max;
+        summary.Mean = Sum / static_cast<double>(Count);
+        summary.P50 = Sketch.GetQuantile(0.50);
+        summary.P95 = Sketch.GetQuantile(0.95);
+        summary.P99 = Sketch.GetQuantile(0.99);
+
+        return summary;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
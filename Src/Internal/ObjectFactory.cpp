@@ -14,6 +14,7 @@
 #include "Internal/BoostJsonValidatorImpl.hpp"
 #include "Internal/JsonDataSerializer.hpp"
 #include "Internal/JsonDataValidator.hpp"
+#include "Internal/JsonBulkDeserializer.hpp"
 
 // #region Namespace Symbols
 
@@ -26,7 +27,10 @@ namespace Internal
 {
     // #region Construction/Destruction
 
-    ObjectFactory::ObjectFactory() = default;
+    ObjectFactory::ObjectFactory(const JsonParseConfiguration& parseConfiguration)
+        : _parseConfiguration(parseConfiguration)
+    {
+    }
 
     ObjectFactory::~ObjectFactory() = default;
 
@@ -44,12 +48,13 @@ namespace Internal
         IJsonDataSerializerImplFactory::InterfaceSharedPointer dataSerializerImpl;
         Create(dataSerializerImpl);
 
-        objectPtr = std::make_shared<JsonDataSerializer>(dataSerializerImpl);
+        objectPtr = std::make_shared<JsonDataSerializer>(dataSerializerImpl, GetThreadPool());
     }
 
     void ObjectFactory::Create(IJsonDataSerializerImplFactory::InterfaceSharedPointer& objectPtr)
     {
-        objectPtr = std::make_shared<BoostJsonSerializerImpl>();
+        objectPtr = std::make_shared<BoostJsonSerializerImpl>(AllocationTracking::Disabled, nullptr,
+                                                             MemberMatchingOptions(), _parseConfiguration);
     }
 
     void ObjectFactory::Create(IJsonDataValidatorFactory::InterfaceSharedPointer& objectPtr)
@@ -62,7 +67,15 @@ namespace Internal
 
     void ObjectFactory::Create(IJsonDataValidatorImplFactory::InterfaceSharedPointer& objectPtr)
     {
-        objectPtr = std::make_shared<BoostJsonValidatorImpl>();
+        objectPtr = std::make_shared<BoostJsonValidatorImpl>(nullptr, _parseConfiguration);
+    }
+
+    void ObjectFactory::Create(IJsonBulkDeserializerFactory::InterfaceSharedPointer& objectPtr)
+    {
+        IJsonDataSerializerFactory::InterfaceSharedPointer dataSerializer;
+        Create(dataSerializer);
+
+        objectPtr = std::make_shared<JsonBulkDeserializer>(dataSerializer, GetThreadPool());
     }
 
     // #endregion
@@ -74,6 +87,14 @@ namespace Internal
         return std::enable_shared_from_this<ObjectFactory>::shared_from_this();
     }
 
+    std::shared_ptr<ThreadPool> ObjectFactory::GetThreadPool()
+    {
+        std::call_once(_threadPoolOnce, [this]()
+                       { _threadPool = std::make_shared<ThreadPool>(); });
+
+        return _threadPool;
+    }
+
     // #endregion
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
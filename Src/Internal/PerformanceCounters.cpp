@@ -0,0 +1,298 @@
+/*************************************************************************************************
+ * @file PerformanceCounters.cpp
+ *
+ * @brief Concrete implementation of @ref PerformanceCounters class.
+ *
+ * To count the calls, bytes, errors and latencies of the operations of an object.
+ *
+ *************************************************************************************************/
+
+#include "Internal/PerformanceCounters.hpp"
+#include "Internal/BoostJsonSerializerInfra.hpp"
+#include "Internal/JsonValueWriter.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+#include "Exceptions/XInvalidFormat.hpp"
+#include "Exceptions/XSerialization.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Add to a counter only ever written by the calling thread, no read-modify-write is needed.
+     */
+    inline void Add(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the upper bound of the bucket holding the latency of the given rank.
+     */
+    uint64_t GetPercentile(const std::vector<BOOST_AUTO_JSON_SERIALIZER_NS::Internal::LatencyBucket>& histogram,
+                           uint64_t calls,
+                           uint64_t percent)
+    {
+        const uint64_t rank = (calls * percent + 99) / 100;
+        uint64_t cumulativeCount = 0;
+
+        for (const BOOST_AUTO_JSON_SERIALIZER_NS::Internal::LatencyBucket& bucket : histogram)
+        {
+            cumulativeCount += bucket.Count;
+
+            if (cumulativeCount >= rank)
+            {
+                return bucket.UpperBoundNanoseconds;
+            }
+        }
+
+        return 0;
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    namespace bj = boost::json;
+
+    // #region Construction/Destruction
+
+    PerformanceCounters::PerformanceCounters(std::vector<std::string> operationNames)
+        : _operationNames(std::move(operationNames)),
+          _threadCounters(&PerformanceCounters::MergeExited)
+    {
+        if (_operationNames.empty() || _operationNames.size() > MaxOperationCount)
+        {
+            throw XInvalidArgument("PerformanceCounters::operationNames must hold 1 to " +
+                                   std::to_string(MaxOperationCount) + " operations");
+        }
+    }
+
+    PerformanceCounters::~PerformanceCounters() = default;
+
+    // #endregion
+
+    // #region Public Methods
+
+    void PerformanceCounters::RecordSuccess(std::size_t operation, Clock::time_point start, uint64_t bytesIn, uint64_t bytesOut)
+    {
+        OperationCounters& counters = Record(operation, start, bytesIn);
+
+        Add(counters.BytesOut, bytesOut);
+    }
+
+    void PerformanceCounters::RecordFailure(std::size_t operation, Clock::time_point start, uint64_t bytesIn, const std::exception& ex)
+    {
+        OperationCounters& counters = Record(operation, start, bytesIn);
+
+        Add(counters.Errors, 1);
+        Add(counters.ErrorsByCategory[static_cast<std::size_t>(Categorize(ex))], 1);
+    }
+
+    PerformanceSnapshot PerformanceCounters::GetSnapshot() const
+    {
+        PerformanceSnapshot snapshot;
+        snapshot.Operations.resize(_operationNames.size());
+
+        std::vector<std::array<uint64_t, BucketCount>> histograms(_operationNames.size(), std::array<uint64_t, BucketCount>{});
+        std::vector<std::array<uint64_t, static_cast<std::size_t>(ErrorCategory::Count)>> errors(
+            _operationNames.size(), std::array<uint64_t, static_cast<std::size_t>(ErrorCategory::Count)>{});
+
+        _threadCounters.ForEach([&](const ThreadCounters& threadCounters)
+                                {
+                                    for (std::size_t operation = 0; operation < _operationNames.size(); ++operation)
+                                    {
+                                        const OperationCounters& counters = threadCounters.Operations[operation];
+                                        OperationStatistics& statistics = snapshot.Operations[operation];
+
+                                        statistics.Calls += counters.Calls.load(std::memory_order_relaxed);
+                                        statistics.Errors += counters.Errors.load(std::memory_order_relaxed);
+                                        statistics.BytesIn += counters.BytesIn.load(std::memory_order_relaxed);
+                                        statistics.BytesOut += counters.BytesOut.load(std::memory_order_relaxed);
+                                        statistics.TotalNanoseconds += counters.TotalNanoseconds.load(std::memory_order_relaxed);
+                                        statistics.MaxNanoseconds = std::max(statistics.MaxNanoseconds,
+                                                                             counters.MaxNanoseconds.load(std::memory_order_relaxed));
+
+                                        for (std::size_t category = 0; category < errors[operation].size(); ++category)
+                                        {
+                                            errors[operation][category] += counters.ErrorsByCategory[category].load(std::memory_order_relaxed);
+                                        }
+
+                                        for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+                                        {
+                                            histograms[operation][bucket] += counters.LatencyHistogram[bucket].load(std::memory_order_relaxed);
+                                        }
+                                    } });
+
+        for (std::size_t operation = 0; operation < _operationNames.size(); ++operation)
+        {
+            OperationStatistics& statistics = snapshot.Operations[operation];
+            statistics.Operation = _operationNames[operation];
+
+            for (std::size_t category = 0; category < errors[operation].size(); ++category)
+            {
+                if (0 != errors[operation][category])
+                {
+                    statistics.ErrorsByCategory[GetCategoryName(static_cast<ErrorCategory>(category))] = errors[operation][category];
+                }
+            }
+
+            uint64_t histogramCount = 0;
+
+            for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                if (0 != histograms[operation][bucket])
+                {
+                    statistics.LatencyHistogram.push_back(LatencyBucket{GetBucketUpperBound(bucket), histograms[operation][bucket]});
+                    histogramCount += histograms[operation][bucket];
+                }
+            }
+
+            // The counters are read while being written, the histogram is the consistent base of the percentiles.
+            statistics.P50Nanoseconds = GetPercentile(statistics.LatencyHistogram, histogramCount, 50);
+            statistics.P99Nanoseconds = GetPercentile(statistics.LatencyHistogram, histogramCount, 99);
+        }
+
+        return snapshot;
+    }
+
+    std::string PerformanceCounters::ToJson(const PerformanceSnapshot& snapshot)
+    {
+        return JsonValueWriter::Write(bj::value_from(snapshot));
+    }
+
+    ErrorCategory PerformanceCounters::Categorize(const std::exception& ex)
+    {
+        if (nullptr != dynamic_cast<const XSerialization*>(&ex))
+        {
+            return ErrorCategory::Serialization;
+        }
+
+        if (nullptr != dynamic_cast<const XInvalidFormat*>(&ex))
+        {
+            return ErrorCategory::InvalidFormat;
+        }
+
+        if (nullptr != dynamic_cast<const std::invalid_argument*>(&ex))
+        {
+            return ErrorCategory::InvalidArgument;
+        }
+
+        if (nullptr != dynamic_cast<const std::bad_alloc*>(&ex))
+        {
+            return ErrorCategory::OutOfMemory;
+        }
+
+        return ErrorCategory::Other;
+    }
+
+    const char* PerformanceCounters::GetCategoryName(ErrorCategory category)
+    {
+        switch (category)
+        {
+        case ErrorCategory::Serialization:
+            return "Serialization";
+        case ErrorCategory::InvalidFormat:
+            return "InvalidFormat";
+        case ErrorCategory::InvalidArgument:
+            return "InvalidArgument";
+        case ErrorCategory::OutOfMemory:
+            return "OutOfMemory";
+        case ErrorCategory::Other:
+        case ErrorCategory::Count:
+        default:
+            return "Other";
+        }
+    }
+
+    std::size_t PerformanceCounters::GetBucketIndex(uint64_t nanoseconds)
+    {
+        nanoseconds = std::min(nanoseconds, (uint64_t{1} << MaxTrackedBits) - 1);
+
+        if (nanoseconds < SubBucketCount)
+        {
+            return nanoseconds;
+        }
+
+        const std::size_t highestBit = static_cast<std::size_t>(63 - __builtin_clzll(nanoseconds));
+        const std::size_t shift = highestBit - SubBucketBits;
+        const std::size_t subBucket = (nanoseconds >> shift) & (SubBucketCount - 1);
+
+        return SubBucketCount + shift * SubBucketCount + subBucket;
+    }
+
+    uint64_t PerformanceCounters::GetBucketUpperBound(std::size_t bucketIndex)
+    {
+        if (bucketIndex < SubBucketCount)
+        {
+            return bucketIndex + 1;
+        }
+
+        const std::size_t shift = (bucketIndex - SubBucketCount) / SubBucketCount;
+        const std::size_t subBucket = (bucketIndex - SubBucketCount) % SubBucketCount;
+
+        return uint64_t{SubBucketCount + subBucket + 1} << shift;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    PerformanceCounters::OperationCounters& PerformanceCounters::Record(std::size_t operation, Clock::time_point start, uint64_t bytesIn)
+    {
+        const uint64_t nanoseconds = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+
+        OperationCounters& counters = _threadCounters.Get().Operations.at(operation);
+
+        Add(counters.Calls, 1);
+        Add(counters.BytesIn, bytesIn);
+        Add(counters.TotalNanoseconds, nanoseconds);
+        Add(counters.LatencyHistogram[GetBucketIndex(nanoseconds)], 1);
+
+        if (nanoseconds > counters.MaxNanoseconds.load(std::memory_order_relaxed))
+        {
+            counters.MaxNanoseconds.store(nanoseconds, std::memory_order_relaxed);
+        }
+
+        return counters;
+    }
+
+    void PerformanceCounters::MergeExited(ThreadCounters& exited, ThreadCounters& retired)
+    {
+        // Runs under the lock of the contexts, the retired counters have no other writer.
+        for (std::size_t operation = 0; operation < MaxOperationCount; ++operation)
+        {
+            const OperationCounters& from = exited.Operations[operation];
+            OperationCounters& to = retired.Operations[operation];
+
+            Add(to.Calls, from.Calls.load(std::memory_order_relaxed));
+            Add(to.Errors, from.Errors.load(std::memory_order_relaxed));
+            Add(to.BytesIn, from.BytesIn.load(std::memory_order_relaxed));
+            Add(to.BytesOut, from.BytesOut.load(std::memory_order_relaxed));
+            Add(to.TotalNanoseconds, from.TotalNanoseconds.load(std::memory_order_relaxed));
+            to.MaxNanoseconds.store(std::max(to.MaxNanoseconds.load(std::memory_order_relaxed),
+                                             from.MaxNanoseconds.load(std::memory_order_relaxed)),
+                                    std::memory_order_relaxed);
+
+            for (std::size_t category = 0; category < to.ErrorsByCategory.size(); ++category)
+            {
+                Add(to.ErrorsByCategory[category], from.ErrorsByCategory[category].load(std::memory_order_relaxed));
+            }
+
+            for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                Add(to.LatencyHistogram[bucket], from.LatencyHistogram[bucket].load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,179 @@
+/*************************************************************************************************
+ * @file PolicyCache.cpp
+ *
+ * @brief Concrete implementation of @ref PolicyCache class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/PolicyCache.hpp"
+
+#include "Internal/MemoryFootprintInspector.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidFormat.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Estimated links of an entry within the list and the index, about those of a map node.
+     */
+    constexpr std::size_t EntryOverhead =
+        BOOST_AUTO_JSON_SERIALIZER_NS::Internal::MemoryFootprintInspector::MapNodeOverhead;
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    PolicyCache::PolicyCache(std::shared_ptr<Interfaces::IJsonDataSerializer> serializer,
+                             std::shared_ptr<Interfaces::IJsonDataValidator> validator,
+                             const PolicyCacheOptions& options)
+        : _serializer(std::move(serializer)),
+          _validator(std::move(validator)),
+          _statistics()
+    {
+        if (nullptr == _serializer)
+        {
+            throw XArgumentNull("PolicyCache::serializer");
+        }
+
+        _statistics.MaxBytes = options.MaxBytes;
+    }
+
+    PolicyCache::~PolicyCache() = default;
+
+    // #endregion
+
+    // #region Public Methods
+
+    std::shared_ptr<const TestDataTestPolicy> PolicyCache::Deserialize(const std::string& payload)
+    {
+        const ContentDigest digest = ContentHash::Compute(payload);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            auto found = _index.find(digest);
+
+            if (_index.end() != found && found->second->PayloadLength == payload.size())
+            {
+                // Most recently used first.
+                _entries.splice(_entries.begin(), _entries, found->second);
+                ++_statistics.Hits;
+
+                const Entry& entry = *found->second;
+
+                if (!entry.ValidationError.empty())
+                {
+                    ++_statistics.ValidationFailureHits;
+                    throw XInvalidFormat(entry.ValidationError);
+                }
+
+                return entry.Policy;
+            }
+
+            ++_statistics.Misses;
+        }
+
+        if (nullptr != _validator)
+        {
+            try
+            {
+                _validator->Validate(payload);
+            }
+            catch (const XInvalidFormat& ex)
+            {
+                Entry entry;
+                entry.Digest = digest;
+                entry.PayloadLength = payload.size();
+                entry.ValidationError = ex.what();
+                entry.Bytes = sizeof(Entry) + EntryOverhead +
+                              MemoryFootprintInspector::Inspect(entry.ValidationError).HeapBytes;
+
+                Insert(std::move(entry));
+
+                throw;
+            }
+        }
+
+        Entry entry;
+        entry.Digest = digest;
+        entry.PayloadLength = payload.size();
+        entry.Policy = std::make_shared<const TestDataTestPolicy>(_serializer->Deserialize(payload));
+        entry.Bytes = sizeof(Entry) + EntryOverhead + EstimateSize(*entry.Policy);
+
+        std::shared_ptr<const TestDataTestPolicy> policy = entry.Policy;
+
+        Insert(std::move(entry));
+
+        return policy;
+    }
+
+    PolicyCacheStatistics PolicyCache::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        PolicyCacheStatistics statistics = _statistics;
+        statistics.EntryCount = _entries.size();
+
+        return statistics;
+    }
+
+    void PolicyCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _index.clear();
+        _entries.clear();
+        _statistics.UsedBytes = 0;
+    }
+
+    std::size_t PolicyCache::EstimateSize(const TestDataTestPolicy& policy)
+    {
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(policy);
+
+        return report.InlineBytes + report.HeapBytes;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void PolicyCache::Insert(Entry&& entry)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Either filled by a concurrent miss of the same payload, held by a colliding payload or too large to ever
+        // fit.
+        if (_index.count(entry.Digest) > 0 || entry.Bytes > _statistics.MaxBytes)
+        {
+            return;
+        }
+
+        _statistics.UsedBytes += entry.Bytes;
+        _entries.push_front(std::move(entry));
+        _index.emplace(_entries.front().Digest, _entries.begin());
+
+        while (_statistics.UsedBytes > _statistics.MaxBytes)
+        {
+            const Entry& leastRecentlyUsed = _entries.back();
+
+            _statistics.UsedBytes -= leastRecentlyUsed.Bytes;
+            ++_statistics.Evictions;
+
+            _index.erase(leastRecentlyUsed.Digest);
+            _entries.pop_back();
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
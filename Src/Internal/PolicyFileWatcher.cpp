@@ -0,0 +1,258 @@
+/*************************************************************************************************
+ * @file PolicyFileWatcher.cpp
+ *
+ * @brief Concrete implementation of @ref PolicyFileWatcher class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/PolicyFileWatcher.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "Internal/ElapsedTime.hpp"
+#include "Internal/FileReader.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Notifications meaning the content of a file in the directory may have changed.
+     */
+    constexpr uint32_t WatchedEvents = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE;
+
+    std::string GetErrorMessage(const std::string& prefix, const std::string& path)
+    {
+        return prefix + path + " -> " + std::strerror(errno);
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    PolicyFileWatcher::PolicyFileWatcher(const std::string& path,
+                                         std::shared_ptr<Interfaces::IPolicySnapshotHolder> holder,
+                                         ErrorCallback onError,
+                                         const PolicyFileWatcherOptions& options)
+        : _path(path),
+          _fileName(std::filesystem::path(path).filename().string()),
+          _holder(std::move(holder)),
+          _onError(std::move(onError)),
+          _options(options),
+          _inotifyFd(-1),
+          _stopFd(-1),
+          _statistics()
+    {
+        if (nullptr == _holder)
+        {
+            throw XArgumentNull("PolicyFileWatcher::holder");
+        }
+
+        std::string directory = std::filesystem::path(path).parent_path().string();
+
+        if (directory.empty())
+        {
+            directory = ".";
+        }
+
+        _inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        if (_inotifyFd < 0)
+        {
+            throw XInvalidArgument(GetErrorMessage("Cannot watch directory: ", directory));
+        }
+
+        _stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        if (_stopFd < 0 || inotify_add_watch(_inotifyFd, directory.c_str(), WatchedEvents) < 0)
+        {
+            const std::string message = GetErrorMessage("Cannot watch directory: ", directory);
+
+            close(_inotifyFd);
+
+            if (_stopFd >= 0)
+            {
+                close(_stopFd);
+            }
+
+            throw XInvalidArgument(message);
+        }
+
+        _thread = std::thread(&PolicyFileWatcher::WatchLoop, this);
+    }
+
+    PolicyFileWatcher::~PolicyFileWatcher()
+    {
+        const uint64_t signal = 1;
+
+        // The counter cannot overflow with a single signal, the write cannot fail.
+        [[maybe_unused]] const ssize_t written = write(_stopFd, &signal, sizeof(signal));
+
+        _thread.join();
+
+        close(_stopFd);
+        close(_inotifyFd);
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    PolicyFileWatcherStatistics PolicyFileWatcher::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        return _statistics;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void PolicyFileWatcher::WatchLoop()
+    {
+        const Clock::duration debounce = std::chrono::milliseconds(_options.DebounceMilliseconds);
+
+        bool pending = _options.LoadOnStart;
+        Clock::time_point changedAt = Clock::now();
+        Clock::time_point reloadAt = changedAt;
+
+        pollfd descriptors[2] = {{_inotifyFd, POLLIN, 0}, {_stopFd, POLLIN, 0}};
+
+        while (true)
+        {
+            int timeout = -1;
+
+            if (pending)
+            {
+                // Rounded up so that the loop does not spin until the deadline.
+                const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(reloadAt - Clock::now()).count();
+                timeout = static_cast<int>(std::max<decltype(remaining)>(0, remaining));
+            }
+
+            if (poll(descriptors, 2, timeout) < 0 && EINTR != errno)
+            {
+                if (_onError)
+                {
+                    _onError(XInvalidArgument(GetErrorMessage("Cannot watch policy file: ", _path)));
+                }
+
+                return;
+            }
+
+            if (0 != (descriptors[1].revents & POLLIN))
+            {
+                return;
+            }
+
+            if (0 != (descriptors[0].revents & POLLIN) && DrainEvents())
+            {
+                const Clock::time_point now = Clock::now();
+
+                if (pending)
+                {
+                    std::lock_guard<std::mutex> lock(_statisticsMutex);
+                    ++_statistics.CoalescedEvents;
+                }
+                else
+                {
+                    pending = true;
+                    changedAt = now;
+                }
+
+                reloadAt = now + debounce;
+            }
+
+            if (pending && Clock::now() >= reloadAt)
+            {
+                pending = false;
+                Reload(changedAt);
+            }
+        }
+    }
+
+    bool PolicyFileWatcher::DrainEvents()
+    {
+        alignas(inotify_event) char buffer[4096];
+        bool changed = false;
+
+        while (true)
+        {
+            const ssize_t length = read(_inotifyFd, buffer, sizeof(buffer));
+
+            if (length <= 0)
+            {
+                return changed;
+            }
+
+            for (ssize_t offset = 0; offset < length;)
+            {
+                inotify_event event;
+                std::memcpy(&event, buffer + offset, sizeof(event));
+
+                const char* name = buffer + offset + sizeof(inotify_event);
+
+                if (event.len > 0 && _fileName == name)
+                {
+                    changed = true;
+                }
+
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+            }
+        }
+    }
+
+    void PolicyFileWatcher::Reload(Clock::time_point changedAt)
+    {
+        const Clock::time_point start = Clock::now();
+
+        try
+        {
+            _holder->Publish(ReadWholeFile(_path, "policy"));
+        }
+        catch (const std::exception& ex)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_statisticsMutex);
+                ++_statistics.FailedReloads;
+            }
+
+            if (_onError)
+            {
+                _onError(ex);
+            }
+
+            return;
+        }
+
+        const Clock::time_point end = Clock::now();
+
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+
+        ++_statistics.Reloads;
+        _statistics.LastReloadNanoseconds = GetElapsedNanoseconds(start, end);
+        _statistics.LastSwapLatencyNanoseconds = GetElapsedNanoseconds(changedAt, end);
+        _statistics.MaxSwapLatencyNanoseconds = std::max(_statistics.MaxSwapLatencyNanoseconds,
+                                                         _statistics.LastSwapLatencyNanoseconds);
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,84 @@
+/*************************************************************************************************
+ * @file PolicySnapshotHolder.cpp
+ *
+ * @brief Concrete implementation of @ref PolicySnapshotHolder class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/PolicySnapshotHolder.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    PolicySnapshotHolder::PolicySnapshotHolder(std::shared_ptr<Interfaces::IJsonDataSerializer> serializer,
+                                               std::shared_ptr<Interfaces::IJsonDataValidator> validator,
+                                               std::shared_ptr<const TestDataTestPolicy> initialPolicy)
+        : _serializer(std::move(serializer)),
+          _validator(std::move(validator)),
+          _current(std::move(initialPolicy)),
+          _version(1)
+    {
+        if (nullptr == _serializer)
+        {
+            throw XArgumentNull("PolicySnapshotHolder::serializer");
+        }
+
+        if (nullptr == _current)
+        {
+            _current = std::make_shared<const TestDataTestPolicy>();
+        }
+    }
+
+    PolicySnapshotHolder::~PolicySnapshotHolder() = default;
+
+    // #endregion
+
+    // #region Public Methods
+
+    std::shared_ptr<const TestDataTestPolicy> PolicySnapshotHolder::Get() const
+    {
+        return std::atomic_load(&_current);
+    }
+
+    uint64_t PolicySnapshotHolder::GetVersion() const
+    {
+        return _version.load(std::memory_order_acquire);
+    }
+
+    uint64_t PolicySnapshotHolder::Publish(std::shared_ptr<const TestDataTestPolicy> policy)
+    {
+        if (nullptr == policy)
+        {
+            throw XArgumentNull("PolicySnapshotHolder::policy");
+        }
+
+        std::atomic_store(&_current, std::move(policy));
+
+        // Bumped after the swap, a reader seeing the new version finds the new snapshot.
+        return _version.fetch_add(1, std::memory_order_acq_rel) + 1;
+    }
+
+    uint64_t PolicySnapshotHolder::Publish(const std::string& payload)
+    {
+        if (nullptr != _validator)
+        {
+            _validator->Validate(payload);
+        }
+
+        return Publish(std::make_shared<const TestDataTestPolicy>(_serializer->Deserialize(payload)));
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
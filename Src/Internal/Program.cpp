@@ -9,6 +9,11 @@
 
 #include "Internal/Program.hpp"
 
+#include <iomanip>
+
+#include "Internal/FileReader.hpp"
+#include "Internal/MemoryFootprintInspector.hpp"
+
 #include "Exceptions/XArgumentNull.hpp"
 
 // #region Namespace Symbols
@@ -33,11 +38,29 @@ namespace Internal
 
     int32_t Program::Run()
     {
+        return Run(std::vector<std::string>());
+    }
 
+    int32_t Program::Run(const std::vector<std::string>& arguments)
+    {
         try
         {
             std::cout << "**** Boost JSON Serializer ****\n"
                       << std::endl;
+
+            if (arguments.empty())
+            {
+                return 0;
+            }
+
+            if ("footprint" != arguments[0] || 2 != arguments.size())
+            {
+                std::cout << "Usage: footprint <payload file>" << std::endl;
+
+                return 1;
+            }
+
+            RunFootprint(arguments[1]);
         }
         catch (const std::exception &ex)
         {
@@ -51,5 +74,33 @@ namespace Internal
 
     // #endregion
 
+    // #region Private Methods
+
+    void Program::RunFootprint(const std::string& path)
+    {
+        const std::string payload = ReadWholeFile(path, "payload");
+        const TestDataTestResults results = bj::value_to<TestDataTestResults>(bj::parse(payload));
+        const MemoryFootprintReport report = MemoryFootprintInspector::Inspect(results);
+
+        std::cout << std::left << std::setw(56) << "Level" << std::right << std::setw(12) << "Instances"
+                  << std::setw(12) << "Elements" << std::setw(14) << "Heap bytes" << std::setw(14) << "Slack bytes"
+                  << "\n";
+
+        for (const auto& [levelPath, level] : report.Levels)
+        {
+            std::cout << std::left << std::setw(56) << levelPath << std::right << std::setw(12) << level.Instances
+                      << std::setw(12) << level.Elements << std::setw(14) << level.HeapBytes << std::setw(14)
+                      << level.SlackBytes << "\n";
+        }
+
+        std::cout << "\nPayload bytes:    " << payload.size()
+                  << "\nInline bytes:     " << report.InlineBytes
+                  << "\nHeap bytes:       " << report.HeapBytes
+                  << "\nSlack bytes:      " << report.SlackBytes
+                  << "\nSerialized bytes: " << report.SerializedSize << std::endl;
+    }
+
+    // #endregion
+
 } // namespace Internal
 END_BOOST_AUTO_JSON_SERIALIZER_NS
\ No newline at end of file
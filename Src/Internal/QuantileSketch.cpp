@@ -0,0 +1,204 @@
+/*************************************************************************************************
+ * @file QuantileSketch.cpp
+ *
+ * @brief Concrete implementation of @ref QuantileSketch class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/QuantileSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    QuantileSketch::QuantileSketch(std::size_t capacity)
+        : _capacity(capacity),
+          _levels(1)
+    {
+        if (_capacity < 2)
+        {
+            throw XInvalidArgument("The capacity of a quantile sketch must be at least 2!");
+        }
+
+        _levels.front().reserve(_capacity);
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    void QuantileSketch::Add(double value)
+    {
+        std::vector<double>& values = _levels.front();
+        values.push_back(value);
+        ++_count;
+
+        if (values.size() >= _capacity)
+        {
+            CompactFull(0);
+        }
+    }
+
+    void QuantileSketch::Merge(const QuantileSketch& other)
+    {
+        if (other._capacity != _capacity)
+        {
+            throw XInvalidArgument("Only the quantile sketches of the same capacity can be merged!");
+        }
+
+        if (&other == this)
+        {
+            const QuantileSketch copy(other);
+            Merge(copy);
+            return;
+        }
+
+        if (_levels.size() < other._levels.size())
+        {
+            _levels.resize(other._levels.size());
+        }
+
+        for (std::size_t level = 0; level < other._levels.size(); ++level)
+        {
+            _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+        }
+
+        _count += other._count;
+
+        CompactFull(0);
+    }
+
+    double QuantileSketch::GetQuantile(double rank) const
+    {
+        if (!(rank >= 0.0 && rank <= 1.0))
+        {
+            throw XInvalidArgument("The rank of a quantile must be within 0 and 1!");
+        }
+
+        if (0 == _count)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        std::vector<std::pair<double, std::uint64_t>> weighted;
+        weighted.reserve(GetRetainedCount());
+
+        for (std::size_t level = 0; level < _levels.size(); ++level)
+        {
+            for (double value : _levels[level])
+            {
+                weighted.emplace_back(value, std::uint64_t(1) << level);
+            }
+        }
+
+        std::sort(weighted.begin(), weighted.end(),
+                  [](const auto& left, const auto& right)
+                  { return left.first < right.first; });
+
+        // The compactions keep the total weight equal to the count of the stream.
+        const std::uint64_t target =
+            std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(rank * static_cast<double>(_count))));
+
+        std::uint64_t cumulated = 0;
+
+        for (const auto& [value, weight] : weighted)
+        {
+            cumulated += weight;
+
+            if (cumulated >= target)
+            {
+                return value;
+            }
+        }
+
+        return weighted.back().first;
+    }
+
+    std::uint64_t QuantileSketch::GetCount() const
+    {
+        return _count;
+    }
+
+    std::size_t QuantileSketch::GetRetainedCount() const
+    {
+        std::size_t retained = 0;
+
+        for (const std::vector<double>& values : _levels)
+        {
+            retained += values.size();
+        }
+
+        return retained;
+    }
+
+    std::size_t QuantileSketch::GetCapacity() const
+    {
+        return _capacity;
+    }
+
+    void QuantileSketch::Clear()
+    {
+        for (std::vector<double>& values : _levels)
+        {
+            values.clear();
+        }
+
+        _count = 0;
+        _compactions = 0;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void QuantileSketch::CompactFull(std::size_t fromLevel)
+    {
+        // A compaction may fill the next level, and merged levels may be full at any height.
+        for (std::size_t level = fromLevel; level < _levels.size(); ++level)
+        {
+            if (_levels[level].size() < _capacity)
+            {
+                continue;
+            }
+
+            if (level + 1 == _levels.size())
+            {
+                _levels.emplace_back().reserve(_capacity);
+            }
+
+            std::vector<double>& values = _levels[level];
+            std::vector<double>& promoted = _levels[level + 1];
+
+            std::sort(values.begin(), values.end());
+
+            // Every pair of values is replaced by one of them with twice their weight, an unpaired largest
+            // value stays where it is.
+            const std::size_t pairedCount = values.size() & ~std::size_t(1);
+
+            for (std::size_t index = (0 == _compactions % 2) ? 0 : 1; index < pairedCount; index += 2)
+            {
+                promoted.push_back(values[index]);
+            }
+
+            values.erase(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(pairedCount));
+            ++_compactions;
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
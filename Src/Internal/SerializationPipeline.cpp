@@ -0,0 +1,248 @@
+/*************************************************************************************************
+ * @file SerializationPipeline.cpp
+ *
+ * @brief Concrete implementation of @ref SerializationPipeline class.
+ *
+ * To serialize the results of the producers on a dedicated thread.
+ *
+ *************************************************************************************************/
+
+#include "Internal/SerializationPipeline.hpp"
+
+#include "Exceptions/XArgumentNull.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Interfaces;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    SerializationPipeline::SerializationPipeline(std::shared_ptr<IJsonDataSerializer> serializer,
+                                                 std::shared_ptr<ISerializedResultSink> sink,
+                                                 const SerializationPipelineOptions& options)
+        : _serializer(serializer),
+          _sink(sink),
+          _backpressure(options.Backpressure),
+          _queue(options.QueueCapacity)
+    {
+        if (nullptr == _serializer)
+        {
+            throw XArgumentNull("SerializationPipeline::serializer");
+        }
+
+        if (nullptr == _sink)
+        {
+            throw XArgumentNull("SerializationPipeline::sink");
+        }
+
+        _consumer = std::thread(&SerializationPipeline::ConsumerLoop, this);
+    }
+
+    SerializationPipeline::~SerializationPipeline()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+
+        _consumerCondition.notify_one();
+        _consumer.join();
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    bool SerializationPipeline::Submit(TestDataMonitorResults&& results)
+    {
+        if (!_queue.TryPush(results))
+        {
+            switch (_backpressure)
+            {
+            case BackpressurePolicy::Block:
+            {
+                ++_producerWaits;
+
+                std::unique_lock<std::mutex> lock(_mutex);
+
+                ++_producersWaiting;
+
+                // The push is retried under the lock, so a consumer making room can not be missed.
+                _producerCondition.wait(lock, [this, &results]
+                                        { return _queue.TryPush(results); });
+
+                --_producersWaiting;
+                break;
+            }
+            case BackpressurePolicy::DropOldest:
+                while (!_queue.TryPush(results))
+                {
+                    TestDataMonitorResults evictedResults;
+
+                    if (_queue.TryPop(evictedResults))
+                    {
+                        ++_dropped;
+                        Complete();
+                    }
+                }
+                break;
+            case BackpressurePolicy::FailFast:
+            default:
+                ++_rejected;
+                return false;
+            }
+        }
+
+        ++_submitted;
+        UpdateMaxQueueDepth();
+
+        Notify(_consumerWaiting, _consumerCondition, false);
+
+        return true;
+    }
+
+    void SerializationPipeline::Flush()
+    {
+        const uint64_t target = _submitted.load();
+
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        ++_flushersWaiting;
+
+        _flushCondition.wait(lock, [this, target]
+                             { return _completed.load() >= target; });
+
+        --_flushersWaiting;
+    }
+
+    SerializationPipelineStatistics SerializationPipeline::GetStatistics() const
+    {
+        SerializationPipelineStatistics statistics;
+
+        statistics.QueueCapacity = _queue.GetCapacity();
+        statistics.QueueDepth = _queue.GetApproximateSize();
+        statistics.MaxQueueDepth = _maxQueueDepth.load(std::memory_order_relaxed);
+        statistics.Submitted = _submitted.load(std::memory_order_relaxed);
+        statistics.Written = _written.load(std::memory_order_relaxed);
+        statistics.Dropped = _dropped.load(std::memory_order_relaxed);
+        statistics.Rejected = _rejected.load(std::memory_order_relaxed);
+        statistics.Failed = _failed.load(std::memory_order_relaxed);
+        statistics.ProducerWaits = _producerWaits.load(std::memory_order_relaxed);
+
+        return statistics;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void SerializationPipeline::ConsumerLoop()
+    {
+        while (true)
+        {
+            TestDataMonitorResults results;
+
+            if (_queue.TryPop(results))
+            {
+                Notify(_producersWaiting, _producerCondition, false);
+
+                Process(std::move(results));
+                continue;
+            }
+
+            if (0 != _queue.GetApproximateSize())
+            {
+                // A producer claimed a cell but did not publish its results yet.
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            ++_consumerWaiting;
+
+            _consumerCondition.wait(lock, [this]
+                                    { return _stopping || 0 != _queue.GetApproximateSize(); });
+
+            --_consumerWaiting;
+
+            if (_stopping && 0 == _queue.GetApproximateSize())
+            {
+                return;
+            }
+        }
+    }
+
+    void SerializationPipeline::Process(TestDataMonitorResults&& results)
+    {
+        try
+        {
+            TestDataTestResults document;
+            document.MonitorResults.push_back(std::move(results));
+
+            _sink->Write(_serializer->Serialize(document));
+
+            ++_written;
+        }
+        catch (...)
+        {
+            // Nobody could catch it on this thread, the failure is reported through the statistics.
+            ++_failed;
+        }
+
+        Complete();
+    }
+
+    void SerializationPipeline::Complete()
+    {
+        ++_completed;
+
+        Notify(_flushersWaiting, _flushCondition, true);
+    }
+
+    void SerializationPipeline::Notify(std::atomic<std::size_t>& waiterCount,
+                                       std::condition_variable& condition,
+                                       bool notifyAll)
+    {
+        // A read-modify-write, like the increment of the waiter, so that both are ordered on the counter: either
+        // the waker sees the waiter, or the waiter sees the new state when it evaluates its predicate.
+        if (0 == waiterCount.fetch_add(0, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+
+        if (notifyAll)
+        {
+            condition.notify_all();
+        }
+        else
+        {
+            condition.notify_one();
+        }
+    }
+
+    void SerializationPipeline::UpdateMaxQueueDepth()
+    {
+        const std::size_t queueDepth = _queue.GetApproximateSize();
+        std::size_t maxQueueDepth = _maxQueueDepth.load(std::memory_order_relaxed);
+
+        while (queueDepth > maxQueueDepth &&
+               !_maxQueueDepth.compare_exchange_weak(maxQueueDepth, queueDepth, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -0,0 +1,113 @@
+/*************************************************************************************************
+ * @file ThreadPool.cpp
+ *
+ * @brief Concrete implementation of @ref ThreadPool class.
+ *
+ *************************************************************************************************/
+
+#include "Internal/ThreadPool.hpp"
+
+#include <algorithm>
+
+#include "Exceptions/XArgumentNull.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    ThreadPool::ThreadPool(std::size_t threadCount)
+        : _stopping(false),
+          _threadCount((0 == threadCount) ? std::max<std::size_t>(1, std::thread::hardware_concurrency()) : threadCount)
+    {
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+
+        _condition.notify_all();
+
+        for (std::thread& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    void ThreadPool::Post(std::function<void()> task)
+    {
+        if (!task)
+        {
+            throw XArgumentNull("ThreadPool::task");
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (_workers.empty())
+            {
+                _workers.reserve(_threadCount);
+
+                for (std::size_t index = 0; index < _threadCount; ++index)
+                {
+                    _workers.emplace_back(&ThreadPool::WorkerLoop, this);
+                }
+            }
+
+            _tasks.push_back(std::move(task));
+        }
+
+        _condition.notify_one();
+    }
+
+    std::size_t ThreadPool::GetThreadCount() const
+    {
+        return _threadCount;
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void ThreadPool::WorkerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _condition.wait(lock, [this]
+                                { return _stopping || !_tasks.empty(); });
+
+                if (_tasks.empty())
+                {
+                    // Stopping and nothing left to drain.
+                    return;
+                }
+
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
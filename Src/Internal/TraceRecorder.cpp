@@ -0,0 +1,221 @@
+/*************************************************************************************************
+ * @file TraceRecorder.cpp
+ *
+ * @brief Concrete implementation of @ref TraceRecorder and @ref TraceScope classes.
+ *
+ *************************************************************************************************/
+
+#include "Internal/TraceRecorder.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+
+#include "Internal/ElapsedTime.hpp"
+#include "Internal/JsonStringEscaper.hpp"
+
+#include "Exceptions/XInvalidArgument.hpp"
+
+// #region Namespace Symbols
+
+using namespace BOOST_AUTO_JSON_SERIALIZER_NS::Exceptions;
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Get a process wide unique id for a thread ring, it is the thread id shown by the trace viewers.
+     */
+    uint64_t NextThreadId()
+    {
+        static std::atomic<uint64_t> nextThreadId{1};
+        return nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Append nanoseconds as the fractional microseconds the trace event format expects.
+     */
+    void AppendMicroseconds(std::string& output, uint64_t nanoseconds)
+    {
+        char buffer[32];
+        const int length = std::snprintf(buffer, sizeof(buffer), "%" PRIu64 ".%03" PRIu64,
+                                         nanoseconds / 1000, nanoseconds % 1000);
+
+        output.append(buffer, static_cast<std::size_t>(length));
+    }
+}
+
+BEGIN_BOOST_AUTO_JSON_SERIALIZER_NS
+namespace Internal
+{
+    // #region Construction/Destruction
+
+    TraceRecorder::TraceRecorder()
+        : _origin(Clock::now()),
+          _droppedEvents(0),
+          _rings([this](ThreadRing& exited, ThreadRing& retired)
+                 { MergeExited(exited, retired); })
+    {
+    }
+
+    TraceRecorder::~TraceRecorder() = default;
+
+    TraceRecorder::ThreadRing::ThreadRing()
+        : ThreadId(NextThreadId()),
+          Head(0),
+          Tail(0),
+          Events()
+    {
+    }
+
+    // #endregion
+
+    // #region Public Methods
+
+    void TraceRecorder::Record(const char* category, const char* name, Clock::time_point start, Clock::time_point end,
+                               uint64_t bytes)
+    {
+        ThreadRing& ring = _rings.Get();
+
+        const std::size_t tail = ring.Tail.load(std::memory_order_relaxed);
+
+        if (tail - ring.Head.load(std::memory_order_acquire) >= RingCapacity)
+        {
+            _droppedEvents.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        ring.Events[tail % RingCapacity] = TraceEvent{category, name, GetElapsedNanoseconds(_origin, start),
+                                                      GetElapsedNanoseconds(start, end), bytes};
+
+        // Publishes the event to the flushing thread.
+        ring.Tail.store(tail + 1, std::memory_order_release);
+    }
+
+    std::string TraceRecorder::Flush()
+    {
+        std::lock_guard<std::mutex> lock(_flushMutex);
+
+        std::string output = "{\"traceEvents\":[";
+        bool first = true;
+
+        _rings.ForEach([&output, &first](ThreadRing& ring)
+                       {
+                           const std::size_t head = ring.Head.load(std::memory_order_relaxed);
+                           const std::size_t tail = ring.Tail.load(std::memory_order_acquire);
+
+                           for (std::size_t index = head; index != tail; ++index)
+                           {
+                               const TraceEvent& event = ring.Events[index % RingCapacity];
+
+                               output.append(first ? "{\"name\":" : ",{\"name\":");
+                               JsonStringEscaper::AppendQuoted(output, event.Name);
+                               output.append(",\"cat\":");
+                               JsonStringEscaper::AppendQuoted(output, event.Category);
+                               output.append(",\"ph\":\"X\",\"pid\":1,\"tid\":");
+                               output.append(std::to_string(ring.ThreadId));
+                               output.append(",\"ts\":");
+                               AppendMicroseconds(output, event.StartNanoseconds);
+                               output.append(",\"dur\":");
+                               AppendMicroseconds(output, event.DurationNanoseconds);
+                               output.append(",\"args\":{\"bytes\":");
+                               output.append(std::to_string(event.Bytes));
+                               output.append("}}");
+
+                               first = false;
+                           }
+
+                           // Hands the slots back to the recording thread.
+                           ring.Head.store(tail, std::memory_order_release); });
+
+        output.append("],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":");
+        output.append(std::to_string(GetDroppedEventCount()));
+        output.append("}}");
+
+        return output;
+    }
+
+    void TraceRecorder::FlushToFile(const std::string& path)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file)
+        {
+            throw XInvalidArgument("Cannot open trace file: " + path);
+        }
+
+        const std::string trace = Flush();
+        file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+
+        if (!file)
+        {
+            throw XInvalidArgument("Cannot write trace file: " + path);
+        }
+    }
+
+    uint64_t TraceRecorder::GetDroppedEventCount() const
+    {
+        return _droppedEvents.load(std::memory_order_relaxed);
+    }
+
+    // #endregion
+
+    // #region Private Methods
+
+    void TraceRecorder::MergeExited(ThreadRing& exited, ThreadRing& retired)
+    {
+        // Runs under the lock of the rings, as the flushes do, so the retired ring has a single producer and a
+        // single consumer at a time.
+        const std::size_t tail = exited.Tail.load(std::memory_order_acquire);
+        std::size_t retiredTail = retired.Tail.load(std::memory_order_relaxed);
+
+        for (std::size_t index = exited.Head.load(std::memory_order_relaxed); index != tail; ++index)
+        {
+            if (retiredTail - retired.Head.load(std::memory_order_relaxed) >= RingCapacity)
+            {
+                _droppedEvents.fetch_add(tail - index, std::memory_order_relaxed);
+                break;
+            }
+
+            retired.Events[retiredTail % RingCapacity] = exited.Events[index % RingCapacity];
+            ++retiredTail;
+        }
+
+        retired.Tail.store(retiredTail, std::memory_order_release);
+    }
+
+    // #endregion
+
+    // #region TraceScope
+
+    TraceScope::TraceScope(TraceRecorder* recorder, const char* category, const char* name)
+        : _recorder(recorder),
+          _category(category),
+          _name(name),
+          _start(),
+          _bytes(0)
+    {
+        if (nullptr != _recorder)
+        {
+            _start = TraceRecorder::Clock::now();
+        }
+    }
+
+    TraceScope::~TraceScope()
+    {
+        if (nullptr != _recorder)
+        {
+            _recorder->Record(_category, _name, _start, TraceRecorder::Clock::now(), _bytes);
+        }
+    }
+
+    void TraceScope::SetBytes(uint64_t bytes)
+    {
+        _bytes = bytes;
+    }
+
+    // #endregion
+
+} // namespace Internal
+END_BOOST_AUTO_JSON_SERIALIZER_NS
@@ -17,10 +17,13 @@ using namespace BOOST_AUTO_JSON_SERIALIZER_NS::FactoryInterfaces;
 /**
  * @brief Entry-point function to play with boost auto JSON serializer.
  *
+ * @param[in] argc The number of arguments, the program name included.
+ * @param[in] argv The arguments, an optional command followed by its own arguments.
+ *
  * @return 0 if the service application exited normally. Otherwise, a non-zero error code will
  * be returned.
  */
-int main()
+int main(int argc, char* argv[])
 {
     // Creat the common object factory that own all the objects created for the application
     std::shared_ptr<ObjectFactory> commonObjectFactory = std::make_shared<ObjectFactory>();
@@ -29,5 +32,5 @@ int main()
     IProgramFactory::InterfaceSharedPointer program;
     commonObjectFactory->Create(program);
 
-    return program->Run();
+    return program->Run(std::vector<std::string>(argv + 1, argv + argc));
 }
\ No newline at end of file